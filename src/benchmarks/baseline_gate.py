@@ -0,0 +1,93 @@
+"""
+Baseline Gate Module
+Saves benchmark results as baselines and flags regressions against them
+"""
+
+import csv
+import shutil
+
+from src.benchmarks.config import PATHS, REGRESSION_SETTINGS, get_benchmark_suffix
+
+
+def _result_files(directory):
+    """Result CSVs of the current suffix in directory"""
+    return sorted(directory.glob(f"*_results{get_benchmark_suffix()}.csv"))
+
+
+def _read_rows(csv_file):
+    """Rows of a results CSV keyed by n"""
+    with open(csv_file, "r", encoding="utf-8") as f:
+        return {row["n"]: row for row in csv.DictReader(f)}
+
+
+def _as_float(value):
+    try:
+        return float(value)
+    except (TypeError, ValueError):
+        return None
+
+
+def save_baselines(results_dir=None, baselines_dir=None):
+    """Copy the current result CSVs to the baselines directory"""
+    results_dir = results_dir or PATHS["results"]
+    baselines_dir = baselines_dir or PATHS["baselines"]
+    baselines_dir.mkdir(parents=True, exist_ok=True)
+
+    for csv_file in _result_files(results_dir):
+        shutil.copy2(csv_file, baselines_dir / csv_file.name)
+        print(f"Baseline saved: {baselines_dir / csv_file.name}")
+
+
+def check_regressions(results_dir=None, baselines_dir=None, threshold=None):
+    """
+    Compare the current results with the saved baselines.
+
+    A point regresses when even the low end of its 95% confidence interval is
+    more than `threshold` (relative) and min_delta_ms (absolute) slower than the
+    baseline median, so noise within the interval never fails the gate.
+    Returns the regressions as (file, n, implementation, baseline_ms, current_ms).
+    """
+    results_dir = results_dir or PATHS["results"]
+    baselines_dir = baselines_dir or PATHS["baselines"]
+    if threshold is None:
+        threshold = REGRESSION_SETTINGS["threshold"]
+
+    print("\nRegression check against baselines")
+    print("-" * 40)
+
+    regressions = []
+    compared = 0
+    for csv_file in _result_files(results_dir):
+        baseline_file = baselines_dir / csv_file.name
+        if not baseline_file.exists():
+            print(f"  - {csv_file.name}: no baseline")
+            continue
+
+        baseline_rows = _read_rows(baseline_file)
+        for n, row in _read_rows(csv_file).items():
+            baseline_row = baseline_rows.get(n)
+            if baseline_row is None:
+                continue
+            for implementation in REGRESSION_SETTINGS["gated_implementations"]:
+                baseline_ms = _as_float(baseline_row.get(f"{implementation}_ms"))
+                current_ms = _as_float(row.get(f"{implementation}_ms"))
+                if baseline_ms is None or current_ms is None:
+                    continue
+                compared += 1
+
+                # Results written before the in-process timing have no interval
+                low_ms = _as_float(row.get(f"{implementation}_ci_low_ms"))
+                low_ms = current_ms if low_ms is None else low_ms
+                slower = low_ms - baseline_ms
+                if slower > REGRESSION_SETTINGS["min_delta_ms"] and low_ms > baseline_ms * (1 + threshold):
+                    regressions.append((csv_file.name, n, implementation, baseline_ms, current_ms))
+
+    for name, n, implementation, baseline_ms, current_ms in regressions:
+        change = (current_ms / baseline_ms - 1) * 100 if baseline_ms > 0 else float("inf")
+        print(f"  ✗ {name} n={n} {implementation}: {baseline_ms:.4f} ms -> {current_ms:.4f} ms ({change:+.1f}%)")
+
+    if regressions:
+        print(f"  {len(regressions)} of {compared} points regressed by more than {threshold:.0%}")
+    else:
+        print(f"  ✓ No regressions in {compared} points (threshold {threshold:.0%})")
+    return regressions
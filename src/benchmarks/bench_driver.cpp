@@ -0,0 +1,79 @@
+// Copyright (c) 2025 Andres Quesada, David Obando, Randy Aguero
+//
+// In-process timing driver for the benchmark programs.
+//
+// performance_tester compiles each C++ benchmark together with this file and
+// -Dmain=transpyler_bench_main, so the program's own main() becomes a function
+// this driver can call several times in one process. With
+// TRANSPYLER_BENCH_REPEAT unset it is called once and nothing extra is
+// printed, so the executable behaves like the plain program.
+//
+//   TRANSPYLER_BENCH_WARMUP     untimed calls before measuring (default 0)
+//   TRANSPYLER_BENCH_REPEAT     maximum number of timed calls
+//   TRANSPYLER_BENCH_BUDGET_MS  stop early once the calls took this long
+//
+// Every timed call reports "bench_ns: <nanoseconds>" on stderr, followed by
+// "bench_peak_rss_kb: <KiB>" at the end where /proc is available (getrusage
+// would include the memory of the process that forked the benchmark).
+#undef main
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+int transpyler_bench_main(int argc, char *argv[]);
+
+namespace {
+
+  long envOr(const char *name, long fallback) {
+    const char *value = std::getenv(name);
+    return value != nullptr && *value != '\0' ? std::atol(value) : fallback;
+  }
+
+  // Peak resident set size in KiB, -1 without /proc
+  long peakRssKb() {
+    std::FILE *status = std::fopen("/proc/self/status", "r");
+    if (status == nullptr) return -1;
+    char line[256];
+    long kb = -1;
+    while (std::fgets(line, sizeof line, status) != nullptr) {
+      if (std::sscanf(line, "VmHWM: %ld kB", &kb) == 1) break;
+    }
+    std::fclose(status);
+    return kb;
+  }
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+  using Clock = std::chrono::steady_clock;
+  if (std::getenv("TRANSPYLER_BENCH_REPEAT") == nullptr) return transpyler_bench_main(argc, argv);
+
+  long warmups = envOr("TRANSPYLER_BENCH_WARMUP", 0);
+  long repeats = envOr("TRANSPYLER_BENCH_REPEAT", 1);
+  if (repeats < 1) repeats = 1;
+  double budget = static_cast<double>(envOr("TRANSPYLER_BENCH_BUDGET_MS", 0)) * 1e6;
+
+  double spent = 0;
+  for (long i = 0; i < warmups && (budget <= 0 || spent < budget); ++i) {
+    Clock::time_point start = Clock::now();
+    int status = transpyler_bench_main(argc, argv);
+    spent += std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    if (status != 0) return status;
+  }
+
+  // At least one timed call, even when the warmups used up the budget
+  spent = 0;
+  for (long i = 0; i < repeats; ++i) {
+    Clock::time_point start = Clock::now();
+    int status = transpyler_bench_main(argc, argv);
+    double elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    if (status != 0) return status;
+    std::fprintf(stderr, "bench_ns: %.0f\n", elapsed);
+    spent += elapsed;
+    if (budget > 0 && spent >= budget) break;
+  }
+  long rss = peakRssKb();
+  if (rss >= 0) std::fprintf(stderr, "bench_peak_rss_kb: %ld\n", rss);
+  return 0;
+}
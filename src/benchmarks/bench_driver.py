@@ -0,0 +1,94 @@
+"""
+Benchmark Driver Module
+Runs a Python benchmark script several times inside one interpreter and
+reports the time of each run, the Python counterpart of bench_driver.cpp:
+
+    python bench_driver.py script.py <args...>
+
+The script is compiled once and executed in a fresh module namespace per
+run, so interpreter startup and imports are paid only once. The
+TRANSPYLER_BENCH_WARMUP, TRANSPYLER_BENCH_REPEAT and
+TRANSPYLER_BENCH_BUDGET_MS environment variables have the same meaning as for
+the C++ driver, and every timed run reports "bench_ns: <nanoseconds>" on
+stderr, followed by "bench_peak_rss_kb: <KiB>" where /proc is available.
+"""
+
+import os
+import sys
+import time
+
+
+def _env_int(name, default):
+    value = os.environ.get(name, "")
+    return int(value) if value else default
+
+
+def _peak_rss_kb():
+    """VmHWM of this process in KiB, or None without /proc"""
+    try:
+        with open("/proc/self/status", "r", encoding="ascii") as status:
+            for line in status:
+                if line.startswith("VmHWM:"):
+                    return int(line.split()[1])
+    except OSError:
+        pass
+    return None
+
+
+def _run_once(code, script):
+    """Execute the compiled script as __main__; returns its exit status"""
+    namespace = {"__name__": "__main__", "__file__": script, "__builtins__": __builtins__}
+    try:
+        exec(code, namespace)
+    except SystemExit as e:
+        if e.code is None:
+            return 0
+        return e.code if isinstance(e.code, int) else 1
+    return 0
+
+
+def main(argv):
+    if len(argv) < 2:
+        print(f"Usage: python {argv[0]} <script.py> [args...]", file=sys.stderr)
+        return 2
+
+    script = argv[1]
+    with open(script, "r", encoding="utf-8") as f:
+        code = compile(f.read(), script, "exec")
+    sys.argv = argv[1:]
+
+    warmups = _env_int("TRANSPYLER_BENCH_WARMUP", 0)
+    repeats = _env_int("TRANSPYLER_BENCH_REPEAT", 1)
+    budget_ns = _env_int("TRANSPYLER_BENCH_BUDGET_MS", 0) * 1_000_000
+
+    spent = 0
+    for _ in range(warmups):
+        if budget_ns > 0 and spent >= budget_ns:
+            break
+        start = time.perf_counter_ns()
+        status = _run_once(code, script)
+        spent += time.perf_counter_ns() - start
+        if status != 0:
+            return status
+
+    # At least one timed run, even when the warmups used up the budget
+    spent = 0
+    for _ in range(max(1, repeats)):
+        start = time.perf_counter_ns()
+        status = _run_once(code, script)
+        elapsed = time.perf_counter_ns() - start
+        if status != 0:
+            return status
+        print(f"bench_ns: {elapsed}", file=sys.stderr)
+        spent += elapsed
+        if budget_ns > 0 and spent >= budget_ns:
+            break
+
+    rss = _peak_rss_kb()
+    if rss is not None:
+        print(f"bench_peak_rss_kb: {rss}", file=sys.stderr)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
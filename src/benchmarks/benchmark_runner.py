@@ -24,10 +24,12 @@ from src.benchmarks.performance_tester import (
     verify_program_outputs,
 )
 from src.benchmarks.utilities import cleanup_generated_files
-from src.benchmarks.config import PATHS, set_benchmark_suffix
+from src.benchmarks.baseline_gate import save_baselines, check_regressions
+from src.benchmarks.config import PATHS, COMPILE_SETTINGS, set_benchmark_suffix
 
 
-def run_benchmark(max_values=None, generate_charts=True, custom_values=None, suffix=""):
+def run_benchmark(max_values=None, generate_charts=True, custom_values=None, suffix="",
+                  save_baseline=False, check_baseline=False, threshold=None):
     """
     Run complete benchmark with modular architecture:
     1. GENERATE all transpiled files
@@ -39,6 +41,9 @@ def run_benchmark(max_values=None, generate_charts=True, custom_values=None, suf
     generate_charts: If True, generates visual charts and HTML report
     custom_values: Dictionary with custom limits for each algorithm
     suffix: Suffix to add to output files (e.g., 'py310' for Python 3.10)
+    save_baseline: If True, stores the results as the new baselines
+    check_baseline: If True, fails when results regressed against the baselines
+    threshold: Allowed relative slowdown for check_baseline (default from config)
     """
     print("TransPYler Benchmark Runner")
     print("=" * 50)
@@ -64,6 +69,13 @@ def run_benchmark(max_values=None, generate_charts=True, custom_values=None, suf
         # Phase 3: Generate performance summary
         generate_performance_summary(PATHS["results"])
 
+        # Phase 3.5: Gate against and/or update the saved baselines
+        regressions = []
+        if check_baseline:
+            regressions = check_regressions(threshold=threshold)
+        if save_baseline:
+            save_baselines()
+
         # Phase 4: Generate visualizations and tables
         if generate_charts:
             print("\nPhase 4: Generating charts and tables")
@@ -83,6 +95,10 @@ def run_benchmark(max_values=None, generate_charts=True, custom_values=None, suf
         # Files are always preserved for debugging
         print("\nPreserving generated files for debugging")
 
+        if regressions:
+            print("\nBenchmark completed with performance regressions")
+            return False
+
         print("\nBenchmark completed successfully")
 
     except Exception as e:
@@ -115,8 +131,42 @@ if __name__ == "__main__":
         help="Suffix to add to output files (e.g., 'py310' for Python 3.10 results)",
     )
 
+    parser.add_argument(
+        "--save-baseline",
+        action="store_true",
+        help="Store the results in benchmark_results/baselines for later --check-baseline runs",
+    )
+    parser.add_argument(
+        "--check-baseline",
+        action="store_true",
+        help="Exit with status 1 when the transpiled C++ got slower than the saved baselines",
+    )
+    parser.add_argument(
+        "--threshold",
+        type=float,
+        default=None,
+        help="Allowed slowdown for --check-baseline as a fraction (default 0.10)",
+    )
+    parser.add_argument(
+        "--no-cache",
+        action="store_true",
+        help="Transpile and compile every program again instead of reusing the build cache",
+    )
+    parser.add_argument(
+        "--jobs",
+        "-j",
+        type=int,
+        default=None,
+        help="Parallel compilations (default: one per core)",
+    )
+
     args = parser.parse_args()
 
+    if args.no_cache:
+        COMPILE_SETTINGS["use_cache"] = False
+    if args.jobs:
+        COMPILE_SETTINGS["jobs"] = args.jobs
+
     # Parse limits if provided
     custom_values = None
     if args.limits:
@@ -129,8 +179,12 @@ if __name__ == "__main__":
     else:
         print("Using default algorithm ranges")
 
-    run_benchmark(
+    success = run_benchmark(
         generate_charts=not args.no_charts,
         custom_values=custom_values,
         suffix=args.suffix,
+        save_baseline=args.save_baseline,
+        check_baseline=args.check_baseline,
+        threshold=args.threshold,
     )
+    sys.exit(0 if success else 1)
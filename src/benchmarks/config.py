@@ -35,23 +35,49 @@ PATHS = {
     'cpp_manual': Path(__file__).parent / "cpp_manual",
     'transpiled_output': Path(__file__).parent / "transpiled_output",
     'results': Path("benchmark_results"),
+    'baselines': Path("benchmark_results") / "baselines",
     'project_root': Path(__file__).parent.parent.parent
 }
 
 # Compilation settings
 COMPILE_SETTINGS = {
-    'cpp_flags': ["-std=c++17", "-O2"],
+    'cpp_flags': ["-std=c++20", "-O2"],
     'runtime_includes': [
         "src/runtime/cpp",
         "src/runtime/cpp/DynamicType.cpp",
+        "src/runtime/cpp/BigInt.cpp",
         "src/runtime/cpp/builtins.cpp"
-    ]
+    ],
+    # Reuse the C++, objects and executables of unchanged programs (see src/compiler/build_cache.py)
+    'use_cache': True,
+    # Parallel compilations (None: one per core)
+    'jobs': None,
+}
+
+# In-process timing drivers, see bench_driver.cpp / bench_driver.py
+BENCH_DRIVERS = {
+    'cpp': Path(__file__).parent / "bench_driver.cpp",
+    'python': Path(__file__).parent / "bench_driver.py",
+    'cpp_flags': ["-Dmain=transpyler_bench_main"]
 }
 
 # Performance test settings
 PERFORMANCE_SETTINGS = {
-    'measurement_rounds': 3,  # Number of measurements per test
-    'timeout_seconds': 30     # Timeout for individual tests
+    'measurement_rounds': 3,     # Processes started per test
+    'warmup_runs': 1,            # Untimed in-process runs before measuring
+    'inner_repetitions': 10,     # Maximum timed in-process runs per process
+    'inner_budget_ms': 200,      # Stop repeating once a process spent this long
+    'timeout_seconds': 30,       # Timeout for individual tests
+    'pin_cpu': True,             # Run every measurement on the same core
+    'collect_counters': True,    # perf stat counters, when perf is installed
+    'perf_events': ["instructions", "cache-misses", "branch-misses"]
+}
+
+# Regression gate settings (benchmark_runner --check-baseline)
+REGRESSION_SETTINGS = {
+    'gated_implementations': ["cpp_transpiled"],  # Python and manual C++ are references
+    'threshold': 0.10,       # Allowed slowdown of the median
+    'min_delta_ms': 0.05     # Ignore differences below timer/scheduler noise
 }
 
 # Benchmark suffix (can be set dynamically for version-specific runs)
@@ -3,45 +3,132 @@ Performance Testing Module
 Handles execution and measurement of benchmark tests
 """
 
+import os
+import re
 import sys
+import math
 import time
+import shutil
+import statistics
 import subprocess
 import csv
 from pathlib import Path # TODO(any): Is this needed? (is not used in the code)
 
-from src.benchmarks.config import PATHS, PERFORMANCE_SETTINGS, get_benchmark_suffix
+from src.benchmarks.config import PATHS, PERFORMANCE_SETTINGS, BENCH_DRIVERS, get_benchmark_suffix
+
+# Timings reported by bench_driver.cpp / bench_driver.py, one line per run
+BENCH_NS_PATTERN = re.compile(r"^bench_ns:\s*(\d+)", re.MULTILINE)
+PEAK_RSS_PATTERN = re.compile(r"^bench_peak_rss_kb:\s*(\d+)", re.MULTILINE)
+
+# Implementations measured per n, as used in the CSV column names
+IMPLEMENTATIONS = ["python", "cpp_transpiled", "cpp_manual"]
+
+
+def benchmark_cpu():
+    """Core every measurement is pinned to (None when pinning is off or unsupported)"""
+    if not PERFORMANCE_SETTINGS["pin_cpu"] or not hasattr(os, "sched_getaffinity"):
+        return None
+    # The last allowed core is the least likely to also serve interrupts
+    return max(os.sched_getaffinity(0))
+
+
+def run_measured_process(cmd, env=None):
+    """Run cmd to completion on the benchmark core"""
+    cpu = benchmark_cpu()
+    preexec = (lambda: os.sched_setaffinity(0, {cpu})) if cpu is not None else None
+    return subprocess.run(
+        cmd, capture_output=True, text=True, check=False, env=env, preexec_fn=preexec
+    )
+
+
+def benchmark_command(executable_or_script, n_value, is_python=False):
+    """Command line running one benchmark program under its in-process timing driver"""
+    if is_python:
+        return [sys.executable, str(BENCH_DRIVERS["python"]), str(executable_or_script), str(n_value)]
+    return [str(executable_or_script), str(n_value)]
+
+
+def summarize_samples(samples):
+    """Median, 95th percentile and a 95% confidence interval of the median (all in ms)"""
+    ordered = sorted(samples)
+    count = len(ordered)
+    # Distribution-free interval: the order statistics around rank n/2 that
+    # bracket the median with 95% probability (normal approximation of the binomial)
+    half_width = 1.96 * math.sqrt(count) / 2
+    low = max(0, math.floor(count / 2 - half_width) - 1)
+    high = min(count - 1, math.ceil(1 + count / 2 + half_width) - 1)
+    return {
+        "samples": count,
+        "median_ms": statistics.median(ordered),
+        "p95_ms": ordered[max(0, math.ceil(0.95 * count) - 1)],
+        "ci_low_ms": ordered[low],
+        "ci_high_ms": ordered[high],
+    }
+
+
+def collect_perf_counters(cmd):
+    """Hardware counters of one plain run of cmd via `perf stat`, or {} without perf"""
+    if not PERFORMANCE_SETTINGS["collect_counters"] or shutil.which("perf") is None:
+        return {}
+    events = PERFORMANCE_SETTINGS["perf_events"]
+    perf_cmd = ["perf", "stat", "-x", ",", "-e", ",".join(events), "--", *cmd]
+    result = run_measured_process(perf_cmd)
+
+    counters = {}
+    # CSV lines: value,unit,event,... ; value is "<not supported>" on some machines
+    for line in result.stderr.splitlines():
+        fields = line.split(",")
+        if len(fields) < 3:
+            continue
+        event = fields[2].split(":")[0]
+        if event in events and fields[0].strip().isdigit():
+            counters[event] = int(fields[0])
+    return counters
 
 
 def measure_execution_time(executable_or_script, n_value, is_python=False, rounds=None):
-    """Measure execution time for a given executable or Python script with n_value argument"""
+    """
+    Measure a benchmark program with n_value argument.
+
+    Every round starts one process pinned to the benchmark core, whose timing
+    driver does the warmup runs and then times up to inner_repetitions runs of
+    the program in-process, so process start, dynamic linking and interpreter
+    startup stay out of the samples. Returns (stats, result of the first round)
+    where stats holds summarize_samples() of all samples plus peak_rss_kb and
+    the perf counters of one extra plain run.
+    """
     if rounds is None:
         rounds = PERFORMANCE_SETTINGS["measurement_rounds"]
 
-    times = []
+    cmd = benchmark_command(executable_or_script, n_value, is_python)
+    env = dict(
+        os.environ,
+        TRANSPYLER_BENCH_WARMUP=str(PERFORMANCE_SETTINGS["warmup_runs"]),
+        TRANSPYLER_BENCH_REPEAT=str(PERFORMANCE_SETTINGS["inner_repetitions"]),
+        TRANSPYLER_BENCH_BUDGET_MS=str(PERFORMANCE_SETTINGS["inner_budget_ms"]),
+    )
+
+    samples = []
+    first_result = None
+    peak_rss_kb = None
 
     for _ in range(rounds):
         start_time = time.perf_counter()
+        result = run_measured_process(cmd, env)
+        wall_ms = (time.perf_counter() - start_time) * 1000
 
-        if is_python:
-            result = subprocess.run(
-                [sys.executable, str(executable_or_script), str(n_value)],
-                capture_output=True,
-                text=True,
-                check=False,
-            )
-        else:
-            result = subprocess.run(
-                [str(executable_or_script), str(n_value)],
-                capture_output=True,
-                text=True,
-                check=False,
-            )
-
-        end_time = time.perf_counter()
-        times.append((end_time - start_time) * 1000)  # Convert to milliseconds
+        reported = [int(ns) / 1e6 for ns in BENCH_NS_PATTERN.findall(result.stderr)]
+        # Executables built without the driver only give the process wall time
+        samples.extend(reported if reported else [wall_ms])
+        for rss in PEAK_RSS_PATTERN.findall(result.stderr):
+            peak_rss_kb = max(peak_rss_kb or 0, int(rss))
+        if first_result is None:
+            first_result = result
 
-    average_time = sum(times) / len(times)
-    return average_time, result
+    stats = summarize_samples(samples)
+    stats["peak_rss_kb"] = peak_rss_kb
+    stats["counters"] = collect_perf_counters(cmd)
+    return stats, first_result
 
 
 def extract_result_from_output(output_text):
@@ -138,11 +225,55 @@ def verify_program_outputs(generated_files, test_value=10):
         print()
 
 
+def csv_fieldnames():
+    """CSV columns: the summary columns the charts and tables read, then the detailed statistics"""
+    fieldnames = [
+        "n",
+        "result",
+        "python_ms",
+        "cpp_transpiled_ms",
+        "cpp_manual_ms",
+        "speedup_transpiled",
+        "speedup_manual",
+    ]
+    for implementation in IMPLEMENTATIONS:
+        fieldnames += [
+            f"{implementation}_p95_ms",
+            f"{implementation}_ci_low_ms",
+            f"{implementation}_ci_high_ms",
+            f"{implementation}_samples",
+            f"{implementation}_peak_rss_kb",
+        ]
+        fieldnames += [
+            f"{implementation}_{event.replace('-', '_')}"
+            for event in PERFORMANCE_SETTINGS["perf_events"]
+        ]
+    return fieldnames
+
+
+def stats_csv_columns(implementation, stats):
+    """Detailed CSV columns of one implementation (empty when it was not measured)"""
+    columns = {}
+    for key in ["p95_ms", "ci_low_ms", "ci_high_ms"]:
+        columns[f"{implementation}_{key}"] = round(stats[key], 6) if stats else None
+    columns[f"{implementation}_samples"] = stats["samples"] if stats else None
+    columns[f"{implementation}_peak_rss_kb"] = stats["peak_rss_kb"] if stats else None
+    for event in PERFORMANCE_SETTINGS["perf_events"]:
+        value = stats["counters"].get(event) if stats else None
+        columns[f"{implementation}_{event.replace('-', '_')}"] = value
+    return columns
+
+
 def run_performance_tests(generated_files):
     """Phase 2: Execute performance tests with command line arguments"""
     print("\nPhase 2: Running performance tests")
     print("-" * 40)
 
+    cpu = benchmark_cpu()
+    print(f"Pinned to CPU {cpu}" if cpu is not None else "CPU pinning not available")
+    if PERFORMANCE_SETTINGS["collect_counters"] and shutil.which("perf") is None:
+        print("perf not found: hardware counters are not collected")
+
     # Create results directory
     results_dir = PATHS["results"]
     results_dir.mkdir(exist_ok=True)
@@ -156,16 +287,17 @@ def run_performance_tests(generated_files):
         # Prepare CSV data
         csv_data = []
 
-        # Header for console output
+        # Header for console output (medians of the in-process samples)
         print(
-            f"\n{'N':<6} {'Result':<12} {'Python(ms)':<12} {'C++Trans(ms)':<14} {'C++Manual(ms)':<14} {'Speedup':<10}"
+            f"\n{'N':<6} {'Result':<12} {'Python(ms)':<12} {'C++Trans(ms)':<14} {'Trans 95% CI':<20} {'C++Manual(ms)':<14} {'Speedup':<10}"
         )
-        print("-" * 80)
+        print("-" * 100)
 
         for n in n_values:
             # 1. Measure Python Original (with command line argument)
             py_file = files["python_original"]
-            tiempo_py, py_result = measure_execution_time(py_file, n, is_python=True)
+            py_stats, py_result = measure_execution_time(py_file, n, is_python=True)
+            tiempo_py = py_stats["median_ms"]
 
             # Get result from Python output
             resultado = extract_result_from_output(
@@ -174,18 +306,16 @@ def run_performance_tests(generated_files):
 
             # 2. Measure C++ Transpiled (with command line argument)
             transpiled_exe = files["executable_transpiled"]
-            # TODO(any): trans_result is not used, is it needed?
-            tiempo_trans, trans_result = measure_execution_time(
-                transpiled_exe, n, is_python=False
-            )
+            trans_stats, _ = measure_execution_time(transpiled_exe, n, is_python=False)
+            tiempo_trans = trans_stats["median_ms"]
 
             # 3. Measure C++ Manual (with command line argument) - if available
+            manual_stats = None
             tiempo_manual = None
             manual_exe = files["executable_manual"]
             if manual_exe:
-                tiempo_manual, _ = measure_execution_time(
-                    manual_exe, n, is_python=False
-                )
+                manual_stats, _ = measure_execution_time(manual_exe, n, is_python=False)
+                tiempo_manual = manual_stats["median_ms"]
 
             # Calculate speedup
             speedup_trans = tiempo_py / tiempo_trans if tiempo_trans > 0 else 0
@@ -194,45 +324,39 @@ def run_performance_tests(generated_files):
             )
 
             # Print result immediately (n by n)
+            trans_ci = f"{trans_stats['ci_low_ms']:.3f}-{trans_stats['ci_high_ms']:.3f}"
             if tiempo_manual:
                 print(
-                    f"{n:<6} {resultado:<12} {tiempo_py:<12.3f} {tiempo_trans:<14.3f} {tiempo_manual:<14.3f} {speedup_manual:<10.2f}x"
+                    f"{n:<6} {resultado:<12} {tiempo_py:<12.3f} {tiempo_trans:<14.3f} {trans_ci:<20} {tiempo_manual:<14.3f} {speedup_manual:<10.2f}x"
                 )
             else:
                 print(
-                    f"{n:<6} {resultado:<12} {tiempo_py:<12.3f} {tiempo_trans:<14.3f} {'N/A':<14} {speedup_trans:<10.2f}x"
+                    f"{n:<6} {resultado:<12} {tiempo_py:<12.3f} {tiempo_trans:<14.3f} {trans_ci:<20} {'N/A':<14} {speedup_trans:<10.2f}x"
                 )
 
             # Store data for CSV
-            csv_data.append(
-                {
-                    "n": n,
-                    "result": resultado,
-                    "python_ms": round(tiempo_py, 3),
-                    "cpp_transpiled_ms": round(tiempo_trans, 3),
-                    "cpp_manual_ms": round(tiempo_manual, 3) if tiempo_manual else None,
-                    "speedup_transpiled": round(speedup_trans, 2),
-                    "speedup_manual": (
-                        round(speedup_manual, 2) if speedup_manual else None
-                    ),
-                }
-            )
+            row = {
+                "n": n,
+                "result": resultado,
+                "python_ms": round(tiempo_py, 6),
+                "cpp_transpiled_ms": round(tiempo_trans, 6),
+                "cpp_manual_ms": round(tiempo_manual, 6) if tiempo_manual else None,
+                "speedup_transpiled": round(speedup_trans, 2),
+                "speedup_manual": (
+                    round(speedup_manual, 2) if speedup_manual else None
+                ),
+            }
+            row.update(stats_csv_columns("python", py_stats))
+            row.update(stats_csv_columns("cpp_transpiled", trans_stats))
+            row.update(stats_csv_columns("cpp_manual", manual_stats))
+            csv_data.append(row)
 
         # Write CSV file for this algorithm
         if csv_data:
             suffix = get_benchmark_suffix()
             csv_file = results_dir / f"{algorithm_name}_results{suffix}.csv"
             with open(csv_file, "w", newline="", encoding="utf-8") as f:
-                fieldnames = [
-                    "n",
-                    "result",
-                    "python_ms",
-                    "cpp_transpiled_ms",
-                    "cpp_manual_ms",
-                    "speedup_transpiled",
-                    "speedup_manual",
-                ]
-                writer = csv.DictWriter(f, fieldnames=fieldnames)
+                writer = csv.DictWriter(f, fieldnames=csv_fieldnames())
                 writer.writeheader()
                 writer.writerows(csv_data)
             print(f"Results saved to: {csv_file}")
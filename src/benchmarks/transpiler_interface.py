@@ -3,14 +3,18 @@ Transpiler Interface Module
 Handles transpilation and compilation of Python files to C++ executables
 """
 
+import os
 import sys
 import subprocess
 import shutil
+import time
+from concurrent.futures import ThreadPoolExecutor
 
 # TODO(any): Path and get_manual_cpp_file_path imports might be redundant
 from pathlib import Path
 
-from src.benchmarks.config import PATHS, COMPILE_SETTINGS, get_manual_cpp_file_path
+from src.compiler.build_cache import BuildCache
+from src.benchmarks.config import PATHS, COMPILE_SETTINGS, BENCH_DRIVERS, get_manual_cpp_file_path
 from src.benchmarks.file_generator import (
     copy_python_original,
     copy_cpp_manual,
@@ -33,6 +37,8 @@ def transpile_file(py_file, output_cpp_file):
         "-o",
         str(output_cpp_file),
     ]
+    if not COMPILE_SETTINGS["use_cache"]:
+        cmd.append("--no-cache")
     result = subprocess.run(
         cmd, capture_output=True, cwd=PATHS["project_root"], check=False
     )
@@ -40,31 +46,36 @@ def transpile_file(py_file, output_cpp_file):
 
 
 def compile_cpp_transpiled(cpp_file, executable_path):
-    """Compile transpiled C++ file with runtime dependencies"""
-    compile_cmd = [
-        "g++",
+    """Compile transpiled C++ file with runtime dependencies and the timing driver"""
+    flags = [
         *COMPILE_SETTINGS["cpp_flags"],
         "-I",
         str(PATHS["project_root"] / COMPILE_SETTINGS["runtime_includes"][0]),
+        *BENCH_DRIVERS["cpp_flags"],
+    ]
+    sources = [
         str(cpp_file),
         str(PATHS["project_root"] / COMPILE_SETTINGS["runtime_includes"][1]),
         str(PATHS["project_root"] / COMPILE_SETTINGS["runtime_includes"][2]),
-        "-o",
-        str(executable_path),
+        str(PATHS["project_root"] / COMPILE_SETTINGS["runtime_includes"][3]),
+        str(BENCH_DRIVERS["cpp"]),
     ]
+    if COMPILE_SETTINGS["use_cache"]:
+        return BuildCache().compile("g++", flags, sources, str(executable_path), cwd=PATHS["project_root"])
+
+    compile_cmd = ["g++", *flags, *sources, "-o", str(executable_path)]
     result = subprocess.run(compile_cmd, capture_output=True, cwd=PATHS["project_root"], check=False)
     return result
 
 
 def compile_cpp_manual(cpp_file, executable_path):
-    """Compile manual C++ file (standalone)"""
-    compile_cmd = [
-        "g++",
-        *COMPILE_SETTINGS["cpp_flags"],
-        str(cpp_file),
-        "-o",
-        str(executable_path),
-    ]
+    """Compile manual C++ file (standalone apart from the timing driver)"""
+    flags = [*COMPILE_SETTINGS["cpp_flags"], *BENCH_DRIVERS["cpp_flags"]]
+    sources = [str(cpp_file), str(BENCH_DRIVERS["cpp"])]
+    if COMPILE_SETTINGS["use_cache"]:
+        return BuildCache().compile("g++", flags, sources, str(executable_path), cwd=PATHS["project_root"])
+
+    compile_cmd = ["g++", *flags, *sources, "-o", str(executable_path)]
     result = subprocess.run(compile_cmd, capture_output=True, cwd=PATHS["project_root"], check=False)
     return result
 
@@ -84,7 +95,7 @@ def generate_all_transpiled_files(fast_mode=False, max_values=None, custom_value
     # Find Python files
     python_files = list(PATHS["python_original"].glob("*.py"))
 
-    generated_files = {}
+    prepared = {}
 
     for py_file in python_files:
         print(f"Processing: {py_file.name}")
@@ -137,46 +148,89 @@ def generate_all_transpiled_files(fast_mode=False, max_values=None, custom_value
         )
         print(f"  ✓ Transpiled: {final_transpiled_cpp.name}")
 
-        # Compile transpiled C++
-        transpiled_exe = algo_dir / f"{algorithm_clean}_executable_transpiled"
-        compile_result = compile_cpp_transpiled(final_transpiled_cpp, transpiled_exe)
-
-        if compile_result.returncode != 0:
-            print(
-                f"  ✗ Transpiled compilation failed: {compile_result.stderr.decode()}"
-            )
-            continue
-        print(f"  ✓ Transpiled executable: {transpiled_exe.name}")
-
-        # Copy and compile manual C++ if available
-        manual_exe = None
+        # Copy the manual C++ if available; everything is compiled below
+        manual_cpp_copy = None
         if manual_exists:
             manual_cpp_copy = copy_cpp_manual(algorithm_name, algo_dir)
             if manual_cpp_copy:
                 print(f"  ✓ Manual C++: {manual_cpp_copy.name}")
 
-                # Compile manual C++
-                manual_exe = algo_dir / f"{algorithm_clean}_executable_manual"
-                manual_result = compile_cpp_manual(manual_cpp_copy, manual_exe)
-
-                if manual_result.returncode == 0:
-                    print(f"  ✓ Manual executable: {manual_exe.name}")
-                else:
-                    print(
-                        f"  ✗ Manual compilation failed: {manual_result.stderr.decode()}"
-                    )
-                    manual_exe = None
-
-        # Store file references
-        generated_files[algorithm_name] = {
+        prepared[algorithm_name] = {
             "n_values": n_values,
             "python_original": python_copy,
             "cpp_transpiled": final_transpiled_cpp,
-            "executable_transpiled": transpiled_exe,
-            "executable_manual": manual_exe,
+            "executable_transpiled": algo_dir / f"{algorithm_clean}_executable_transpiled",
+            "cpp_manual": manual_cpp_copy,
+            "executable_manual": algo_dir / f"{algorithm_clean}_executable_manual" if manual_cpp_copy else None,
         }
 
-        print("  ✓ Algorithm ready for testing")
-
+    generated_files = compile_all(prepared)
     print(f"\nPhase 1 complete: {len(generated_files)} algorithms processed")
     return generated_files
+
+
+def compile_all(prepared):
+    """
+    Compile the transpiled and manual programs of every algorithm in parallel.
+
+    The jobs share the runtime objects, which are compiled first when the
+    build cache is enabled. Returns the algorithms whose transpiled program
+    compiled; a manual program that fails to compile is left out (None).
+    """
+    jobs = []
+    for algorithm_name, files in prepared.items():
+        jobs.append((algorithm_name, "Transpiled", compile_cpp_transpiled, files["cpp_transpiled"],
+                     files["executable_transpiled"]))
+        if files["cpp_manual"]:
+            jobs.append((algorithm_name, "Manual", compile_cpp_manual, files["cpp_manual"], files["executable_manual"]))
+
+    workers = COMPILE_SETTINGS["jobs"] or os.cpu_count() or 1
+    print(f"\nCompiling {len(jobs)} programs (parallel jobs: {workers})")
+
+    def run(job):
+        start = time.perf_counter()
+        result = job[2](job[3], job[4])
+        return result, (time.perf_counter() - start) * 1000
+
+    with ThreadPoolExecutor(max_workers=workers) as pool:
+        if COMPILE_SETTINGS["use_cache"]:
+            warm_runtime_objects(pool)
+        outcomes = list(pool.map(run, jobs))
+
+    failed = set()
+    for (algorithm_name, kind, _, _, executable), (result, elapsed_ms) in zip(jobs, outcomes):
+        if result.returncode == 0:
+            print(f"  ✓ {kind} executable: {executable.name} ({elapsed_ms:.0f} ms)")
+        else:
+            print(f"  ✗ {kind} compilation failed for {algorithm_name}: {result.stderr.decode()}")
+            failed.add((algorithm_name, kind))
+
+    generated_files = {}
+    for algorithm_name, files in prepared.items():
+        if (algorithm_name, "Transpiled") in failed:
+            continue
+        manual_exe = files["executable_manual"]
+        if (algorithm_name, "Manual") in failed:
+            manual_exe = None
+        generated_files[algorithm_name] = {
+            "n_values": files["n_values"],
+            "python_original": files["python_original"],
+            "cpp_transpiled": files["cpp_transpiled"],
+            "executable_transpiled": files["executable_transpiled"],
+            "executable_manual": manual_exe,
+        }
+        print(f"  ✓ {algorithm_name} ready for testing")
+    return generated_files
+
+
+def warm_runtime_objects(pool):
+    """Compile the runtime objects once before the programs that link them"""
+    cache = BuildCache()
+    flags = [
+        *COMPILE_SETTINGS["cpp_flags"],
+        "-I",
+        str(PATHS["project_root"] / COMPILE_SETTINGS["runtime_includes"][0]),
+        *BENCH_DRIVERS["cpp_flags"],
+    ]
+    sources = [str(PATHS["project_root"] / source) for source in COMPILE_SETTINGS["runtime_includes"][1:]]
+    list(pool.map(lambda source: cache.compile_object("g++", flags, source, cwd=PATHS["project_root"]), sources))
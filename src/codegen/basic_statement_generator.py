@@ -7,7 +7,7 @@ statements including assignments, expression statements, and return statements.
 Key Features:
 - Handles simple and augmented assignment statements (x = value, x += value, etc.)
 - Generates C++ code with automatic variable declaration on first assignment
-- Supports return statements with optional values
+- Supports return statements with optional values, and yield in generator functions
 - Integrates with ExprGenerator for expression code generation
 - Maintains scope information for variable tracking
 - Uses DynamicType for dynamic typing in C++
@@ -20,7 +20,8 @@ Architecture:
 
 Restrictions:
 - Assignment targets support simple identifiers and subscripts (arr[i] = value)
-- Variables are declared as DynamicType on first assignment
+- Variables are declared as DynamicType on first assignment, or with the
+  native type TypeInference chose for them (long long, double, bool)
 
 Usage:
     from src.codegen.basic_statement_generator import BasicStatementGenerator
@@ -33,8 +34,9 @@ Usage:
 
 """
 
-from src.core import AstNode, Assign, ExprStmt, Return, Identifier, Subscript
+from src.core import AstNode, Assign, BinaryExpr, ExprStmt, Return, Identifier, Subscript, Yield
 from .expr_generator import ExprGenerator
+from .type_inference import iter_nodes, string_append_operands
 from .scope_manager import ScopeManager
 
 
@@ -80,6 +82,9 @@ class BasicStatementGenerator:
         Returns:
             str: C++ assignment code.
         """
+        if isinstance(node.target, Identifier) and self.scope.native_type(node.target.name):
+            return self._visit_native_assign(node)
+
         rhs_code = self.expr.visit(node.value)
 
         if isinstance(node.target, Identifier):
@@ -93,7 +98,7 @@ class BasicStatementGenerator:
                     self.scope.declare(name)
                     return f"DynamicType {name} = {rhs_code};"
                 # Reassign existing variable
-                return f"{name} = {rhs_code};"
+                return f"{name} = {self._self_concat(name, node.value) or rhs_code};"
 
             # Augmented assignment: x += value, x -= value, etc.
             # Ensure variable exists
@@ -127,17 +132,27 @@ class BasicStatementGenerator:
             if base_op == "**":
                 # x **= y  ->  x = x.pow(y)
                 return f"{name} = ({name}).pow({rhs_code});"
-            # Standard operators: x += y  ->  x = x + y
+            if base_op == "+" and id(node) in self.scope.tuple_concatenations:
+                # Tuples are immutable: rebind t, so a `u = t` alias keeps the old value
+                return f"{name} = ({name}) + ({rhs_code});"
+            if base_op == "+":
+                # In place: lists are extended (aliases see it, as in Python), strings appended
+                operands = string_append_operands(name, node.value)
+                if operands:
+                    # s += "a" + b: append each piece instead of building the sum first
+                    return " ".join(f"{name} += ({self.expr.visit(operand)});" for operand in operands)
+                return f"{name} += ({rhs_code});"
+            # Standard operators: x -= y  ->  x = x - y
             return f"{name} = ({name}) {base_op} ({rhs_code});"
 
         # Handle subscript assignment (e.g., arr[i] = value)
         elif isinstance(node.target, Subscript):
-            lhs_code = self.expr.visit(node.target)
+            obj_code, index_code = self.expr.visit_subscript_target(node.target)
             op = node.op
 
             if op == "=":
                 # Simple subscript assignment: arr[i] = value
-                return f"{lhs_code} = {rhs_code};"
+                return f"({obj_code}).setItem({index_code}, {rhs_code});"
             else:
                 # Augmented subscript assignment: arr[i] += value
                 augmented_ops = {
@@ -156,14 +171,19 @@ class BasicStatementGenerator:
                     )
 
                 base_op = augmented_ops[op]
+                if base_op == "+":
+                    # In place, like x += y
+                    return f"({obj_code}).addToItem({index_code}, {rhs_code});"
 
+                current = f"({obj_code}).getItem({index_code})"
                 # Special handling for floor division and power
                 if base_op == "//":
-                    return f"{lhs_code} = ({lhs_code}).floor_div({rhs_code});"
+                    updated = f"({current}).floor_div({rhs_code})"
                 elif base_op == "**":
-                    return f"{lhs_code} = ({lhs_code}).pow({rhs_code});"
+                    updated = f"({current}).pow({rhs_code})"
                 else:
-                    return f"{lhs_code} = ({lhs_code}) {base_op} ({rhs_code});"
+                    updated = f"{current} {base_op} ({rhs_code})"
+                return f"({obj_code}).setItem({index_code}, {updated});"
 
         # Invalid assignment target
         else:
@@ -171,6 +191,49 @@ class BasicStatementGenerator:
                 f"Assignment to {type(node.target).__name__} is not supported"
             )
 
+    def _self_concat(self, name: str, value: AstNode):
+        """
+        `x = x + a + b` with x last used as the left operand: move x into the
+        sum so a uniquely owned list or string is extended in place. Returns
+        None when the value has another shape or a later operand reads x
+        (`x = x + a + x` must see x before the move).
+        """
+        operands = []
+        left = value
+        while isinstance(left, BinaryExpr) and left.op == "+":
+            operands.insert(0, left.right)
+            left = left.left
+        if not operands or not (isinstance(left, Identifier) and left.name == name):
+            return None
+        if any(isinstance(n, Identifier) and n.name == name for n in iter_nodes(operands)):
+            return None
+        code = f"std::move({name})"
+        for operand in operands:
+            code = f"({code}) + ({self.expr.visit(operand)})"
+        return code
+
+    def _visit_native_assign(self, node: Assign) -> str:
+        """Assignment to a local lowered to a native C++ type: no boxing at all."""
+        name = node.target.name
+        value = node.value
+        if node.op != "=":
+            base_op = node.op[:-1]
+            if base_op not in ("+", "-", "*", "/", "//", "%"):
+                raise NotImplementedError(
+                    f"Augmented assignment operator '{node.op}' not supported"
+                )
+            if not self.scope.exists(name):
+                raise RuntimeError(
+                    f"Variable '{name}' used before declaration in augmented assignment"
+                )
+            value = BinaryExpr(left=node.target, op=base_op, right=node.value)
+
+        rhs_code = self.expr.visit_native(value)
+        if not self.scope.exists(name):
+            self.scope.declare(name)
+            return f"{self.scope.native_type(name)} {name} = {rhs_code};"
+        return f"{name} = {rhs_code};"
+
     # ---------- Expression Statements ----------
     def visit_ExprStmt(self, node: ExprStmt) -> str:
         """
@@ -196,6 +259,30 @@ class BasicStatementGenerator:
         Returns:
             str: C++ return statement code.
         """
+        if self.scope.in_generator():
+            # Ends the generator; a returned value would only reach StopIteration
+            return "co_return;"
         if node.value is None:
             return "return DynamicType();"
+        if self.scope.native_return_type():
+            # Typed clone: every returned value has the clone's native type
+            return f"return {self.expr.visit_native(node.value)};"
         return f"return {self.expr.visit(node.value)};"
+
+    # ---------- Yield Statements ----------
+    def visit_Yield(self, node: Yield) -> str:
+        """
+        Generate C++ code for a yield statement: suspend the coroutine with
+        one value for the caller's next() or for loop.
+        Args:
+            node (Yield): AST node representing a yield statement.
+        Returns:
+            str: C++ co_yield statement code.
+        Raises:
+            SyntaxError: If the yield is not inside a function.
+        """
+        if not self.scope.in_generator():
+            raise SyntaxError("'yield' outside function")
+        if node.value is None:
+            return "co_yield DynamicType();"
+        return self.expr.visit_yield(node.value)
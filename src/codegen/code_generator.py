@@ -12,6 +12,8 @@ from .expr_generator import ExprGenerator
 from .function_generator import FunctionGenerator
 from .basic_statement_generator import BasicStatementGenerator
 from .scope_manager import ScopeManager
+from .specialization import FunctionSpecializer
+from .type_inference import iter_nodes, rebound_after_creation, tuple_concatenations
 from src.core import (
     AstNode,
     Module,
@@ -23,6 +25,9 @@ from src.core import (
     Assign,
     ExprStmt,
     Return,
+    Yield,
+    GeneratorExpr,
+    Identifier,
 )
 
 
@@ -30,11 +35,20 @@ CPP_PREAMBLE = """#include "builtins.hpp"
 using namespace std;
 """
 
+# Only programs with generators need C++20 coroutines
+GENERATOR_INCLUDE = '#include "Generator.hpp"\n'
+
+
 
 class CodeGenerator:
     """Main code generation orchestrator."""
 
-    def __init__(self):
+    def __init__(self, profile: bool = False):
+        """
+        Args:
+                profile: Start every generated function with a profiling timer
+                    (see Profile.hpp); it only measures in -DTRANSPYLER_PROFILE builds.
+        """
         self.scope = ScopeManager()
 
         self.expr_generator = ExprGenerator(scope=self.scope)
@@ -48,7 +62,8 @@ class CodeGenerator:
             scope_manager=self.scope,
             basic_stmt_generator=self.basic_stmt_generator,
         )
-        self.function_generator = FunctionGenerator(self.scope)
+        self.specializer = FunctionSpecializer()
+        self.function_generator = FunctionGenerator(self.scope, self.specializer, profile)
 
     def visit(self, node) -> str:
         """
@@ -94,6 +109,7 @@ class CodeGenerator:
     def _generate_cpp(self, module: Module) -> str:
         """Generate C++ code for the module."""
         self.scope.reset()
+        self.scope.enable_constants()
 
         # Separate functions from global statements
         fun_defs: List[FunctionDef] = [
@@ -104,15 +120,34 @@ class CodeGenerator:
         ]
 
         parts: List[str] = [CPP_PREAMBLE]
+        if any(isinstance(n, (Yield, GeneratorExpr)) for n in iter_nodes(module.body)):
+            parts[0] = GENERATOR_INCLUDE + CPP_PREAMBLE
+
+        # Typed clones call each other in any order, so declare everything first
+        self.specializer.analyze(module.body)
+        prototypes = [
+            self.function_generator.signature(f, c) + ";"
+            for f in fun_defs
+            for c in self.specializer.clones_of(f.name)
+        ]
+        if prototypes:
+            prototypes += [self.function_generator.signature(f) + ";" for f in fun_defs]
+            parts.extend(prototypes + [""])
 
         # Generate functions first
         for f in fun_defs:
-            parts.append(self.function_generator.visit(f))
-            parts.append("")
+            for code in self.function_generator.visit_all(f):
+                parts.append(code)
+                parts.append("")
 
         # Generate main() function with global statements
         parts.append("int main() {")
         self.scope.push()
+        self.scope.rebound_names.update(rebound_after_creation(globals_))
+        self.scope.tuple_concatenations |= tuple_concatenations(globals_)
+        self.scope.main_locals = {
+            n.target.name for n in globals_ if isinstance(n, Assign) and isinstance(n.target, Identifier)
+        }
 
         # Check if there's a main function
         has_main_function = any(f.name == "main" for f in fun_defs)
@@ -133,15 +168,21 @@ class CodeGenerator:
             parts.append("  _fn_main();")
 
         self.scope.pop()
+        self.scope.main_locals = set()
         parts.append("  return 0;")
         parts.append("}")
 
+        # Literals are only known once every body is generated; define them up front
+        constants = self.scope.constant_definitions()
+        if constants:
+            parts[1:1] = constants + [""]
+
         return "\n".join(parts)
 
     def _emit_cpp_top_stmt(self, stmt: AstNode) -> List[str]:
         """Emit C++ code for top-level statements in main()."""
-        # Basic statements
-        if isinstance(stmt, (Assign, ExprStmt, Return)):
+        # Basic statements (a yield here raises: it is outside any function)
+        if isinstance(stmt, (Assign, ExprStmt, Return, Yield)):
             code = self.basic_stmt_generator.visit(stmt)
             if code.strip():  # Only add non-empty code
                 return ["  " + code]
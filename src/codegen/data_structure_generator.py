@@ -4,7 +4,7 @@ DataStructureGenerator
 This module provides the DataStructureGenerator class, which is responsible for generating C++ code for data structures such as lists, tuples, sets, and dictionaries.
 
 Key Features:
-- Type deduction for C++ STL containers (e.g., std::vector, std::tuple, std::set, std::map).
+- Type deduction for C++ containers (e.g., std::vector, std::tuple, std::set, DynamicType::Dict).
 - Modular visitor pattern for AST nodes representing collections.
 - Used by the main CodeGenerator to handle all collection-related code generation.
 
@@ -124,9 +124,8 @@ class DataStructureGenerator:
             else:
                 elements.append(self.visit(e))
         
-        # Use std::unordered_set<DynamicType> for proper set semantics
         elements_str = ', '.join(elements)
-        return f"DynamicType(std::unordered_set<DynamicType>{{{elements_str}}})"
+        return f"DynamicType(DynamicType::Set{{{elements_str}}})"
 
 
 
@@ -136,21 +135,21 @@ class DataStructureGenerator:
         Args:
                 node (DictExpr): AST node for a dictionary.
         Returns:
-                str: C++ DynamicType map code.
+                str: C++ DynamicType dict code.
         """
         pairs = []
         for k, v in node.pairs:
             key_code = self.expr_generator.visit(k) if self.expr_generator else self.visit(k)
             val_code = self.expr_generator.visit(v) if self.expr_generator else self.visit(v)
-            # Keys need to be converted to string for map
-            pairs.append(f"{{({key_code}).toString(), {val_code}}}")
+            # Keys keep their type: {1: "a"} and {"1": "a"} are different dicts
+            pairs.append(f"{{{key_code}, {val_code}}}")
         
         if len(pairs) <= 2:
             # Short dictionaries on one line
             pairs_str = ', '.join(pairs)
-            return f"DynamicType(std::map<std::string, DynamicType>{{{pairs_str}}})"
+            return f"DynamicType(DynamicType::Dict{{{pairs_str}}})"
         else:
             # Long dictionaries with line breaks
             pairs_str = ',\n'.join(pairs)
-            return f"DynamicType(std::map<std::string, DynamicType>{{\n{pairs_str}}})"
+            return f"DynamicType(DynamicType::Dict{{\n{pairs_str}}})"
 
@@ -2,9 +2,10 @@
 ExprGenerator: Generates C++ code for expressions and literals.
 
 Handles operators, literals, function calls, data structures, and method calls.
-Converts Python expressions to DynamicType-based C++ code.
+Converts Python expressions to DynamicType-based C++ code. Generator
+expressions become coroutine lambdas (see Generator.hpp).
 """
-from typing import Optional
+from typing import List, Optional, Tuple
 from src.core import (
     AstNode,
     LiteralExpr,
@@ -14,6 +15,11 @@ from src.core import (
     CallExpr,
     Attribute,
     TupleExpr,
+    GeneratorExpr,
+)
+from src.core.ast.ast_expressions import ComparisonExpr, DictExpr, ListExpr, SetExpr
+from .type_inference import (
+    expr_type, iter_nodes, BOOL, BUILTIN_FUNCTIONS, DYNAMIC, FLOAT, INT, INT64_MAX, INT64_MIN, NATIVE_TYPES,
 )
 
 _BIN_OP_CPP = {
@@ -22,6 +28,9 @@ _BIN_OP_CPP = {
     "*": "*",
     "/": "/",
     "%": "%",
+    "|": "|",
+    "&": "&",
+    "^": "^",
     "==": "==",
     "!=": "!=",
     "<": "<",
@@ -47,6 +56,8 @@ class ExprGenerator:
     def __init__(self, scope: Optional[object] = None):
         self.scope = scope
         self.data_structure_generator = None
+        # FunctionSpecializer whose typed clones calls are routed to (set by FunctionGenerator)
+        self.specializer = None
 
     def _create_dynamic_vector(self, elements: list) -> str:
         """Helper method to create DynamicType vector code with consistent formatting."""
@@ -58,6 +69,11 @@ class ExprGenerator:
             return f"DynamicType(std::vector<DynamicType>{{\n    {elements_str}\n}})"
 
     def visit(self, node: AstNode) -> str:
+        # Natively typed subexpressions are computed unboxed and boxed once here
+        if self.expr_type(node) in NATIVE_TYPES:
+            if isinstance(node, LiteralExpr) and type(node.value) is int:
+                return f"DynamicType({node.value})"
+            return f"DynamicType({self.visit_native(node)})"
         m = getattr(self, f"visit_{type(node).__name__}", None)
         if not m or not callable(m):
             raise NotImplementedError(
@@ -65,15 +81,162 @@ class ExprGenerator:
             )
         return m(node)
 
+    # ---------- Type-lowered expressions ----------
+    def expr_type(self, node: AstNode) -> str:
+        """Inferred C++ type of an expression; DynamicType outside inferred functions."""
+        if self.scope is None or not hasattr(self.scope, "lowering_enabled"):
+            return DYNAMIC
+        if not self.scope.lowering_enabled():
+            return DYNAMIC
+        calls = self.specializer.call_type if self.specializer else None
+        return expr_type(node, lambda name: self.scope.native_type(name) or DYNAMIC, calls)
+
+    def visit_native(self, node: AstNode) -> str:
+        """
+        Generate unboxed C++ code for an expression whose inferred type is
+        long long, double or bool. Dynamic operands are converted explicitly.
+        """
+        if isinstance(node, LiteralExpr):
+            if isinstance(node.value, bool):
+                return "true" if node.value else "false"
+            # Ints are long long literals, so 100000 * 100000 is not evaluated as a 32-bit int
+            return f"{node.value}LL" if type(node.value) is int else f"{node.value}"
+
+        if isinstance(node, Identifier):
+            return node.name
+
+        if isinstance(node, UnaryExpr):
+            operand = self.visit_native(node.operand)
+            if node.op in ("-", "MINUS"):
+                return f"(-({operand}))"
+            return f"(!({operand}))"
+
+        if isinstance(node, CallExpr):
+            if node.callee.name not in BUILTIN_FUNCTIONS:
+                return self._clone_call(node)
+            return self._native_builtin_call(node)
+
+        # BinaryExpr / ComparisonExpr with native operands
+        op = node.op
+        result_type = self.expr_type(node)
+        lhs = self.visit_native(node.left)
+        rhs = self.visit_native(node.right)
+        if op in ("/", "//", "%"):
+            if result_type == FLOAT:
+                lhs = self._as_double(node.left, lhs)
+                rhs = self._as_double(node.right, rhs)
+            else:
+                lhs = self._as_int(node.left, lhs)
+                rhs = self._as_int(node.right, rhs)
+            helper = {"/": "py_truediv", "//": "py_floordiv", "%": "py_mod"}[op]
+            return f"{helper}({lhs}, {rhs})"
+        return f"(({lhs}) {_BIN_OP_CPP[op]} ({rhs}))"
+
+    def visit_condition(self, node: AstNode) -> str:
+        """
+        Generate a raw C++ bool for a condition (if/elif/while tests and the
+        operands of and/or/not), without boxing comparison results into a
+        DynamicType only to unpack them again.
+        """
+        if self.expr_type(node) in NATIVE_TYPES:
+            return self.visit_native(node)
+        if isinstance(node, ComparisonExpr) and (node.op == "in" or node.op in _BIN_OP_CPP):
+            return self._raw_comparison(node)
+        if isinstance(node, BinaryExpr) and node.op in ("and", "or"):
+            lhs = self.visit_condition(node.left)
+            rhs = self.visit_condition(node.right)
+            return f"(({lhs}) {_BIN_OP_CPP[node.op]} ({rhs}))"
+        if isinstance(node, UnaryExpr) and node.op in ("not", "!", "NOT"):
+            return f"(!({self.visit_condition(node.operand)}))"
+        return f"({self.visit(node)}).toBool()"
+
+    def _raw_comparison(self, node) -> str:
+        lhs = self.visit(node.left)
+        rhs = self.visit(node.right)
+        if node.op == "in":
+            return f"({rhs}).contains({lhs})"
+        return f"({lhs}) {_BIN_OP_CPP[node.op]} ({rhs})"
+
+    def visit_as_int(self, node: AstNode) -> str:
+        """Generate a long long valued expression (range bounds, native indices)."""
+        if self.expr_type(node) in NATIVE_TYPES:
+            return self._as_int(node, self.visit_native(node))
+        return f"static_cast<long long>(({self.visit(node)}).toInt())"
+
+    def _as_int(self, node: AstNode, code: str) -> str:
+        # Lowered locals and int literals are already long long; other subexpressions may be bool
+        if isinstance(node, (Identifier, LiteralExpr)) and self.expr_type(node) == INT:
+            return code
+        return f"static_cast<long long>({code})"
+
+    def _as_double(self, node: AstNode, code: str) -> str:
+        if self.expr_type(node) == FLOAT:
+            return code
+        if isinstance(node, LiteralExpr) and type(node.value) is int:
+            return f"{node.value}.0"
+        return f"static_cast<double>({code})"
+
+    def _find_clone(self, node: CallExpr):
+        """Typed clone matching the inferred argument types of a user call."""
+        if self.specializer is None or self.expr_type(node) is None:
+            return None
+        if not self.scope.lowering_enabled():
+            return None
+        return self.specializer.lookup(node.callee.name, [self.expr_type(a) for a in node.args])
+
+    def _clone_call(self, node: CallExpr) -> str:
+        clone = self._find_clone(node)
+        args = [
+            self.visit_native(a) if t in NATIVE_TYPES else self.visit(a)
+            for a, t in zip(node.args, clone.param_types)
+        ]
+        return f"{clone.cpp_name}({', '.join(args)})"
+
+    def _native_builtin_call(self, node: CallExpr) -> str:
+        name = node.callee.name
+        arg = node.args[0]
+        arg_type = self.expr_type(arg)
+        if name == "len":
+            return f"static_cast<long long>(({self.visit(arg)}).size())"
+        if name in ("min", "max"):
+            ctype = self.expr_type(node)
+            a, b = (self.visit_native(a) for a in node.args)
+            return f"std::{name}<{ctype}>({a}, {b})"
+        if arg_type == DYNAMIC:
+            conversion = {"float": "toDouble", "bool": "toBool"}[name]
+            return f"({self.visit(arg)}).{conversion}()"
+        code = self.visit_native(arg)
+        if name == "int":
+            return self._as_int(arg, code)
+        if name == "float":
+            return self._as_double(arg, code)
+        if name == "bool":
+            return f"static_cast<bool>({code})"
+        # abs
+        if arg_type == FLOAT:
+            return f"std::fabs({code})"
+        return f"std::llabs({self._as_int(arg, code)})"
+
+    def _hoisting(self) -> bool:
+        """True while a whole module is generated, so literals become module constants."""
+        return self.scope is not None and getattr(self.scope, "constants", None) is not None
+
     def visit_LiteralExpr(self, node: LiteralExpr) -> str:
         v = node.value
 
         if isinstance(v, str):
+            # Hoisted to an interned module constant: no allocation per evaluation
+            if self._hoisting():
+                return self.scope.constant(f'DynamicType::intern("{_escape_cpp_string(v)}")')
             return f'DynamicType(std::string("{_escape_cpp_string(v)}"))'
         if isinstance(v, bool):
             return f"DynamicType({str(v).lower()})"
         if v is None:
             return "DynamicType()"
+        if isinstance(v, int) and not INT64_MIN <= v <= INT64_MAX:
+            # No C++ literal is wide enough; parse the digits once, at startup
+            literal = f'DynamicType(BigInt::fromString("{v}"))'
+            return self.scope.constant(literal) if self._hoisting() else literal
         if isinstance(v, (int, float)):
             return f"DynamicType({v})"
 
@@ -101,7 +264,8 @@ class ExprGenerator:
         op = node.op
 
         if op == "**":
-            return f"DynamicType(pow({lhs}.toDouble(), {rhs}.toDouble()))"
+            # Exact for int operands (promoting to a big int), double otherwise
+            return f"({lhs}).pow({rhs})"
 
         if op == "//":
             return f"({lhs}).floor_div({rhs})"
@@ -111,22 +275,14 @@ class ExprGenerator:
             raise NotImplementedError(f"Binary Op '{op}' is not supported")
 
         if op in ("and", "or"):
-            return f"DynamicType(({lhs}).toBool() {mapped} ({rhs}).toBool())"
+            return f"DynamicType({self.visit_condition(node)})"
 
         return f"({lhs}) {mapped} ({rhs})"
 
     def visit_ComparisonExpr(self, node) -> str:
-        lhs = self.visit(node.left)
-        rhs = self.visit(node.right)
-        op = node.op
-
-        if op == "in":
-            return f"DynamicType(({rhs}).contains({lhs}))"
-
-        mapped = _BIN_OP_CPP.get(op)
-        if not mapped:
-            raise NotImplementedError(f"Comparison Op '{op}' is not supported")
-        return f"DynamicType(({lhs}) {mapped} ({rhs}))"
+        if node.op != "in" and node.op not in _BIN_OP_CPP:
+            raise NotImplementedError(f"Comparison Op '{node.op}' is not supported")
+        return f"DynamicType({self._raw_comparison(node)})"
 
     def visit_CallExpr(self, node: CallExpr) -> str:
         if isinstance(node.callee, Identifier):
@@ -148,18 +304,135 @@ class ExprGenerator:
             "min": "min",
             "max": "max",
             "sum": "sum",
+            "sorted": "sorted",
             "type": "type",
             "input": "input",
             "set": "::set",
+            "list": "::list",
+            "next": "::next",
+            "save": "::save",
+            "load": "::load",
         }
 
+        if callee == "parallel_map":
+            return self._parallel_map_call(node, builtin_mapping)
+
         args = [self.visit(a) for a in node.args]
 
         if callee in builtin_mapping:
             cpp_name = builtin_mapping[callee]
             return f"{cpp_name}({', '.join(args)})"
+        if self._find_clone(node) is not None:
+            return self._clone_call(node)
         return f"_fn_{callee}({', '.join(args)})"
 
+    def _parallel_map_call(self, node: CallExpr, builtin_mapping) -> str:
+        """
+        parallel_map(fn, iterable): fn is passed to the runtime template as a
+        function, the generic _fn_ entry point of a user function (which
+        dispatches to its typed clones) or a lambda around a builtin.
+        """
+        if len(node.args) != 2 or not isinstance(node.args[0], Identifier):
+            raise TypeError("parallel_map() expects a function name and an iterable")
+        name = node.args[0].name
+        iterable = self.visit(node.args[1])
+        if name == "print":
+            return f"parallel_map([](const DynamicType &item) {{ print(item); return DynamicType(); }}, {iterable})"
+        if name in builtin_mapping:
+            fn = f"[](const DynamicType &item) {{ return {builtin_mapping[name]}(item); }}"
+            return f"parallel_map({fn}, {iterable})"
+        functions = self.specializer.functions if self.specializer is not None else None
+        if functions is not None:
+            if name not in functions:
+                raise TypeError(f"parallel_map() expects a function, '{name}' is not defined")
+            if len(functions[name].params) != 1:
+                raise TypeError(f"parallel_map() calls '{name}' with one argument")
+        return f"parallel_map(_fn_{name}, {iterable})"
+
+    def loop_header(self, target: AstNode, iterable_code: str) -> Tuple[List[str], str, List[str]]:
+        """
+        C++ for loop binding target to each item of iterable_code: the
+        declarations to emit before the loop, its header and the statements
+        opening its body. `for k, v in d.items()` walks an explicit Iterator
+        and unpacks every item into names that stay visible after the loop,
+        as in Python; the pairs of an items view are never built.
+        """
+        if not isinstance(target, TupleExpr):
+            return [], f"for (auto {target.name} : {iterable_code})", []
+        names = [e.name for e in target.elements]
+        declarations = []
+        for name in names:
+            if not self.scope.exists(name):
+                self.scope.declare(name)
+                declarations.append(f"DynamicType {name};")
+        it = f"__it_{names[0]}"
+        header = (
+            f"for (DynamicType::Iterator {it} = ({iterable_code}).begin(); "
+            f"{it} != DynamicType::IterationEnd(); ++{it})"
+        )
+        unpack = [f"{name} = {it}.unpack({i}, {len(names)});" for i, name in enumerate(names)]
+        return declarations, header, unpack
+
+    def visit_GeneratorExpr(self, node: GeneratorExpr) -> str:
+        """
+        (elt for x in xs if cond) as an immediately called coroutine lambda.
+        The iterable is evaluated up front, as in Python. The outer variables
+        the element or condition read are looked up when the generator
+        resumes: locals of main() are passed by reference, since they outlive
+        every generator; other locals are passed by value, since the lambda's
+        frame can outlive their function, which is only faithful while they
+        are not rebound after the generator is created (rejected otherwise).
+        """
+        targets = [e.name for e in node.target.elements] if isinstance(node.target, TupleExpr) else [node.target.name]
+        parts = [n for n in (node.element, node.condition) if n is not None]
+        callees = {id(n.callee) for n in iter_nodes(parts) if isinstance(n, CallExpr)}
+        captures = [
+            n.name for n in iter_nodes(parts)
+            if isinstance(n, Identifier) and id(n) not in callees and n.name not in targets
+            and (self.scope.exists(n.name) or self.scope.is_loop_target(n.name))
+        ]
+        captures = list(dict.fromkeys(captures))
+        by_reference = {name for name in captures if self.scope.declared_in_main(name)}
+        for name in captures:
+            if name not in by_reference and name in self.scope.rebound_names.get(id(node), ()):
+                raise NotImplementedError(
+                    f"Generator expression reads '{name}', which is reassigned after the generator "
+                    "is created; only module-level variables are read when the generator resumes"
+                )
+        iterable_code = self.visit(node.iterable)
+
+        self.scope.push()
+        try:
+            body = []
+            for name in targets:
+                self.scope.declare(name)
+            if isinstance(node.target, TupleExpr):
+                body.append(f"DynamicType {', '.join(targets)};")
+            _, header, unpack = self.loop_header(node.target, "__source")
+            step = self.visit_yield(node.element)
+            if node.condition is not None:
+                step = f"if ({self.visit_condition(node.condition)}) {step}"
+            body.append(f"{header} {{ {' '.join(unpack + [step])} }}")
+        finally:
+            self.scope.pop()
+
+        params = ", ".join(
+            [f"auto &{name}" if name in by_reference else f"auto {name}" for name in captures]
+            + ["DynamicType __source"]
+        )
+        args = ", ".join(captures + [iterable_code])
+        return f"[]({params}) -> DynamicType {{ {' '.join(body)} }}({args})"
+
+    def visit_yield(self, node: AstNode) -> str:
+        """
+        co_yield statement for a value. GCC 12 rejects a braced initializer
+        list inside co_yield, so container literals are built in a local first.
+        """
+        code = self.visit(node)
+        if any(isinstance(n, (ListExpr, TupleExpr, SetExpr, DictExpr)) for n in iter_nodes(node)):
+            return f"{{ DynamicType __yielded = {code}; co_yield std::move(__yielded); }}"
+        return f"co_yield {code};"
+
     def visit_ListExpr(self, node) -> str:
         if self.data_structure_generator:
             return self.data_structure_generator.visit(node)
@@ -173,9 +446,9 @@ class ExprGenerator:
         for k, v in node.pairs:
             key_code = self.visit(k)
             val_code = self.visit(v)
-            pairs.append(f"{{({key_code}).toString(), {val_code}}}")
+            pairs.append(f"{{{key_code}, {val_code}}}")
         pairs_str = ", ".join(pairs)
-        return f"DynamicType(std::map<std::string, DynamicType>{{{pairs_str}}})"
+        return f"DynamicType(DynamicType::Dict{{{pairs_str}}})"
 
     def visit_TupleExpr(self, node) -> str:
         if self.data_structure_generator:
@@ -188,50 +461,33 @@ class ExprGenerator:
             return self.data_structure_generator.visit(node)
         elements = [self.visit(e) for e in node.elements]
         elements_str = ", ".join(elements)
-        return f"DynamicType(std::unordered_set<DynamicType>{{{elements_str}}})"
+        return f"DynamicType(DynamicType::Set{{{elements_str}}})"
 
     def visit_Subscript(self, node) -> str:
         obj_code = self.visit(node.value)
 
         if isinstance(node.index, TupleExpr):
             elements = node.index.elements
-
-            def slice_param(elem):
-                if elem is None:
-                    return "DynamicType()"
-                return self.visit(elem)
-
-            if len(elements) == 3:
-                start = slice_param(elements[0])
-                end = slice_param(elements[1])
-                step = slice_param(elements[2])
-
-                if elements[0] is None and elements[1] is None:
-                    if elements[2] is None:
-                        return f"({obj_code})"
-                    else:
-                        return f"({obj_code}).sublist(DynamicType(0), len({obj_code}), {step})"
-                elif elements[2] is None or (
-                    hasattr(elements[2], "value") and elements[2].value == 1
-                ):
-                    if elements[0] is None:
-                        start = "DynamicType(0)"
-                    if elements[1] is None:
-                        end = f"len({obj_code})"
-                    return f"({obj_code}).sublist({start}, {end})"
-                else:
-                    if elements[0] is None:
-                        start = "DynamicType(0)"
-                    if elements[1] is None:
-                        end = f"len({obj_code})"
-                    return f"({obj_code}).sublist({start}, {end}, {step})"
-            else:
+            if len(elements) != 3:
                 raise NotImplementedError(
                     f"Invalid slice tuple length: {len(elements)}"
                 )
-
+            # Omitted bounds stay None so slice() applies Python's defaults;
+            # list slices are views, so even lst[:] copies nothing until written
+            bounds = ["DynamicType()" if e is None else self.visit(e) for e in elements]
+            if elements[2] is None:
+                bounds.pop()
+            return f"({obj_code}).slice({', '.join(bounds)})"
+
+        # Reads go through getItem(): it works on lazy values such as ranges
+        # and never inserts a missing dict key
         index_code = self.visit(node.index)
-        return f"({obj_code})[{index_code}]"
+        return f"({obj_code}).getItem({index_code})"
+
+    def visit_subscript_target(self, node) -> Tuple[str, str]:
+        """Subscript on the left of an assignment: the object and index code,
+        for setItem(), which keeps packed int and float lists packed."""
+        return self.visit(node.value), self.visit(node.index)
 
     def visit_Attribute(self, node: Attribute) -> str:
         obj_code = self.visit(node.value)
@@ -244,17 +500,17 @@ class ExprGenerator:
 
         data_structure_methods = {
             "append": {"params": 1, "cpp_method": "append"},
-            "pop": {
-                "params": -1,
-                "cpp_method": "removeAt",
-                "default_args": ["DynamicType(-1)"],
-            },
+            # pop() / pop(i) on lists, pop(key[, default]) on dicts
+            "pop": {"params": -1, "cpp_method": "pop"},
+            "insert": {"params": 2, "cpp_method": "insert"},
             "remove": {
                 "params": 1,
                 "cpp_method": "remove",
             },
             "get": {"params": 1, "cpp_method": "get"},
             "add": {"params": 1, "cpp_method": "add"},
+            # union is a C++ keyword
+            "union": {"params": 1, "cpp_method": "union_"},
             "discard": {
                 "params": 1,
                 "cpp_method": "remove",
@@ -265,10 +521,6 @@ class ExprGenerator:
             method_info = data_structure_methods[method_name]
             cpp_method = method_info["cpp_method"]
 
-            if method_name == "pop":
-                if len(args) == 0:
-                    return f"({obj_code}).removeAt(DynamicType(-1))"
-                return f"({obj_code}).removeKey({args_code[0]})"
             if method_name in ["sublist", "slice"]:
                 if len(args_code) == 2:
                     return f"({obj_code}).sublist({args_code[0]}, {args_code[1]})"
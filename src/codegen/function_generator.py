@@ -7,10 +7,14 @@ This module provides the FunctionGenerator class, which generates C++ code for f
 Key Features:
 - Supports parameter handling, return statements, and extensibility for advanced function features.
 - Includes helpers for scope and parameter management.
+- Runs TypeInference on each function so monomorphic locals get native C++ types.
+- Emits typed clones chosen by FunctionSpecializer plus a dispatch stub in the generic version.
+- Optionally starts every function with a TRANSPYLER_PROFILE_FUNCTION timer.
+- Functions that yield become C++20 coroutines returning a generator (see Generator.hpp).
 - Used by CodeGenerator to handle all function-related code generation.
 """
 
-from typing import List
+from typing import List, Optional
 from src.core import (
     AstNode,
     FunctionDef,
@@ -18,27 +22,59 @@ from src.core import (
     Assign,
     ExprStmt,
     Return,
+    Yield,
     Block,
     If,
     While,
     For,
+    Subscript,
+    Attribute,
+    CallExpr,
 )
 from .scope_manager import ScopeManager
 from .expr_generator import ExprGenerator
 from .basic_statement_generator import BasicStatementGenerator
 from .statement_generator import StatementVisitor
+from .type_inference import (
+    TypeInference,
+    BOOL,
+    DYNAMIC,
+    FLOAT,
+    INT,
+    NATIVE_TYPES,
+    guard_narrowing,
+    is_generator,
+    loop_target_names,
+    rebound_after_creation,
+    tuple_concatenations,
+)
+from .specialization import Clone, FunctionSpecializer, param_names, iter_nodes
 
 
 class FunctionGenerator:
-    def __init__(self, scope: ScopeManager):
+    def __init__(
+        self,
+        scope: ScopeManager,
+        specializer: Optional[FunctionSpecializer] = None,
+        profile: bool = False,
+    ):
         """
         Initializes the FunctionGenerator for C++ code generation.
         Args:
                 scope (ScopeManager): Scope manager for tracking variable declarations.
+                specializer (FunctionSpecializer): Optional typed clones to generate
+                    and call; without it only the generic DynamicType version is emitted.
+                profile (bool): Time every function with TRANSPYLER_PROFILE_FUNCTION,
+                    which reports per function when built with -DTRANSPYLER_PROFILE.
         """
         self.scope = scope
+        self.specializer = specializer
+        self.profile = profile
+        self.type_inference = TypeInference()
         self.expr_gen = ExprGenerator(scope=self.scope)
         self.basic_stmt = BasicStatementGenerator(self.scope)
+        self.expr_gen.specializer = specializer
+        self.basic_stmt.expr.specializer = specializer
         self.ctrl_stmt = StatementVisitor(
             expr_generator=self.expr_gen,
             scope_manager=self.scope,
@@ -46,27 +82,90 @@ class FunctionGenerator:
         )
 
     def visit(self, node: FunctionDef) -> str:
+        """Generic DynamicType version, starting with a dispatch stub to its clones."""
         if not isinstance(node, FunctionDef):
             raise TypeError("FunctionGenerator.visit() expects a FunctionDef")
 
-        #  ------- Function Definition -------
-        param_names: List[str] = []
-        for p in node.params:
-            if isinstance(p, Identifier):
-                param_names.append(p.name)
+        calls = self.specializer.call_type if self.specializer else None
+        native_types = self.type_inference.infer_function(node, None, calls)
+        dispatch = [self._dispatch_line(node, c) for c in self._clones(node)]
+        # A timer in a coroutine would also count the time it spends suspended
+        timer = [] if is_generator(node) else self._timer(node.name)
+        return self._emit_function(node, self.signature(node), native_types, None, timer + dispatch)
+
+    def visit_clone(self, node: FunctionDef, clone: Clone) -> str:
+        """Typed clone: native parameters, locals and (when inferred) return type."""
+        return_type = clone.return_type if clone.return_type in NATIVE_TYPES else None
+        # Clones are timed apart from the generic version, under their C++ suffix
+        return self._emit_function(
+            node,
+            self.signature(node, clone),
+            clone.local_types,
+            return_type,
+            self._timer(clone.cpp_name[len("_fn_"):]),
+        )
+
+    def visit_all(self, node: FunctionDef) -> List[str]:
+        """Every clone of a function followed by its generic version."""
+        return [self.visit_clone(node, c) for c in self._clones(node)] + [self.visit(node)]
+
+    def signature(self, node: FunctionDef, clone: Optional[Clone] = None) -> str:
+        """
+        C++ signature, also used for forward declarations. DynamicType
+        parameters that the body never rebinds or mutates are taken by const&,
+        except in generators: the coroutine frame outlives the call's arguments.
+        """
+        names = param_names(node)
+        types = clone.param_types if clone else (DYNAMIC,) * len(names)
+        mutated = set(names) if is_generator(node) else _mutated_params(node)
+        params = []
+        for name, ctype in zip(names, types):
+            if ctype in NATIVE_TYPES:
+                params.append(f"{ctype} {name}")
+            elif name in mutated:
+                params.append(f"DynamicType {name}")
+            else:
+                params.append(f"const DynamicType &{name}")
+        if clone:
+            return_type = clone.return_type if clone.return_type in NATIVE_TYPES else DYNAMIC
+            return f"{return_type} {clone.cpp_name}({', '.join(params)})"
+        return f"DynamicType _fn_{node.name}({', '.join(params)})"
+
+    def _timer(self, name: str) -> List[str]:
+        """Profiling timer opening a function body (a no-op macro in normal builds)."""
+        return [f'TRANSPYLER_PROFILE_FUNCTION("{name}");'] if self.profile else []
+
+    def _clones(self, node: FunctionDef) -> List[Clone]:
+        return self.specializer.clones_of(node.name) if self.specializer else []
+
+    def _dispatch_line(self, node: FunctionDef, clone: Clone) -> str:
+        """if (tags match) return <clone>(unboxed args);"""
+        checks, args = [], []
+        unbox = {INT: ("isInt", "toInt"), FLOAT: ("isDouble", "toDouble"), BOOL: ("isBool", "toBool")}
+        for name, ctype in zip(param_names(node), clone.param_types):
+            if ctype in NATIVE_TYPES:
+                check, convert = unbox[ctype]
+                checks.append(f"{name}.{check}()")
+                args.append(f"{name}.{convert}()")
             else:
-                param_names.append(str(p))
+                args.append(name)
+        call = f"{clone.cpp_name}({', '.join(args)})"
+        if clone.return_type in NATIVE_TYPES:
+            call = f"DynamicType({call})"
+        return f"if ({' && '.join(checks)}) return {call};"
 
-        cpp_params = ", ".join(f"DynamicType {n}" for n in param_names)
-        header = f"DynamicType _fn_{node.name}({cpp_params}) {{"
+    def _emit_function(self, node, signature, native_types, return_type, prologue) -> str:
+        header = f"{signature} {{"
         #  ------- Function scope -------
         self.scope.push()
         try:
-            for n in param_names:
+            self.scope.set_native_types(native_types, return_type)
+            self.scope.set_generator(is_generator(node))
+            for n in param_names(node):
                 if not self.scope.exists(n):
                     self.scope.declare(n)
             #  ------- Function Body -------
-            body_lines: List[str] = []
+            body_lines: List[str] = list(prologue)
             # node.body can be either a list of statements or a Block node
             if isinstance(node.body, list):
                 statements = node.body
@@ -75,8 +174,14 @@ class FunctionGenerator:
             else:
                 statements = [node.body]
 
-            for stmt in statements:
+            self.scope.rebound_names.update(rebound_after_creation(statements))
+            self.scope.tuple_concatenations |= tuple_concatenations(statements)
+            guards = guard_narrowing(statements, param_names(node), self.scope.native_type)
+            for index, stmt in enumerate(statements):
                 body_lines.append(self._emit_stmt(stmt))
+                if index in guards:
+                    # Later statements were inferred with the range an early return leaves
+                    self.scope.narrow_native_type(*guards[index])
             has_top_return = any(isinstance(s, Return) for s in statements)
             lines = [header]
             for line in body_lines:
@@ -84,7 +189,11 @@ class FunctionGenerator:
                     continue
                 for sub in line.splitlines():
                     lines.append("	" + sub)
-            if not has_top_return:
+            if return_type is not None:
+                # Native clones return on every path; this only silences -Wreturn-type
+                if not isinstance(statements[-1], Return):
+                    lines.append("	return {};")
+            elif not has_top_return and not self.scope.in_generator():
                 lines.append("	return DynamicType();")
             lines.append("}")
             return "\n".join(lines)
@@ -92,8 +201,8 @@ class FunctionGenerator:
             self.scope.pop()
 
     def _emit_stmt(self, stmt: AstNode) -> str:
-        # Basic statements (assignments, expressions, returns)
-        if isinstance(stmt, (Assign, ExprStmt, Return)):
+        # Basic statements (assignments, expressions, returns, yields)
+        if isinstance(stmt, (Assign, ExprStmt, Return, Yield)):
             return self.basic_stmt.visit(stmt)
         # Control flow statements (if, while, for, blocks)
         if isinstance(stmt, (If, While, For, Block)):
@@ -108,3 +217,24 @@ class FunctionGenerator:
                 raise NotImplementedError(
                     f"[FunctionGenerator] Statement type {type(stmt).__name__} not supported"
                 )
+
+
+def _mutated_params(node: FunctionDef) -> set:
+    """
+    Parameters the body rebinds, assigns through (p[i] = v), calls methods on
+    or uses as a loop target; these are taken by value, the rest by const&.
+    """
+    def root(expr):
+        while isinstance(expr, (Subscript, Attribute)):
+            expr = expr.value
+        return expr.name if isinstance(expr, Identifier) else None
+
+    mutated = set()
+    for n in iter_nodes(node.body):
+        if isinstance(n, Assign):
+            mutated.add(root(n.target))
+        elif isinstance(n, For):
+            mutated.update(loop_target_names(n))
+        elif isinstance(n, CallExpr) and isinstance(n.callee, Attribute):
+            mutated.add(root(n.callee))
+    return mutated
@@ -21,6 +21,27 @@ class ScopeManager:
         Uses a deque for efficient stack operations.
         """
         self.scopes = deque()
+        # Native C++ types planned by TypeInference, one dict per scope
+        # (None for scopes whose locals were not inferred, e.g. main())
+        self.native_types = deque()
+        # Native return type of a typed function clone, one entry per scope
+        self.return_types = deque()
+        # True for the scope of a generator function body, one entry per scope
+        self.generators = deque()
+        # Module-level constants hoisted out of generated code, keyed by their
+        # C++ initializer; None while a lone fragment is generated (inline literals)
+        self.constants = None
+        # Locals declared at the top level of main() while it is generated,
+        # which outlive every generator
+        self.main_locals = set()
+        # Targets of the for loops whose bodies are being generated, innermost last
+        self.loop_targets = []
+        # Names each generator expression (by id) may see rebound while it
+        # is alive (see type_inference.rebound_after_creation)
+        self.rebound_names = {}
+        # `x += value` statements (by id) whose target may hold a tuple
+        # (see type_inference.tuple_concatenations)
+        self.tuple_concatenations = set()
         self.enter_scope()  # Start with global scope
 
     def enter_scope(self):
@@ -29,6 +50,9 @@ class ScopeManager:
         Typically called when entering a function, class, or block.
         """
         self.scopes.append({})
+        self.native_types.append(None)
+        self.return_types.append(None)
+        self.generators.append(None)
 
     def exit_scope(self):
         """
@@ -37,6 +61,9 @@ class ScopeManager:
         """
         if len(self.scopes) > 1:
             self.scopes.pop()
+            self.native_types.pop()
+            self.return_types.pop()
+            self.generators.pop()
         else:
             raise RuntimeError("Cannot exit global scope")
 
@@ -85,6 +112,9 @@ class ScopeManager:
         """Alias for exit_scope(); doesn't crash if in global scope."""
         if len(self.scopes) > 1:
             self.scopes.pop()
+            self.native_types.pop()
+            self.return_types.pop()
+            self.generators.pop()
         else:
             # Fail-soft: don't throw to avoid breaking pipelines
             pass
@@ -92,8 +122,36 @@ class ScopeManager:
     def reset(self):
         """Reset to a single global scope."""
         self.scopes.clear()
+        self.native_types.clear()
+        self.return_types.clear()
+        self.generators.clear()
+        self.main_locals = set()
+        self.loop_targets = []
+        self.rebound_names = {}
+        self.tuple_concatenations = set()
         self.enter_scope()
 
+    def enable_constants(self):
+        """Start collecting hoisted constants for a whole module."""
+        self.constants = {}
+
+    def constant(self, initializer: str) -> str:
+        """
+        Name of the module-level constant built by initializer, created on
+        first use so equal literals share one constant. Returns the
+        initializer itself when no module is being generated.
+        """
+        if self.constants is None:
+            return initializer
+        return self.constants.setdefault(initializer, f"__lit_{len(self.constants)}")
+
+    def constant_definitions(self):
+        """C++ definitions of the hoisted constants, in creation order."""
+        return [
+            f"static const DynamicType {name} = {initializer};"
+            for initializer, name in (self.constants or {}).items()
+        ]
+
     def declare(self, name):
         """Declare a name in the current scope."""
         self.add_symbol(name, True)
@@ -101,3 +159,57 @@ class ScopeManager:
     def exists(self, name) -> bool:
         """Does the name exist in any visible scope?"""
         return self.resolve_symbol(name) is not None
+
+    def is_loop_target(self, name) -> bool:
+        """Is the name bound by an enclosing for loop header?"""
+        return any(name in targets for targets in self.loop_targets)
+
+    def declared_in_main(self, name) -> bool:
+        """Is the name a top-level local of main(), not shadowed by a loop target?"""
+        return name in self.main_locals and not self.is_loop_target(name)
+
+    def set_native_types(self, types, return_type=None):
+        """
+        Record the native C++ types inferred for locals of the current scope
+        and, for a typed clone, its native return type.
+        """
+        self.native_types[-1] = dict(types)
+        self.return_types[-1] = return_type
+
+    def narrow_native_type(self, name, native_type):
+        """Replace a native local's type in the current scope (e.g. with a narrower int range)."""
+        self.native_types[-1][name] = native_type
+
+    def native_return_type(self):
+        """Native return type of the enclosing function, or None for DynamicType."""
+        for return_type in reversed(self.return_types):
+            if return_type is not None:
+                return return_type
+        return None
+
+    def set_generator(self, generator: bool):
+        """Mark the current scope as the body of a generator function (or not)."""
+        self.generators[-1] = generator
+
+    def in_generator(self) -> bool:
+        """True inside the body of the innermost function when it is a generator."""
+        for generator in reversed(self.generators):
+            if generator is not None:
+                return generator
+        return False
+
+    def native_type(self, name):
+        """
+        Native C++ type of a visible name ("long long", "double", "bool"),
+        or None when it is a DynamicType.
+        """
+        for scope, types in zip(reversed(self.scopes), reversed(self.native_types)):
+            if types and name in types:
+                return types[name]
+            if name in scope:
+                return None
+        return None
+
+    def lowering_enabled(self) -> bool:
+        """True inside a scope whose locals went through type inference."""
+        return any(types is not None for types in self.native_types)
@@ -0,0 +1,178 @@
+"""
+FunctionSpecializer: Typed clones of generated functions.
+
+Looks at every call site of a user function and records the argument type
+combinations it is called with (using TypeInference for the caller's
+locals). Each combination with at least one native argument gets a typed
+clone, e.g. an all-int `_fn_fib__i(long long n)` next to the generic
+`_fn_fib(const DynamicType &n)`. The generic version stays as the fallback
+and starts with a dispatch stub that forwards to a clone when the argument
+tags match.
+
+Key Features:
+- Interprocedural fixed point: clones calling clones (recursion included)
+  get native return types when every path returns the same native type
+- Clones whose body contradicts their parameter types are discarded
+- Bounded number of clones per function
+- Generator functions are never cloned: calling one only builds its frame
+
+Usage:
+    specializer = FunctionSpecializer()
+    specializer.analyze(module.body)
+    specializer.clones_of("fib")   # [Clone(name="fib", param_types=("long long",), ...)]
+"""
+
+from dataclasses import dataclass, field
+from typing import Dict, List, Optional, Tuple
+from src.core import AstNode, CallExpr, FunctionDef, Identifier
+from .type_inference import (
+    BOOL,
+    DYNAMIC,
+    FLOAT,
+    INT,
+    NATIVE_TYPES,
+    TypeInference,
+    expr_type,
+    function_body,
+    guarded_statements,
+    int_bounds,
+    is_generator,
+    iter_nodes,
+    plain_type,
+)
+
+_TYPE_SUFFIX = {INT: "i", FLOAT: "d", BOOL: "b", DYNAMIC: "o"}
+
+
+def param_names(node: FunctionDef) -> List[str]:
+    return [p.name if isinstance(p, Identifier) else str(p) for p in node.params]
+
+
+def _ranged(types: Dict[str, str]) -> Dict[str, tuple]:
+    """Local types with their int ranges, which plain comparison ignores."""
+    return {name: (t, int_bounds(t)) for name, t in types.items()}
+
+
+@dataclass
+class Clone:
+    """One specialization of a function for fixed parameter types."""
+
+    name: str
+    param_types: Tuple[str, ...]
+    local_types: Dict[str, str] = field(default_factory=dict)
+    return_type: Optional[str] = None
+    valid: bool = True
+
+    @property
+    def cpp_name(self) -> str:
+        suffix = "".join(_TYPE_SUFFIX[t] for t in self.param_types)
+        return f"_fn_{self.name}__{suffix}"
+
+
+class FunctionSpecializer:
+    """Finds the typed clones to generate for a module."""
+
+    MAX_CLONES_PER_FUNCTION = 4
+
+    def __init__(self):
+        self.inference = TypeInference()
+        self.functions: Dict[str, FunctionDef] = {}
+        self.clones: Dict[str, Dict[Tuple[str, ...], Clone]] = {}
+
+    def analyze(self, module_body: List[AstNode]):
+        """Collect the clones needed by the call sites of a module."""
+        self.functions = {n.name: n for n in module_body if isinstance(n, FunctionDef)}
+        self.clones = {name: {} for name in self.functions}
+        globals_ = [n for n in module_body if not isinstance(n, FunctionDef)]
+
+        while True:
+            self._solve()
+            added = False
+            for name, arg_types in self._call_sites(globals_):
+                added = self._add_clone(name, arg_types) or added
+            if not added:
+                break
+
+    def clones_of(self, name: str) -> List[Clone]:
+        return [c for c in self.clones.get(name, {}).values() if c.valid]
+
+    def lookup(self, name: str, arg_types) -> Optional[Clone]:
+        """The clone generated for exactly these argument types, if any."""
+        clone = self.clones.get(name, {}).get(tuple(arg_types))
+        return clone if clone is not None and clone.valid else None
+
+    def call_type(self, name: str, arg_types) -> Optional[str]:
+        """Return type of a call (callback for type_inference.expr_type)."""
+        clone = self.lookup(name, arg_types)
+        return DYNAMIC if clone is None else clone.return_type
+
+    # ---------- Analysis ----------
+    def _add_clone(self, name: str, arg_types: Tuple[str, ...]) -> bool:
+        known = self.clones[name]
+        if arg_types in known or len(known) >= self.MAX_CLONES_PER_FUNCTION:
+            return False
+        if is_generator(self.functions[name]):
+            return False
+        known[arg_types] = Clone(name=name, param_types=arg_types)
+        return True
+
+    def _solve(self):
+        """Fixed point of clone locals and return types, recomputed from scratch."""
+        all_clones = [c for by_types in self.clones.values() for c in by_types.values()]
+        for clone in all_clones:
+            clone.return_type = None
+            clone.valid = True
+
+        changed = True
+        while changed:
+            changed = False
+            for clone in all_clones:
+                if not clone.valid:
+                    continue
+                fn = self.functions[clone.name]
+                params = dict(zip(param_names(fn), clone.param_types))
+                types = self.inference.infer_function(fn, params, self.call_type)
+                if types is None:
+                    # The body rebinds a parameter to another type
+                    clone.valid = False
+                    changed = True
+                    continue
+                returned = self.inference.return_type(fn, types, self.call_type)
+                if returned is None:
+                    returned = clone.return_type
+                elif clone.return_type is not None and returned != clone.return_type:
+                    returned = DYNAMIC
+                if _ranged(types) != _ranged(clone.local_types) or returned != clone.return_type:
+                    changed = True
+                clone.local_types = types
+                clone.return_type = returned
+
+        # Only recursion without a base case leaves a return type unknown
+        for clone in all_clones:
+            if clone.return_type is None:
+                clone.return_type = DYNAMIC
+
+    def _call_sites(self, globals_: List[AstNode]):
+        """(function, argument types) for every call with a native argument."""
+        scopes = [(globals_, [], self.inference.infer_statements(globals_, self.call_type))]
+        for name, fn in self.functions.items():
+            body, params = function_body(fn), param_names(fn)
+            scopes.append((body, params, self.inference.infer_function(fn, None, self.call_type)))
+            for clone in self.clones_of(name):
+                scopes.append((body, params, clone.local_types))
+
+        sites = []
+        for statements, params, types in scopes:
+            lookup = lambda n, types=types: types.get(n, DYNAMIC)
+            for stmt, guarded in guarded_statements(statements, params, lookup):
+                for node in iter_nodes(stmt):
+                    if not (isinstance(node, CallExpr) and isinstance(node.callee, Identifier)):
+                        continue
+                    fn = self.functions.get(node.callee.name)
+                    if fn is None or len(fn.params) != len(node.args):
+                        continue
+                    # Clones are keyed by plain types; argument ranges do not reach the callee
+                    arg_types = tuple(plain_type(expr_type(a, guarded, self.call_type)) for a in node.args)
+                    if None not in arg_types and any(t in NATIVE_TYPES for t in arg_types):
+                        sites.append((fn.name, arg_types))
+        return sites
@@ -8,6 +8,19 @@ Handles if/while/for loops, break/continue/pass, bl    def visit_Break_cpp(self,
         return "continue;" delegation.
 """
 
+from .type_inference import (
+    INT,
+    INT64_MAX,
+    INT64_MIN,
+    appended_lists,
+    int_bounds,
+    is_pure,
+    loop_target_names,
+    range_loop_bounds,
+    span_fits,
+    while_loop_span,
+)
+
 
 class StatementVisitor:
     """Generates C++ code for control flow statements."""
@@ -27,7 +40,6 @@ class StatementVisitor:
         self.expr_generator = expr_generator
         self.scope_manager = scope_manager
         self.basic_stmt_generator = basic_stmt_generator
-        self._iter_counter = 0
 
     def indent(self) -> str:
         return self.indent_str * self.indent_level
@@ -64,27 +76,13 @@ class StatementVisitor:
         return "\n".join(code)
 
     def visit_If_cpp(self, node):
-        code = []
-        cond_code = (
-            self.expr_generator.visit(node.cond)
-            if hasattr(self, "expr_generator")
-            else str(node.cond)
-        )
-        if cond_code.startswith("DynamicType("):
-            code.append(f"if ({cond_code}.toBool())")
-        else:
-            code.append(f"if (DynamicType({cond_code}).toBool())")
+        code = [f"if ({self._condition(node.cond)})"]
 
         body_code = self.visit(node.body)
         code.append(body_code)
 
         for elif_cond, elif_body in getattr(node, "elifs", []):
-            elif_cond_code = (
-                self.expr_generator.visit(elif_cond)
-                if hasattr(self, "expr_generator")
-                else str(elif_cond)
-            )
-            code.append(f"else if (({elif_cond_code}).toBool())")
+            code.append(f"else if ({self._condition(elif_cond)})")
             code.append(self.visit(elif_body))
 
         if hasattr(node, "orelse") and node.orelse:
@@ -94,42 +92,116 @@ class StatementVisitor:
         return "\n".join(code)
 
     def visit_While_cpp(self, node):
-        cond_code = (
-            self.expr_generator.visit(node.cond)
-            if hasattr(self, "expr_generator")
-            else str(node.cond)
-        )
-        if cond_code.startswith("DynamicType("):
-            code = [f"while ({cond_code}.toBool())"]
-        else:
-            code = [f"while (DynamicType({cond_code}).toBool())"]
+        code = self._reserve_hints(node, self._while_trip_count(node))
+        code.append(f"while ({self._condition(node.cond)})")
         code.append(self.visit(node.body))
         return "\n".join(code)
 
-    def visit_For_cpp(self, node):
-        iterable_code = (
-            self.expr_generator.visit(node.iterable)
-            if hasattr(self, "expr_generator")
-            else str(node.iterable)
-        )
-        target_code = (
-            self.expr_generator.visit(node.target)
-            if hasattr(self, "expr_generator")
-            else str(node.target)
-        )
+    def _reserve_hints(self, loop, count_args):
+        """
+        reserve() calls for the lists the loop appends to once per iteration,
+        given the reserve() arguments for its trip count (None if unknown).
+        """
+        if count_args is None or self.scope_manager is None:
+            return []
+        return [
+            f"({name}).reserve({count_args});"
+            for name in appended_lists(loop)
+            if self.scope_manager.exists(name) and self.scope_manager.native_type(name) is None
+        ]
+
+    def _while_trip_count(self, node):
+        """reserve() arguments for a counting while loop (see while_loop_span), or None."""
+        span = while_loop_span(node) if self.expr_generator is not None else None
+        if span is None:
+            return None
+        low, high, inclusive = span
+        low_type, high_type = self.expr_generator.expr_type(low), self.expr_generator.expr_type(high)
+        if low_type == INT and high_type == INT and span_fits(low_type, high_type, inclusive):
+            count = f"({self.expr_generator.visit_as_int(high)}) - ({self.expr_generator.visit_as_int(low)})"
+            return f"{count} + 1" if inclusive else count
+        # The counter is a DynamicType or the count may overflow: the runtime checks it
+        args = [self.expr_generator.visit(low), self.expr_generator.visit(high)]
+        return ", ".join(args + ["true"] if inclusive else args)
+
+    def _condition(self, expr) -> str:
+        """Raw C++ bool for an if/elif/while test."""
+        generator = getattr(self, "expr_generator", None)
+        if generator is None:
+            return f"DynamicType({expr}).toBool()"
+        return generator.visit_condition(expr)
 
-        self._iter_counter += 1
-        temp_var = f"__iter_temp_{self._iter_counter}"
-        elem_type = "auto"
-        code = ["{"]
-        code.append(f"  auto {temp_var} = ({iterable_code}).getList();")
-        code.append(f"  for ({elem_type} {target_code} : {temp_var})")
-        body_code = self.visit(node.body)
-        for line in body_code.splitlines():
-            code.append(f"  {line}")
-        code.append("}")
+    def visit_For_cpp(self, node):
+        native_loop = self._visit_native_range_for(node)
+        if native_loop is not None:
+            return native_loop
+
+        iterable_code = self.expr_generator.visit(node.iterable)
+
+        # Iterate the value itself: DynamicType::begin() walks lists and dicts
+        # in place, computes range elements and resumes generators, so no
+        # snapshot of the iterable is taken
+        trip_count = None
+        if is_pure(node.iterable):
+            # 0 for generators, whose length is unknown until they finish
+            trip_count = f"static_cast<long long>(({iterable_code}).lengthHint())"
+        declarations, header, unpack = self.expr_generator.loop_header(node.target, iterable_code)
+        code = self._reserve_hints(node, trip_count) + declarations
+        code.append(header)
+        body = self._loop_body(node)
+        if unpack:
+            # The unpacked targets are bound first thing in the body
+            opening, rest = body.split("\n", 1)
+            inner = self.indent_str * (self.indent_level + 1)
+            body = "\n".join([opening] + [inner + line for line in unpack] + [rest])
+        code.append(body)
         return "\n".join(code)
 
+    def _visit_native_range_for(self, node):
+        """
+        `for i in range(...)` over a counter inferred as long long becomes a
+        plain counting loop. The stop bound is evaluated once, as in Python.
+        """
+        if self.scope_manager is None or self.expr_generator is None:
+            return None
+        bounds = range_loop_bounds(node)
+        if bounds is None or self.scope_manager.native_type(node.target.name) != INT:
+            return None
+
+        start, stop, step = bounds
+        name = node.target.name
+        start_code = self.expr_generator.visit_as_int(start) if start is not None else "0"
+        stop_code = self.expr_generator.visit_as_int(stop)
+        compare = "<" if step > 0 else ">"
+        increment = f"++{name}" if step == 1 else f"{name} += {step}"
+        stop_low, stop_high = int_bounds(self.expr_generator.expr_type(stop)) or (INT64_MIN, INT64_MAX)
+        if stop_high - 1 + step > INT64_MAX or stop_low + 1 + step < INT64_MIN:
+            # The last step past a stop near the int64 limits would wrap; it ends the loop instead
+            increment = f"{name} = add_overflow({name}, {step}, {name}) ? __stop_{name} : {name}"
+        header = (
+            f"for (long long {name} = {start_code}, __stop_{name} = {stop_code}; "
+            f"{name} {compare} __stop_{name}; {increment})"
+        )
+        trip_count = None
+        if is_pure(stop) and (start is None or is_pure(start)):
+            if step == 1 and start is None:
+                trip_count = stop_code
+            elif step == 1 and span_fits(self.expr_generator.expr_type(start), self.expr_generator.expr_type(stop)):
+                trip_count = f"({stop_code}) - ({start_code})"
+            else:
+                trip_count = f"static_cast<long long>(DynamicType::Range{{{start_code}, {stop_code}, {step}}}.size())"
+        return "\n".join(self._reserve_hints(node, trip_count) + [header, self._loop_body(node)])
+
+    def _loop_body(self, node):
+        """Body of a for loop, with its targets visible to generator expressions in it."""
+        if self.scope_manager is None:
+            return self.visit(node.body)
+        self.scope_manager.loop_targets.append(set(loop_target_names(node)))
+        try:
+            return self.visit(node.body)
+        finally:
+            self.scope_manager.loop_targets.pop()
+
     def visit_Break_cpp(self, node):
         return "break;"
 
@@ -164,9 +236,17 @@ class StatementVisitor:
                 f"Cannot handle assignment to {type(node.target).__name__} without BasicStatementGenerator"
             )
 
+    def visit_Yield_cpp(self, node):
+        return self.basic_stmt_generator.visit(node)
+
     def visit_Return_cpp(self, node):
+        if self.basic_stmt_generator:
+            return self.basic_stmt_generator.visit(node)
         if node.value is None:
             return "return DynamicType();"
+        elif self.scope_manager is not None and self.scope_manager.native_return_type():
+            # Typed clone returning an unboxed value
+            return f"return {self.expr_generator.visit_native(node.value)};"
         elif hasattr(self, "expr_generator") and self.expr_generator:
             return f"return {self.expr_generator.visit(node.value)};"
         else:
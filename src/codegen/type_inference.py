@@ -0,0 +1,950 @@
+"""
+TypeInference: Infers native C++ types for function locals.
+
+Runs over a FunctionDef before its code is generated and finds the locals
+whose type never changes: every assignment gives them an int, a float or a
+bool. Those locals are emitted as `long long`, `double` or `bool` instead of
+`DynamicType`; the expression generator boxes them back into a DynamicType
+only where a dynamic value is needed (calls, returns, containers, printing).
+
+Key Features:
+- Flow-insensitive fixed point over all assignments of a function
+- Loop counters of `for x in range(...)` are typed as int
+- Anything it cannot prove (parameters, strings, collections, calls to user
+  functions without a typed clone, `**`) stays DynamicType
+- Given parameter types, infers the locals and return type of a typed clone
+  (used by FunctionSpecializer)
+- Int ranges: Python ints are unbounded and DynamicType promotes to a big
+  int on overflow, but a `long long` would wrap. Every int expression and
+  local carries the interval of values it can take (IntRange), and an int
+  operation whose exact result may leave int64 is DYNAMIC, so it runs on
+  the promoting DynamicType operators. Range loop counters take the range
+  of their bounds; `x += e` in loops with a bounded trip count (range loops
+  and counting while loops) grows x by at most the trip count times e, and
+  the step of a counting `while i < n` loop never passes n. Early-return
+  guards (`if n < 2: return n`) narrow an int parameter for the statements
+  after them. Values that grow
+  without such a bound (`f = f * i`, `a, b = b, a + b`, `total += i` in a
+  `while True` loop, recursive `fib(n - 1) + fib(n - 2)`) stay DynamicType
+
+Usage:
+    types = TypeInference().infer_function(function_def)
+    # {"i": "long long", "total": "double", ...}
+"""
+
+from typing import Callable, Dict, List, NamedTuple, Optional, Set, Tuple
+from src.core import (
+    AstNode,
+    Assign,
+    Attribute,
+    BinaryExpr,
+    Block,
+    Break,
+    CallExpr,
+    Continue,
+    ExprStmt,
+    For,
+    FunctionDef,
+    GeneratorExpr,
+    Identifier,
+    If,
+    LiteralExpr,
+    Return,
+    TupleExpr,
+    UnaryExpr,
+    While,
+    Yield,
+)
+from src.core.ast.ast_expressions import ComparisonExpr
+
+INT = "long long"
+FLOAT = "double"
+BOOL = "bool"
+DYNAMIC = "DynamicType"
+
+NATIVE_TYPES = (INT, FLOAT, BOOL)
+
+# Int literals outside this range only fit a DynamicType big int
+INT64_MIN = -(2**63)
+INT64_MAX = 2**63 - 1
+
+_ARITHMETIC_OPS = ("+", "-", "*", "/", "//", "%")
+# Rounds a local's range may widen before it is given up as unbounded
+_WIDEN_AFTER = 16
+_COMPARISON_OPS = ("==", "!=", "<", "<=", ">", ">=")
+_AUGMENTED_OPS = {
+    "+=": "+",
+    "-=": "-",
+    "*=": "*",
+    "/=": "/",
+    "//=": "//",
+    "%=": "%",
+    "**=": "**",
+}
+
+
+class IntRange(str):
+    """
+    INT narrowed to the values an expression or local is proven to take,
+    low to high inclusive. It is the string "long long", so it compares,
+    hashes and prints as INT wherever a type is expected; a plain INT stands
+    for any 64-bit value.
+    """
+
+    def __new__(cls, low: int, high: int):
+        value = super().__new__(cls, INT)
+        value.low = low
+        value.high = high
+        return value
+
+    def __repr__(self) -> str:
+        return f"IntRange({self.low}, {self.high})"
+
+
+def int_bounds(t: Optional[str]) -> Optional[Tuple[int, int]]:
+    """(low, high) of the values an INT or BOOL can hold; None for other types."""
+    if isinstance(t, IntRange):
+        return t.low, t.high
+    if t == INT:
+        return INT64_MIN, INT64_MAX
+    if t == BOOL:
+        return 0, 1
+    return None
+
+
+def span_fits(low_type: Optional[str], high_type: Optional[str], extra: int = 0) -> bool:
+    """Whether `high - low + extra` stays an int64 for all values of two int types."""
+    low, high = int_bounds(low_type), int_bounds(high_type)
+    if low is None or high is None:
+        return False
+    return INT64_MIN <= high[0] - low[1] + extra and high[1] - low[0] + extra <= INT64_MAX
+
+
+def plain_type(t: Optional[str]) -> Optional[str]:
+    """The type without its int range (for clone signatures and return types)."""
+    return INT if t == INT else t
+
+
+def _int_type(low: int, high: int) -> str:
+    """IntRange of low..high, or DYNAMIC when some value would not fit a long long."""
+    if INT64_MIN <= low and high <= INT64_MAX:
+        return IntRange(low, high)
+    return DYNAMIC
+
+
+def _same_type(a: Optional[str], b: Optional[str]) -> bool:
+    return a == b and (a != INT or int_bounds(a) == int_bounds(b))
+
+
+def _join(current: Optional[str], new: Optional[str]) -> Optional[str]:
+    """Least upper bound: None means 'no information yet', DYNAMIC is the top."""
+    if current is None:
+        return new
+    if new is None:
+        return current
+    if current == INT and new == INT:
+        (low, high), (new_low, new_high) = int_bounds(current), int_bounds(new)
+        return IntRange(min(low, new_low), max(high, new_high))
+    if new == current:
+        return current
+    return DYNAMIC
+
+
+def _arithmetic_bounds(op: str, a: Tuple[int, int], b: Tuple[int, int]) -> Tuple[int, int]:
+    """Exact bounds of a op b over the intervals a and b (Python int semantics)."""
+    (a_low, a_high), (b_low, b_high) = a, b
+    if op == "+":
+        return a_low + b_low, a_high + b_high
+    if op == "-":
+        return a_low - b_high, a_high - b_low
+    if op == "*":
+        products = [x * y for x in a for y in b]
+        return min(products), max(products)
+    # // and %: one sign of divisor at a time (dividing by zero raises instead)
+    divisors = [(low, high) for low, high in ((b_low, min(b_high, -1)), (max(b_low, 1), b_high)) if low <= high]
+    if not divisors:
+        return 0, 0
+    if op == "//":
+        # Monotonic in each operand for divisors of one sign: the corners are the extremes
+        quotients = [x // y for low, high in divisors for x in a for y in (low, high)]
+        return min(quotients), max(quotients)
+    # The remainder has the divisor's sign, is smaller than it and no larger than the dividend
+    remainders = []
+    for low, high in divisors:
+        if low > 0:
+            remainders.append((0, min(high - 1, a_high) if a_low >= 0 else high - 1))
+        else:
+            remainders.append((max(low + 1, a_low) if a_high <= 0 else low + 1, 0))
+    return min(r[0] for r in remainders), max(r[1] for r in remainders)
+
+
+def expr_type(
+    node: AstNode,
+    lookup: Callable[[str], Optional[str]],
+    calls: Optional[Callable[[str, List[Optional[str]]], Optional[str]]] = None,
+) -> Optional[str]:
+    """
+    Static type of an expression.
+    Args:
+            node: Expression node
+            lookup: Maps an identifier to its type (None while still unknown)
+            calls: Optional return type of a user function for given argument
+                   types (see FunctionSpecializer); user calls are DYNAMIC without it
+    Returns:
+            One of INT (an IntRange), FLOAT, BOOL, DYNAMIC, or None if it
+            depends on a local whose type is not known yet. An int operation
+            that could overflow a long long is DYNAMIC.
+    """
+    if isinstance(node, LiteralExpr):
+        v = node.value
+        if isinstance(v, bool):
+            return BOOL
+        if isinstance(v, int):
+            return _int_type(v, v)
+        if isinstance(v, float):
+            return FLOAT
+        return DYNAMIC
+
+    if isinstance(node, Identifier):
+        return lookup(node.name)
+
+    if isinstance(node, UnaryExpr):
+        operand = expr_type(node.operand, lookup, calls)
+        if operand not in NATIVE_TYPES:
+            return operand
+        if node.op in ("-", "MINUS"):
+            if operand == FLOAT:
+                return FLOAT
+            low, high = int_bounds(operand)
+            return _int_type(-high, -low)
+        if node.op in ("not", "!", "NOT"):
+            return BOOL
+        return DYNAMIC
+
+    if isinstance(node, (BinaryExpr, ComparisonExpr)):
+        left = expr_type(node.left, lookup, calls)
+        right = expr_type(node.right, lookup, calls)
+        if node.op not in _ARITHMETIC_OPS + _COMPARISON_OPS + ("and", "or"):
+            return DYNAMIC
+        if DYNAMIC in (left, right):
+            return DYNAMIC
+        if left is None or right is None:
+            return None
+        if node.op in _COMPARISON_OPS or node.op in ("and", "or"):
+            return BOOL
+        if node.op == "/" or FLOAT in (left, right):
+            return FLOAT
+        return _int_type(*_arithmetic_bounds(node.op, int_bounds(left), int_bounds(right)))
+
+    if isinstance(node, CallExpr) and isinstance(node.callee, Identifier):
+        return _call_type(node.callee.name, node.args, lookup, calls)
+
+    return DYNAMIC
+
+
+BUILTIN_FUNCTIONS = (
+    "print", "len", "range", "str", "int", "float", "bool", "abs", "min", "max",
+    "sum", "sorted", "type", "input", "set", "list", "next", "parallel_map",
+    "save", "load",
+)
+
+
+def _call_type(name: str, args: List[AstNode], lookup, calls) -> Optional[str]:
+    arg_types = [expr_type(a, lookup, calls) for a in args]
+    if None in arg_types:
+        return None
+    if name not in BUILTIN_FUNCTIONS:
+        # A clone's int result can be any 64-bit value
+        return plain_type(calls(name, arg_types)) if calls is not None else DYNAMIC
+    if name == "int" and len(args) == 1:
+        # int() of a str, float or big int may not fit int64, so only ints stay native
+        bounds = int_bounds(arg_types[0])
+        return _int_type(*bounds) if bounds is not None else DYNAMIC
+    if name in ("float", "bool") and len(args) == 1:
+        return {"float": FLOAT, "bool": BOOL}[name]
+    if name == "len" and arg_types == [DYNAMIC]:
+        return IntRange(0, INT64_MAX)
+    if name == "abs" and len(args) == 1 and arg_types[0] in NATIVE_TYPES:
+        if arg_types[0] == FLOAT:
+            return FLOAT
+        low, high = int_bounds(arg_types[0])
+        if low >= 0:
+            return _int_type(low, high)
+        if high <= 0:
+            return _int_type(-high, -low)
+        return _int_type(0, max(-low, high))
+    if name in ("min", "max") and len(args) == 2:
+        if arg_types[0] == arg_types[1] and arg_types[0] in NATIVE_TYPES:
+            if arg_types[0] != INT:
+                return arg_types[0]
+            pick = min if name == "min" else max
+            (a_low, a_high), (b_low, b_high) = int_bounds(arg_types[0]), int_bounds(arg_types[1])
+            return IntRange(pick(a_low, b_low), pick(a_high, b_high))
+    return DYNAMIC
+
+
+def range_loop_bounds(node: For) -> Optional[Tuple[AstNode, AstNode, int]]:
+    """
+    Recognize `for x in range(...)` with a literal (or omitted) step.
+    Returns:
+            (start, stop, step) with start None when omitted, or None if the
+            loop is not a counting loop over range().
+    """
+    it = node.iterable
+    if not isinstance(node.target, Identifier):
+        return None
+    if not (isinstance(it, CallExpr) and isinstance(it.callee, Identifier)):
+        return None
+    if it.callee.name != "range" or not 1 <= len(it.args) <= 3:
+        return None
+    if len(it.args) == 1:
+        return None, it.args[0], 1
+    step = 1
+    if len(it.args) == 3:
+        step = _literal_int(it.args[2])
+        if not step:
+            return None
+    return it.args[0], it.args[1], step
+
+
+def appended_lists(loop) -> List[str]:
+    """
+    Lists a loop appends to exactly once per iteration: `name.append(...)`
+    statements at the top level of a body that cannot end an iteration early
+    (no break, continue or return at any depth) and never rebinds name.
+    Generated code reserves their capacity before a loop with a known trip count.
+    """
+    statements = _block_statements(loop.body)
+    nodes = list(iter_nodes(statements))
+    if any(isinstance(n, (Break, Continue, Return)) for n in nodes):
+        return []
+    names = []
+    for stmt in statements:
+        call = stmt.value if isinstance(stmt, ExprStmt) else None
+        if (
+            isinstance(call, CallExpr)
+            and isinstance(call.callee, Attribute)
+            and call.callee.attr == "append"
+            and isinstance(call.callee.value, Identifier)
+        ):
+            names.append(call.callee.value.name)
+    assigned = _assigned_names(nodes)
+    return [n for n in dict.fromkeys(names) if n not in assigned and names.count(n) == 1]
+
+
+def _assigned_names(nodes) -> Set[str]:
+    names = {n.target.name for n in nodes if isinstance(n, Assign) and isinstance(n.target, Identifier)}
+    names |= {name for n in nodes if isinstance(n, For) for name in loop_target_names(n)}
+    return names
+
+
+def loop_target_names(node: For) -> List[str]:
+    """Names bound by a for loop: x, or each of k, v."""
+    if isinstance(node.target, TupleExpr):
+        return [e.name for e in node.target.elements]
+    return [node.target.name] if isinstance(node.target, Identifier) else []
+
+
+def string_append_operands(name: str, value: AstNode) -> Optional[List[AstNode]]:
+    """
+    Operands of `name += "a" + b + c`, left to right, when the sum is a string
+    concatenation: it starts with a string literal or a str() call, so every
+    partial sum is a string and appending the operands one by one builds the
+    same text without a temporary for the sum. None for other values, and
+    when an operand reads name, which would see the earlier appends.
+    """
+    operands = []
+    node = value
+    while isinstance(node, BinaryExpr) and node.op == "+":
+        operands.insert(0, node.right)
+        node = node.left
+    if not operands:
+        return None
+    operands.insert(0, node)
+    starts_string = (isinstance(node, LiteralExpr) and isinstance(node.value, str)) or (
+        isinstance(node, CallExpr) and isinstance(node.callee, Identifier) and node.callee.name == "str"
+    )
+    if not starts_string or any(name in _names(operand) for operand in operands):
+        return None
+    return operands
+
+
+def is_pure(node: AstNode) -> bool:
+    """An expression that can be evaluated twice: names, literals, arithmetic, len() and range()."""
+    if isinstance(node, (Identifier, LiteralExpr)):
+        return True
+    if isinstance(node, UnaryExpr):
+        return is_pure(node.operand)
+    if isinstance(node, BinaryExpr):
+        return node.op in _ARITHMETIC_OPS and is_pure(node.left) and is_pure(node.right)
+    if isinstance(node, CallExpr) and isinstance(node.callee, Identifier):
+        return node.callee.name in ("len", "range") and all(is_pure(a) for a in node.args)
+    return False
+
+
+def while_loop_span(node: While) -> Optional[Tuple[AstNode, AstNode, int]]:
+    """
+    Recognize a counting while loop: `while i < n` (or <=) whose body steps
+    `i = i + 1` once at its top level, or `while i > n` (or >=) stepping
+    `i = i - 1`, with a bound the body does not assign.
+    Returns:
+            (low, high, inclusive): the loop runs max(0, high - low + inclusive)
+            times; None if it is not such a loop.
+    """
+    cond = node.cond
+    if not (isinstance(cond, ComparisonExpr) and isinstance(cond.left, Identifier)):
+        return None
+    if cond.op not in ("<", "<=", ">", ">=") or not is_pure(cond.right):
+        return None
+    name = cond.left.name
+    upward = cond.op in ("<", "<=")
+    step_op = "+" if upward else "-"
+
+    statements = _block_statements(node.body)
+    nodes = list(iter_nodes(statements))
+    steps = [s for s in nodes if isinstance(s, Assign) and isinstance(s.target, Identifier) and s.target.name == name]
+    if len(steps) != 1 or not any(s is steps[0] for s in statements):
+        return None
+    step = steps[0]
+    stepped = (step.op == step_op + "=" and _literal_int(step.value) == 1) or (
+        step.op == "="
+        and isinstance(step.value, BinaryExpr)
+        and step.value.op == step_op
+        and isinstance(step.value.left, Identifier)
+        and step.value.left.name == name
+        and _literal_int(step.value.right) == 1
+    )
+    if not stepped or _names(cond.right) & _assigned_names(nodes):
+        return None
+    inclusive = 1 if cond.op in ("<=", ">=") else 0
+    return (cond.left, cond.right, inclusive) if upward else (cond.right, cond.left, inclusive)
+
+
+def guard_narrowing(statements: List[AstNode], params, lookup) -> Dict[int, Tuple[str, str]]:
+    """
+    Int parameters narrowed by early-return guards: at the top level of a
+    body, `if n < 2: return n` (an if without elif or else whose body always
+    returns, comparing an int parameter with an int literal) means the
+    statements after it only run with n >= 2, as long as none rebinds n.
+    Args:
+            statements: Top-level statements of a function body
+            params: Parameter names
+            lookup: Type of a name
+    Returns:
+            Statement index -> (parameter, narrowed type) from the next statement on
+    """
+    narrowed: Dict[str, str] = {}
+    guards = {}
+    for index, stmt in enumerate(statements):
+        if not (isinstance(stmt, If) and not stmt.elifs and stmt.orelse is None):
+            continue
+        cond = stmt.cond
+        if not (isinstance(cond, ComparisonExpr) and isinstance(cond.left, Identifier)):
+            continue
+        name, limit = cond.left.name, _literal_int(cond.right)
+        if name not in params or limit is None or lookup(name) != INT:
+            continue
+        if not always_returns(_block_statements(stmt.body)):
+            continue
+        if name in _rebound_names(statements[index + 1:]):
+            continue
+        low, high = int_bounds(narrowed.get(name) or lookup(name))
+        if cond.op == "<":
+            low = max(low, limit)
+        elif cond.op == "<=":
+            low = max(low, limit + 1)
+        elif cond.op == ">":
+            high = min(high, limit)
+        elif cond.op == ">=":
+            high = min(high, limit - 1)
+        else:
+            continue
+        if low <= high:
+            narrowed[name] = IntRange(low, high)
+            guards[index] = (name, narrowed[name])
+    return guards
+
+
+def guarded_statements(statements: List[AstNode], params, lookup):
+    """Each top-level statement with the lookup that holds for it (see guard_narrowing)."""
+    guards = guard_narrowing(statements, params, lookup)
+    narrowed: Dict[str, str] = {}
+    for index, stmt in enumerate(statements):
+        facts = dict(narrowed)
+        yield stmt, (lambda name, facts=facts: facts[name] if name in facts else lookup(name))
+        if index in guards:
+            name, t = guards[index]
+            narrowed[name] = t
+
+
+def function_body(node: FunctionDef) -> List[AstNode]:
+    """Statements of a function body, whether stored as a list or a Block."""
+    body = node.body.statements if hasattr(node.body, "statements") else node.body
+    return body if isinstance(body, list) else [body]
+
+
+def is_generator(node: FunctionDef) -> bool:
+    """True when the function body yields, making every call a generator."""
+    return any(isinstance(n, Yield) for n in iter_nodes(function_body(node)))
+
+
+def always_returns(statements: List[AstNode]) -> bool:
+    """True when control can never fall off the end of the statements."""
+    for stmt in statements:
+        if isinstance(stmt, Return):
+            return True
+        if isinstance(stmt, If) and stmt.orelse is not None:
+            branches = [stmt.body] + [b for _, b in stmt.elifs] + [stmt.orelse]
+            if all(always_returns(_block_statements(b)) for b in branches):
+                return True
+    return False
+
+
+# Builtins and methods that exhaust an iterable argument before they return
+_EAGER_CONSUMERS = {"all", "any", "dict", "list", "max", "min", "set", "sorted", "sum", "tuple"}
+_EAGER_METHODS = {"extend", "join", "update"}
+
+
+def rebound_after_creation(statements: List[AstNode]) -> Dict[int, Set[str]]:
+    """
+    Names each generator expression (by id) may see rebound while it is
+    alive: assigned by the statement creating it, by a later statement of an
+    enclosing block or by any statement of an enclosing loop (the next
+    iteration). A generator expression exhausted where it is created
+    (`sum(x * k for x in xs)`) sees none; one iterated by a for loop only
+    sees what that loop assigns. Function bodies are scopes of their own.
+    """
+    consumed = set()
+    for node in iter_nodes(statements):
+        if isinstance(node, CallExpr) and len(node.args) == 1 and isinstance(node.args[0], GeneratorExpr):
+            callee = node.callee
+            if (isinstance(callee, Identifier) and callee.name in _EAGER_CONSUMERS) or (
+                isinstance(callee, Attribute) and callee.attr in _EAGER_METHODS
+            ):
+                consumed.add(id(node.args[0]))
+    rebound: Dict[int, Set[str]] = {}
+
+    def visit(stmts, later: Set[str]):
+        for index, stmt in enumerate(stmts):
+            if isinstance(stmt, FunctionDef):
+                visit(function_body(stmt), set())
+                continue
+            after = later | _rebound_names(stmts[index + 1:])
+            if isinstance(stmt, For) and isinstance(stmt.iterable, GeneratorExpr):
+                rebound.setdefault(id(stmt.iterable), _rebound_names(stmt))
+            if isinstance(stmt, (While, For)):
+                after |= _rebound_names(stmt)
+            blocks = [stmt] if isinstance(stmt, Block) else []
+            if isinstance(stmt, If):
+                blocks = [stmt.body] + [b for _, b in stmt.elifs] + [stmt.orelse]
+            elif isinstance(stmt, (While, For)):
+                blocks = [stmt.body]
+            for block in blocks:
+                if block is not None:
+                    visit(_block_statements(block), after)
+            # Conditions, iterables and simple statements: inner blocks were registered above
+            own = after | _rebound_names(stmt)
+            for node in iter_nodes(stmt):
+                if isinstance(node, GeneratorExpr):
+                    rebound.setdefault(id(node), set() if id(node) in consumed else own)
+
+    visit(statements, set())
+    return rebound
+
+
+def tuple_concatenations(statements: List[AstNode]) -> Set[int]:
+    """
+    `x += value` statements (by id) whose target may hold a tuple: it is
+    assigned a tuple display, a tuple() call or another such name, possibly
+    concatenated or repeated. Tuples are lists at runtime, so these rebind x
+    to the sum instead of extending a list that `y = x` aliases share.
+    """
+    assigns = [n for n in iter_nodes(statements) if isinstance(n, Assign) and isinstance(n.target, Identifier)]
+    names: Set[str] = set()
+    changed = True
+    while changed:
+        changed = False
+        for node in assigns:
+            if node.target.name not in names and _may_be_tuple(node.value, names):
+                names.add(node.target.name)
+                changed = True
+    return {id(n) for n in assigns if n.op == "+=" and n.target.name in names}
+
+
+def _may_be_tuple(node: AstNode, names: Set[str]) -> bool:
+    if isinstance(node, TupleExpr):
+        return True
+    if isinstance(node, Identifier):
+        return node.name in names
+    if isinstance(node, CallExpr):
+        return isinstance(node.callee, Identifier) and node.callee.name == "tuple"
+    if isinstance(node, BinaryExpr) and node.op in ("+", "*"):
+        return _may_be_tuple(node.left, names) or _may_be_tuple(node.right, names)
+    return False
+
+
+def _rebound_names(nodes) -> Set[str]:
+    """Names bound by any assignment (including unpacking) or loop in the nodes."""
+    nodes = list(iter_nodes(nodes))
+    return _assigned_names(nodes) | {name for n in nodes if isinstance(n, Assign) for name in _target_names(n.target)}
+
+
+def _target_names(target: AstNode) -> Set[str]:
+    if isinstance(target, Identifier):
+        return {target.name}
+    if isinstance(target, TupleExpr):
+        return {name for e in target.elements for name in _target_names(e)}
+    return set()
+
+
+def _block_statements(block) -> List[AstNode]:
+    return block.statements if hasattr(block, "statements") else list(block or [])
+
+
+def _walk_statements(statements, kind):
+    """Yield nested statements of the given kind (not descending into expressions)."""
+    for stmt in statements:
+        if isinstance(stmt, kind):
+            yield stmt
+        if isinstance(stmt, Block):
+            yield from _walk_statements(stmt.statements, kind)
+        elif isinstance(stmt, If):
+            yield from _walk_statements(_block_statements(stmt.body), kind)
+            for _, elif_body in stmt.elifs:
+                yield from _walk_statements(_block_statements(elif_body), kind)
+            if stmt.orelse is not None:
+                yield from _walk_statements(_block_statements(stmt.orelse), kind)
+        elif isinstance(stmt, (While, For)):
+            yield from _walk_statements(_block_statements(stmt.body), kind)
+
+
+def iter_nodes(value):
+    """Every AST node reachable from a node or a list/tuple of nodes."""
+    if isinstance(value, AstNode):
+        yield value
+        for child in vars(value).values():
+            yield from iter_nodes(child)
+    elif isinstance(value, (list, tuple)):
+        for item in value:
+            yield from iter_nodes(item)
+
+
+def _names(node: AstNode) -> Set[str]:
+    return {n.name for n in iter_nodes(node) if isinstance(n, Identifier)}
+
+
+def _is_user_call(node: AstNode) -> bool:
+    return (
+        isinstance(node, CallExpr)
+        and isinstance(node.callee, Identifier)
+        and node.callee.name not in BUILTIN_FUNCTIONS
+    )
+
+
+def _literal_int(node: AstNode) -> Optional[int]:
+    if isinstance(node, LiteralExpr) and type(node.value) is int:
+        return node.value
+    if (
+        isinstance(node, UnaryExpr)
+        and node.op in ("-", "MINUS")
+        and isinstance(node.operand, LiteralExpr)
+        and type(node.operand.value) is int
+    ):
+        return -node.operand.value
+    return None
+
+
+class _Assignment(NamedTuple):
+    """One assignment of a local, as collected for the fixed point."""
+
+    name: str
+    # Assigned value (x op y for x op= y)
+    value: AstNode
+    # Enclosing loops, outermost first
+    loops: Tuple[AstNode, ...]
+    # (1 or -1, e) for x = x + e / x += e / x = x - e / x -= e, e not reading x
+    increment: Optional[Tuple[int, AstNode]]
+    # (bound, inclusive, upward) for the step of a counting while loop
+    step: Optional[Tuple[AstNode, int, bool]]
+    # Types of names where the assignment is (see guarded_statements)
+    lookup: Callable[[str], Optional[str]]
+
+
+def _increment(name: str, value: AstNode) -> Optional[Tuple[int, AstNode]]:
+    if not (isinstance(value, BinaryExpr) and value.op in ("+", "-")):
+        return None
+    sign = 1 if value.op == "+" else -1
+    if isinstance(value.left, Identifier) and value.left.name == name and name not in _names(value.right):
+        return sign, value.right
+    if sign > 0 and isinstance(value.right, Identifier) and value.right.name == name and name not in _names(value.left):
+        return sign, value.left
+    return None
+
+
+class TypeInference:
+    """Infers native C++ types for the locals of a single function."""
+
+    def infer_function(
+        self,
+        node: FunctionDef,
+        param_types: Optional[Dict[str, str]] = None,
+        calls=None,
+    ) -> Optional[Dict[str, str]]:
+        """
+        Args:
+                node: Function definition
+                param_types: Types assumed for the parameters (a typed clone);
+                             parameters are DynamicType when omitted
+                calls: Return types of specialized user functions (see expr_type)
+        Returns:
+                Dict mapping each monomorphic local, and each native parameter,
+                to its native C++ type. None if the body assigns a parameter a
+                value that contradicts param_types.
+        """
+        params = [p.name if isinstance(p, Identifier) else str(p) for p in node.params]
+        param_types = dict(param_types or {})
+        types = self._infer(function_body(node), calls, params, param_types)
+        if types is None:
+            return None
+        return {name: t for name, t in types.items() if t in NATIVE_TYPES}
+
+    def infer_statements(self, statements: List[AstNode], calls=None) -> Dict[str, str]:
+        """Types of the variables assigned by a list of statements (e.g. module level)."""
+        types = self._infer(statements, calls, [], {})
+        return {name: t for name, t in types.items() if t in NATIVE_TYPES}
+
+    def return_type(self, node: FunctionDef, types: Dict[str, str], calls=None) -> Optional[str]:
+        """
+        Join of the types of every returned value given the locals' types.
+        DYNAMIC if some path returns None (bare return or falling off the end).
+        """
+        body = function_body(node)
+
+        def lookup(name: str) -> Optional[str]:
+            return types.get(name, DYNAMIC)
+
+        params = [p.name if isinstance(p, Identifier) else str(p) for p in node.params]
+        result = None if always_returns(body) else DYNAMIC
+        for stmt, guarded in guarded_statements(body, params, lookup):
+            for ret in _walk_statements([stmt], Return):
+                # e.g. fib(n - 1) + fib(n - 2) is DYNAMIC: two clone results can overflow
+                value_type = DYNAMIC if ret.value is None else expr_type(ret.value, guarded, calls)
+                result = _join(result, value_type)
+        return plain_type(result)
+
+    def _infer(self, body, calls, params, param_types) -> Optional[Dict[str, Optional[str]]]:
+        self._assignments: List[_Assignment] = []
+        self._range_loops: List[Tuple[For, Callable]] = []
+        self._pinned: Dict[str, str] = {}
+        # Counting while loops (see while_loop_span) and their counter steps, by id
+        self._counting_loops: Dict[int, Tuple[AstNode, AstNode, int]] = {}
+        self._steps: Dict[int, Tuple[AstNode, int, bool]] = {}
+        self._loops: List[AstNode] = []
+
+        # Every round recomputes a local from these starting types and its assignments
+        seeds = {n: plain_type(t) for n, t in param_types.items() if t in NATIVE_TYPES}
+        types: Dict[str, Optional[str]] = dict(seeds)
+
+        def lookup(name: str) -> Optional[str]:
+            return types[name] if name in types else DYNAMIC
+
+        # Assignments and loops are evaluated with the parameter ranges that hold where they are
+        for stmt, self._lookup in guarded_statements(body, params, lookup):
+            self._collect(stmt)
+
+        for name in [a.name for a in self._assignments] + [loop.target.name for loop, _ in self._range_loops]:
+            if name not in params:
+                types.setdefault(name, None)
+        seeds.update({n: t for n, t in self._pinned.items() if n in types})
+        types.update(seeds)
+
+        self._fixpoint(types, seeds, calls)
+
+        for name, t in param_types.items():
+            if t in NATIVE_TYPES and types.get(name) != t:
+                return None
+        return types
+
+    def _fixpoint(self, types, seeds, calls):
+        by_name: Dict[str, List[_Assignment]] = {}
+        for assignment in self._assignments:
+            by_name.setdefault(assignment.name, []).append(assignment)
+        loops_by_name: Dict[str, List[Tuple[For, Callable]]] = {}
+        for loop, lookup in self._range_loops:
+            loops_by_name.setdefault(loop.target.name, []).append((loop, lookup))
+
+        widened: Dict[str, int] = {}
+        changed = True
+        while changed:
+            changed = False
+            for name in types:
+                new = seeds.get(name)
+                for loop, lookup in loops_by_name.get(name, []):
+                    new = _join(new, self._counter_type(loop, lookup, calls))
+                new = self._assigned_type(name, new, by_name.get(name, []), types, calls)
+                if _same_type(new, types[name]):
+                    continue
+                widened[name] = widened.get(name, 0) + 1
+                if widened[name] > _WIDEN_AFTER:
+                    # Still growing: no bound that fits a long long is in sight
+                    seeds[name] = new = DYNAMIC
+                types[name] = new
+                changed = True
+
+    def _assigned_type(self, name, new, assignments, types, calls) -> Optional[str]:
+        """Join of a local's assignments, with increments bounded by their execution counts."""
+        low_growth = high_growth = 0
+        incremented = False
+        for assignment in assignments:
+            lookup = assignment.lookup
+            if assignment.step is not None:
+                step_type = self._step_type(assignment.step, types[name], lookup, calls)
+                if step_type is not None:
+                    new = _join(new, step_type)
+                    continue
+            if assignment.increment is not None:
+                sign, addend = assignment.increment
+                bounds = int_bounds(expr_type(addend, lookup, calls))
+                count = self._executions(assignment.loops, lookup, calls)
+                if bounds is not None and count is not None:
+                    low, high = bounds if sign > 0 else (-bounds[1], -bounds[0])
+                    low_growth += count * min(0, low)
+                    high_growth += count * max(0, high)
+                    incremented = True
+                    continue
+            new = _join(new, expr_type(assignment.value, lookup, calls))
+        if not incremented or new is None or new == FLOAT:
+            return new
+        if new != INT:
+            return DYNAMIC
+        low, high = int_bounds(new)
+        return _int_type(low + low_growth, high + high_growth)
+
+    def _counter_type(self, loop: For, lookup, calls) -> Optional[str]:
+        """Values of the counter of a range loop: from its start to just before its stop."""
+        start, stop, step = range_loop_bounds(loop)
+        start_type = IntRange(0, 0) if start is None else expr_type(start, lookup, calls)
+        stop_type = expr_type(stop, lookup, calls)
+        if FLOAT in (start_type, stop_type):
+            return DYNAMIC
+        if start_type is None or stop_type is None:
+            return None
+        # Bounds that are not native ints are converted to long long (or raise)
+        start_low, start_high = int_bounds(start_type) or (INT64_MIN, INT64_MAX)
+        stop_low, stop_high = int_bounds(stop_type) or (INT64_MIN, INT64_MAX)
+        if step > 0:
+            return IntRange(start_low, max(start_low, stop_high - 1))
+        return IntRange(min(start_high, stop_low + 1), start_high)
+
+    def _step_type(self, step, counter: Optional[str], lookup, calls) -> Optional[str]:
+        """
+        Values of `i = i + 1` in a counting `while i < n` loop: it only runs
+        while i is below n, so it never passes n (n + 1 for <=). None when
+        the counter or bound is not a native int.
+        """
+        bound, inclusive, upward = step
+        counter_bounds = int_bounds(counter)
+        bound_bounds = int_bounds(expr_type(bound, lookup, calls))
+        if counter_bounds is None or bound_bounds is None:
+            return None
+        if upward:
+            return _int_type(counter_bounds[0] + 1, max(counter_bounds[0] + 1, bound_bounds[1] + inclusive))
+        return _int_type(min(counter_bounds[1] - 1, bound_bounds[0] - inclusive), counter_bounds[1] - 1)
+
+    def _executions(self, loops, lookup, calls) -> Optional[int]:
+        """Most times a statement inside these nested loops runs per call; None if unbounded."""
+        count = 1
+        for loop in loops:
+            trips = self._trip_count(loop, lookup, calls)
+            if trips is None:
+                return None
+            count *= trips
+        return count
+
+    def _trip_count(self, loop, lookup, calls) -> Optional[int]:
+        if isinstance(loop, For):
+            bounds = range_loop_bounds(loop) if isinstance(loop.target, Identifier) else None
+            if bounds is None:
+                # Lists can grow while they are iterated, and generators never end
+                return None
+            start, stop, step = bounds
+            start_bounds = (0, 0) if start is None else int_bounds(expr_type(start, lookup, calls))
+            stop_bounds = int_bounds(expr_type(stop, lookup, calls))
+            start_low, start_high = start_bounds or (INT64_MIN, INT64_MAX)
+            stop_low, stop_high = stop_bounds or (INT64_MIN, INT64_MAX)
+            span = stop_high - start_low if step > 0 else start_high - stop_low
+            return max(0, -(-span // abs(step)))
+        span = self._counting_loops.get(id(loop))
+        if span is None:
+            return None
+        low, high, inclusive = span
+        low_bounds = int_bounds(expr_type(low, lookup, calls))
+        high_bounds = int_bounds(expr_type(high, lookup, calls))
+        if low_bounds is None or high_bounds is None:
+            return None
+        return max(0, high_bounds[1] - low_bounds[0] + inclusive)
+
+    # ---------- Collection ----------
+    def _collect(self, stmt: AstNode):
+        if isinstance(stmt, Assign) and isinstance(stmt.target, Identifier):
+            name = stmt.target.name
+            if stmt.op == "=":
+                value = stmt.value
+            elif stmt.op in _AUGMENTED_OPS:
+                value = BinaryExpr(left=stmt.target, op=_AUGMENTED_OPS[stmt.op], right=stmt.value)
+            else:
+                self._pinned[name] = DYNAMIC
+                return
+            self._assignments.append(
+                _Assignment(
+                    name, value, tuple(self._loops), _increment(name, value), self._steps.get(id(stmt)), self._lookup
+                )
+            )
+        elif isinstance(stmt, Block):
+            for s in stmt.statements:
+                self._collect(s)
+        elif isinstance(stmt, If):
+            self._collect(stmt.body)
+            for _, elif_body in getattr(stmt, "elifs", []):
+                self._collect(elif_body)
+            if getattr(stmt, "orelse", None):
+                self._collect(stmt.orelse)
+        elif isinstance(stmt, While):
+            self._collect_while(stmt)
+        elif isinstance(stmt, For):
+            self._collect_for(stmt)
+
+    def _collect_while(self, stmt: While):
+        span = while_loop_span(stmt)
+        statements = _block_statements(stmt.body)
+        # continue could skip the step, so such a loop may run forever
+        if span is not None and not any(isinstance(n, Continue) for n in iter_nodes(statements)):
+            self._counting_loops[id(stmt)] = span
+            counter = stmt.cond.left.name
+            step = next(s for s in statements if isinstance(s, Assign) and isinstance(s.target, Identifier)
+                        and s.target.name == counter)
+            self._steps[id(step)] = (stmt.cond.right, 1 if stmt.cond.op in ("<=", ">=") else 0, stmt.cond.op in ("<", "<="))
+        self._loops.append(stmt)
+        self._collect(stmt.body)
+        self._loops.pop()
+
+    def _collect_for(self, stmt: For):
+        self._loops.append(stmt)
+        try:
+            if not isinstance(stmt.target, Identifier):
+                # Unpacked targets are assigned DynamicType elements
+                for name in loop_target_names(stmt):
+                    self._pinned[name] = DYNAMIC
+                self._collect(stmt.body)
+                return
+            name = stmt.target.name
+            before = len(self._assignments)
+            self._collect(stmt.body)
+        finally:
+            self._loops.pop()
+        rebound_in_body = any(a.name == name for a in self._assignments[before:])
+        if range_loop_bounds(stmt) is not None and not rebound_in_body:
+            self._range_loops.append((stmt, self._lookup))
+        else:
+            # Generic iteration yields DynamicType elements
+            self._pinned[name] = DYNAMIC
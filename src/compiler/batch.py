@@ -0,0 +1,156 @@
+"""
+Batch Build
+-----------
+This module transpiles and compiles many scripts in one run.
+
+Key Features:
+- Takes a directory (every .py/.flpy file below it) or a manifest listing the
+  scripts, one path per line.
+- Transpiles in this process with a single Transpiler, so the parser tables
+  are built once, then compiles through a pool of jobs sized to the cores.
+- The runtime objects are compiled once, up front, and shared by every
+  executable through the BuildCache.
+- Reports the transpile and compile time of every file.
+"""
+
+import csv
+import os
+import time
+from concurrent.futures import ThreadPoolExecutor
+from dataclasses import dataclass
+from pathlib import Path
+from typing import List, Optional
+
+from .build_cache import RUNTIME_DIR, RUNTIME_SOURCES
+from .transpiler import Transpiler
+
+SOURCE_SUFFIXES = (".py", ".flpy")
+
+
+@dataclass
+class BatchResult:
+    """Outcome of one script; error is None when it transpiled and compiled"""
+
+    source: Path
+    cpp_file: Path
+    executable: Optional[Path] = None
+    transpile_ms: float = 0.0
+    compile_ms: float = 0.0
+    error: Optional[str] = None
+
+
+def collect_sources(target) -> List[Path]:
+    """Scripts of a directory (recursively, sorted) or of a manifest file; '#' starts a comment"""
+    target = Path(target)
+    if target.is_dir():
+        return sorted(p for p in target.rglob("*") if p.suffix in SOURCE_SUFFIXES and p.is_file())
+
+    sources = []
+    with open(target, "r", encoding="utf-8") as f:
+        for line in f:
+            line = line.split("#", 1)[0].strip()
+            if line:
+                # Relative entries are relative to the manifest
+                sources.append(target.parent / line)
+    return sources
+
+
+def _relative_name(source, root):
+    """Output name of source: its path below root, or just its file name"""
+    try:
+        return source.resolve().relative_to(root.resolve())
+    except ValueError:
+        return Path(source.name)
+
+
+def build_all(sources, output_dir, cache, cxx="g++", flags=(), jobs=None, compile=True,
+              profile=False, root=None) -> List[BatchResult]:
+    """
+    Transpile every source into output_dir and compile the results in parallel.
+
+    Args:
+        sources: Script paths
+        output_dir: Receives <name>.cpp and <name>.exe, keeping the layout below root
+        cache: BuildCache for the C++, the objects and the executables
+        cxx: Compiler command
+        flags: Compiler flags; the runtime include directory is added
+        jobs: Parallel compilations (default: one per core)
+        compile: False to only transpile
+        profile: Emit per-function profiling timers
+        root: Directory the output layout is relative to (default: none, flat)
+
+    Returns:
+        List[BatchResult]: One result per source, in the order given
+    """
+    output_dir = Path(output_dir)
+    root = Path(root) if root is not None else None
+    flags = [*flags, "-I", str(RUNTIME_DIR)]
+    transpiler = Transpiler(profile=profile, cache=cache)
+
+    results = []
+    for source in sources:
+        name = _relative_name(Path(source), root) if root is not None else Path(Path(source).name)
+        result = BatchResult(Path(source), output_dir / name.with_suffix(".cpp"))
+        result.cpp_file.parent.mkdir(parents=True, exist_ok=True)
+        start = time.perf_counter()
+        try:
+            with open(source, "r", encoding="utf-8") as f:
+                transpiler.transpile(f.read(), str(result.cpp_file))
+            if transpiler.errors:
+                result.error = "transpilation failed: " + "; ".join(
+                    f"{e.message} at line {e.line}" for e in transpiler.errors)
+        except Exception as e:  # one broken script must not stop the batch
+            result.error = f"transpilation failed: {e}"
+        result.transpile_ms = (time.perf_counter() - start) * 1000
+        results.append(result)
+
+    if not compile:
+        return results
+
+    with ThreadPoolExecutor(max_workers=jobs or os.cpu_count() or 1) as pool:
+        # Shared runtime objects first, so the scripts' compilations only hit them
+        for runtime in pool.map(lambda s: cache.compile_object(cxx, flags, s), RUNTIME_SOURCES):
+            if runtime.returncode != 0:
+                message = f"runtime compilation failed: {runtime.stderr.decode(errors='replace')}"
+                for result in results:
+                    result.error = result.error or message
+                return results
+
+        def compile_one(result):
+            if result.error is not None:
+                return
+            executable = result.cpp_file.with_suffix(".exe")
+            start = time.perf_counter()
+            compiled = cache.compile(cxx, flags, [str(result.cpp_file), *map(str, RUNTIME_SOURCES)], str(executable))
+            result.compile_ms = (time.perf_counter() - start) * 1000
+            if compiled.returncode != 0:
+                result.error = f"compilation failed: {compiled.stderr.decode(errors='replace')}"
+            else:
+                result.executable = executable
+
+        list(pool.map(compile_one, results))
+    return results
+
+
+def print_report(results, elapsed_s):
+    """Per-file timings and a summary"""
+    width = max((len(str(r.source)) for r in results), default=0)
+    for r in results:
+        status = "✓" if r.error is None else "✗"
+        print(f"  {status} {str(r.source):<{width}}  transpile {r.transpile_ms:8.1f} ms  compile {r.compile_ms:8.1f} ms")
+        if r.error is not None:
+            print(f"      {r.error.strip()}")
+
+    failed = sum(1 for r in results if r.error is not None)
+    busy_s = sum(r.transpile_ms + r.compile_ms for r in results) / 1000
+    print(f"{len(results) - failed} of {len(results)} scripts built in {elapsed_s:.2f} s ({busy_s:.2f} s of work)")
+
+
+def write_timings(results, path):
+    """The per-file timings as CSV"""
+    with open(path, "w", newline="", encoding="utf-8") as f:
+        writer = csv.writer(f)
+        writer.writerow(["source", "cpp_file", "executable", "transpile_ms", "compile_ms", "error"])
+        for r in results:
+            writer.writerow([r.source, r.cpp_file, r.executable or "", f"{r.transpile_ms:.3f}",
+                             f"{r.compile_ms:.3f}", (r.error or "").strip()])
@@ -0,0 +1,255 @@
+"""
+Build Cache
+-----------
+This module provides the BuildCache class, a content-addressed cache of the
+files the transpilation pipeline produces.
+
+Key Features:
+- Transpiled C++ is keyed on the Python source, the transpiler's own source
+  files and the code generation options, so a hit skips parsing entirely.
+- Object files and executables are keyed on the compiler identity, the
+  compiler flags, the source contents and the headers of the -I/-iquote
+  directories, so unchanged scripts are not recompiled and the runtime is
+  compiled once for every script built with the same flags.
+- Misses compile through an optional launcher such as ccache
+  (TRANSPYLER_COMPILER_LAUNCHER), which also shares objects between machines.
+
+Entries live under TRANSPYLER_CACHE_DIR (default ~/.cache/transpyler). They are
+written atomically, so concurrent builds can share a directory, and the
+directory can be deleted at any time.
+"""
+
+import hashlib
+import os
+import shlex
+import shutil
+import subprocess
+import tempfile
+from functools import lru_cache
+from pathlib import Path
+
+CACHE_DIR_ENV = "TRANSPYLER_CACHE_DIR"
+LAUNCHER_ENV = "TRANSPYLER_COMPILER_LAUNCHER"
+
+_SRC_ROOT = Path(__file__).resolve().parent.parent
+# Packages whose sources decide the generated C++; parsetab.py is derived from parser.py
+_TRANSPILER_PACKAGES = ("core", "lexer", "parser", "codegen", "compiler")
+_GENERATED_FILES = ("parsetab.py",)
+_HEADER_SUFFIXES = (".hpp", ".h")
+
+# The C++ runtime every transpiled program is linked with
+RUNTIME_DIR = _SRC_ROOT / "runtime" / "cpp"
+RUNTIME_SOURCES = tuple(RUNTIME_DIR / name for name in ("DynamicType.cpp", "BigInt.cpp", "builtins.cpp"))
+
+
+def default_cache_dir():
+    """TRANSPYLER_CACHE_DIR, else transpyler/ in the user's cache directory"""
+    configured = os.environ.get(CACHE_DIR_ENV)
+    if configured:
+        return Path(configured)
+    base = os.environ.get("XDG_CACHE_HOME") or Path.home() / ".cache"
+    return Path(base) / "transpyler"
+
+
+def _hash_files(digest, files):
+    for path in sorted(files):
+        digest.update(path.name.encode())
+        digest.update(b"\0")
+        digest.update(path.read_bytes())
+        digest.update(b"\0")
+
+
+@lru_cache(maxsize=None)
+def transpiler_version():
+    """Hash of the transpiler sources, so any change to them invalidates the C++ entries"""
+    digest = hashlib.sha256()
+    for package in _TRANSPILER_PACKAGES:
+        files = [p for p in (_SRC_ROOT / package).rglob("*.py") if p.name not in _GENERATED_FILES]
+        digest.update(package.encode())
+        _hash_files(digest, files)
+    return digest.hexdigest()
+
+
+@lru_cache(maxsize=None)
+def _compiler_identity(cxx):
+    """Resolved path and version banner of the compiler"""
+    command = shlex.split(cxx)
+    try:
+        result = subprocess.run([*command, "--version"], capture_output=True, check=False)
+        banner = result.stdout
+    except OSError:
+        banner = b""
+    return f"{shutil.which(command[0]) or command[0]}\n".encode() + banner
+
+
+@lru_cache(maxsize=None)
+def _headers_hash(directory):
+    digest = hashlib.sha256()
+    root = Path(directory)
+    if root.is_dir():
+        _hash_files(digest, [p for p in root.iterdir() if p.suffix in _HEADER_SUFFIXES])
+    return digest.digest()
+
+
+def _include_dirs(flags):
+    """Directories of the -I and -iquote flags, whose headers are part of every key"""
+    dirs = []
+    flags = list(flags)
+    for i, flag in enumerate(flags):
+        if flag in ("-I", "-iquote") and i + 1 < len(flags):
+            dirs.append(flags[i + 1])
+        elif flag.startswith("-I") and len(flag) > 2:
+            dirs.append(flag[2:])
+    return dirs
+
+
+class BuildCache:
+    def __init__(self, directory=None, launcher=None):
+        """
+        Initialize the cache.
+
+        Args:
+            directory: Cache directory (default_cache_dir() if None)
+            launcher: Command prefixed to compilations on a miss, e.g. "ccache"
+                      (TRANSPYLER_COMPILER_LAUNCHER if None)
+        """
+        self.directory = Path(directory) if directory else default_cache_dir()
+        if launcher is None:
+            launcher = os.environ.get(LAUNCHER_ENV, "")
+        self.launcher = shlex.split(launcher)
+
+    # ------------------------------------------------------------------
+    # Entries
+    # ------------------------------------------------------------------
+
+    def _entry(self, kind, key):
+        return self.directory / kind / key[:2] / key
+
+    def restore(self, kind, key, destination):
+        """Copy the entry to destination; returns False on a miss"""
+        entry = self._entry(kind, key)
+        if not entry.exists():
+            return False
+        # A fresh mtime, so make treats the restored file as newly built
+        shutil.copyfile(entry, destination)
+        shutil.copymode(entry, destination)
+        return True
+
+    def store(self, kind, key, path):
+        """Add path as the entry, replacing an existing one atomically"""
+        entry = self._entry(kind, key)
+        entry.parent.mkdir(parents=True, exist_ok=True)
+        fd, temp = tempfile.mkstemp(dir=entry.parent, prefix=".tmp-")
+        os.close(fd)
+        try:
+            shutil.copy2(path, temp)
+            os.replace(temp, entry)
+        except BaseException:
+            os.unlink(temp)
+            raise
+
+    # ------------------------------------------------------------------
+    # Keys
+    # ------------------------------------------------------------------
+
+    @staticmethod
+    def transpile_key(source_code, options=()):
+        """Key of the C++ generated from source_code with the given options"""
+        digest = hashlib.sha256(b"cpp\0")
+        digest.update(transpiler_version().encode())
+        for name, value in sorted(dict(options).items()):
+            digest.update(f"{name}={value!r}\0".encode())
+        digest.update(source_code.encode("utf-8"))
+        return digest.hexdigest()
+
+    @staticmethod
+    def _compile_key(kind, cxx, flags, inputs, cwd):
+        digest = hashlib.sha256(f"{kind}\0".encode())
+        digest.update(_compiler_identity(cxx))
+        for flag in flags:
+            digest.update(f"{flag}\0".encode())
+        for directory in _include_dirs(flags):
+            digest.update(_headers_hash(str(cwd / directory)))
+        for path in inputs:
+            digest.update(hashlib.sha256(Path(path).read_bytes()).digest())
+        return digest.hexdigest()
+
+    # ------------------------------------------------------------------
+    # Compilation
+    # ------------------------------------------------------------------
+
+    def compile_object(self, cxx, flags, source, obj=None, cwd=None):
+        """
+        Compile source with `cxx flags -c` unless its object is cached.
+
+        Args:
+            obj: Where to put the object, or None to only add it to the cache
+                 (to build objects shared by several compile() calls up front)
+
+        Returns:
+            subprocess.CompletedProcess: The compilation, or a success without output on a hit
+        """
+        cwd = Path(cwd) if cwd else Path.cwd()
+        command = shlex.split(cxx)
+        source = cwd / source
+        key = self._compile_key("obj", cxx, flags, [source], cwd)
+        if obj is None:
+            if self._entry("obj", key).exists():
+                return subprocess.CompletedProcess(command, 0, b"", b"")
+            with tempfile.TemporaryDirectory(prefix="transpyler-") as build_dir:
+                return self.compile_object(cxx, flags, source, Path(build_dir) / f"{source.stem}.o", cwd)
+
+        if self.restore("obj", key, obj):
+            return subprocess.CompletedProcess(command, 0, b"", b"")
+        result = subprocess.run([*self.launcher, *command, *flags, "-c", str(source), "-o", str(obj)],
+                                capture_output=True, cwd=cwd, check=False)
+        if result.returncode == 0:
+            self.store("obj", key, obj)
+        return result
+
+    def compile(self, cxx, flags, sources, output, cwd=None):
+        """
+        Compile sources into the executable output, reusing cached objects and executables.
+
+        Every source is compiled on its own with `cxx flags -c`, so a changed
+        script only recompiles itself; the objects are then linked with the
+        same flags. Headers outside the -I/-iquote directories (system headers)
+        are not part of the keys.
+
+        Args:
+            cxx: Compiler command, e.g. "g++"
+            flags: Compiler flags shared by all sources and the link
+            sources: Source files, relative to cwd
+            output: Executable path, relative to cwd
+
+        Returns:
+            subprocess.CompletedProcess: The failed compilation, or a success with the captured output
+        """
+        cwd = Path(cwd) if cwd else Path.cwd()
+        command = shlex.split(cxx)
+        flags = list(flags)
+        sources = [cwd / source for source in sources]
+        output = cwd / output
+
+        exe_key = self._compile_key("exe", cxx, flags, sources, cwd)
+        if self.restore("exe", exe_key, output):
+            return subprocess.CompletedProcess([*command, *flags], 0, b"", b"")
+
+        stderr = b""
+        with tempfile.TemporaryDirectory(prefix="transpyler-") as build_dir:
+            objects = []
+            for i, source in enumerate(sources):
+                obj = Path(build_dir) / f"{i}_{source.stem}.o"
+                result = self.compile_object(cxx, flags, source, obj, cwd)
+                stderr += result.stderr
+                if result.returncode != 0:
+                    result.stderr = stderr
+                    return result
+                objects.append(str(obj))
+
+            result = subprocess.run([*command, *flags, *objects, "-o", str(output)],
+                                    capture_output=True, cwd=cwd, check=False)
+            result.stderr = stderr + result.stderr
+            if result.returncode == 0:
+                self.store("exe", exe_key, output)
+            return result
@@ -7,6 +7,7 @@ Key Features:
 - Uses the parser and code generation visitors to produce C++ code from the AST.
 - Integrates all codegen modules for end-to-end transpilation.
 - Entry point for converting source code to C++ files.
+- Optionally reuses the C++ of unchanged sources from a BuildCache.
 """
 
 from ..parser.parser import Parser
@@ -14,12 +15,33 @@ from ..codegen.code_generator import CodeGenerator
 
 
 class Transpiler:
-    def __init__(self):
+    def __init__(self, profile: bool = False, cache=None):
         """
         Initialize the Transpiler for C++ code generation.
+
+        Args:
+            profile: Emit per-function profiling timers (measured in -DTRANSPYLER_PROFILE builds)
+            cache: BuildCache to look the generated C++ up in, or None to always transpile
         """
-        self.parser = Parser()
-        self.codegen = CodeGenerator()
+        self.profile = profile
+        self.cache = cache
+        # Lexer and parser errors of the last transpile() (recovered from, not raised)
+        self.errors = []
+        self._parser = None
+        self._codegen = None
+
+    # Built on first use: building the parser tables costs more than a cache hit
+    @property
+    def parser(self):
+        if self._parser is None:
+            self._parser = Parser()
+        return self._parser
+
+    @property
+    def codegen(self):
+        if self._codegen is None:
+            self._codegen = CodeGenerator(profile=self.profile)
+        return self._codegen
 
     def transpile(self, source_code: str, filename: str = None) -> str:
         """
@@ -36,11 +58,24 @@ class Transpiler:
         if filename is None:
             filename = "output.cpp"
 
+        self.errors = []
+        key = None
+        if self.cache is not None:
+            key = self.cache.transpile_key(source_code, {"profile": self.profile})
+            if self.cache.restore("cpp", key, filename):
+                return filename
+
         # Parse the source code to get AST
         module = self.parser.parse(source_code)
+        self.errors = list(self.parser.errors)
+        # The generators keep per-module state (functions, clones, constants); start clean
+        self._codegen = None
 
         # Generate code using the unified CodeGenerator
         # The generate_file method now handles both Module nodes and individual nodes properly
         self.codegen.generate_file(module, filename)
 
+        # Code recovered from syntax errors is not cached, so they are reported every time
+        if key is not None and not self.errors:
+            self.cache.store("cpp", key, filename)
         return filename
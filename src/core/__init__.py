@@ -9,12 +9,13 @@ from .ast.ast_definitions import FunctionDef, ClassDef, Attribute, Subscript
 
 # --- Expressions ---
 from .ast.ast_expressions import (
-    LiteralExpr, Identifier, UnaryExpr, BinaryExpr, CallExpr, ListExpr, TupleExpr
+    LiteralExpr, Identifier, UnaryExpr, BinaryExpr, CallExpr, ListExpr, TupleExpr,
+    GeneratorExpr
 )
 
 # --- Statements / control flow ---
 from .ast.ast_statements import (
-    Block, ExprStmt, Assign, Return, If, While, For, Break, Continue, Pass
+    Block, ExprStmt, Assign, Return, Yield, If, While, For, Break, Continue, Pass
 )
 
 # --- Helpers existentes ---
@@ -25,6 +26,7 @@ __all__ = [
     "AstNode", "Module",
     "FunctionDef", "ClassDef", "Attribute", "Subscript",
     "LiteralExpr", "Identifier", "UnaryExpr", "BinaryExpr", "CallExpr", "ListExpr", "TupleExpr",
-    "Block", "ExprStmt", "Assign", "Return", "If", "While", "For", "Break", "Continue", "Pass",
+    "GeneratorExpr",
+    "Block", "ExprStmt", "Assign", "Return", "Yield", "If", "While", "For", "Break", "Continue", "Pass",
 ]
 
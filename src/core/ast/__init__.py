@@ -26,10 +26,12 @@ __all__ = [
     "ListExpr",       
     "DictExpr",       
     "SetExpr",        
+    "GeneratorExpr",
     "Subscript",      
     "Attribute",      
     "Assign",
     "Return",
+    "Yield",
     "Block",
     "Break",
     "Continue",
@@ -96,3 +96,14 @@ class DictExpr(AstNode):
     Each pair is (key, value)
     """
     pairs: List[Tuple[AstNode, AstNode]] = field(default_factory=list)
+
+@dataclass
+class GeneratorExpr(AstNode):
+    """
+    Represents a generator expression, e.g. (x * x for x in xs if x > 0)
+    The target is an Identifier, or a TupleExpr of them for `for k, v in`
+    """
+    element: Optional[AstNode] = field(default=None)
+    target: Optional[AstNode] = field(default=None)
+    iterable: Optional[AstNode] = field(default=None)
+    condition: Optional[AstNode] = field(default=None)
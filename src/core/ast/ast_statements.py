@@ -68,6 +68,22 @@ class Return(AstNode):
     value: Optional[AstNode] = None
 
 
+@dataclass
+class Yield(AstNode):
+    """
+    Represents a yield statement; it makes the enclosing function a generator.
+
+    Example:
+        yield x * x
+
+    Attributes:
+        value (Optional[AstNode]): The expression being yielded,
+        or None for bare 'yield'.
+    """
+
+    value: Optional[AstNode] = None
+
+
 @dataclass
 class Break(AstNode):
     """
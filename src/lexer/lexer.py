@@ -78,6 +78,9 @@ class Lexer:
     t_FLOOR_DIVIDE = r"\/\/"
     t_MOD = r"\%"
     t_POWER = r"\*\*"
+    t_PIPE = r"\|"
+    t_CARET = r"\^"
+    t_AMPERSAND = r"\&"
     t_EQUALS = r"\=\="
     t_NOT_EQUALS = r"\!\="
     t_LESS_THAN = r"\<"
@@ -151,6 +154,12 @@ class Lexer:
         self.data = data
         if not data.startswith("\n"):
             data = "\n" + data
+        # A lexer is reused for several inputs; an unfinished one must not leak its state
+        self._indent_stack = [0]
+        self._pending = []
+        self._expect_indent = False
+        self._delim_depth = 0
+        self.lex.lineno = 1
         self.lex.input(data)
 
     def _next_token(self):
@@ -14,6 +14,7 @@ KEYWORDS = {
     # Definitions
     "def": "DEF",
     "return": "RETURN",
+    "yield": "YIELD",
     "class": "CLASS",
     # Booleans (case-sensitive like Python)
     "True": "TRUE",
@@ -43,6 +44,10 @@ TOKENS = (
         "FLOOR_DIVIDE",
         "MOD",
         "POWER",
+        ## Bitwise (set algebra on sets)
+        "PIPE",
+        "CARET",
+        "AMPERSAND",
         ## Relational
         "EQUALS",
         "NOT_EQUALS",
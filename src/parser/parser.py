@@ -38,6 +38,9 @@ precedence = (
         "GREATER_THAN",
         "GREATER_THAN_EQUALS",
     ),
+    ("left", "PIPE"),
+    ("left", "CARET"),
+    ("left", "AMPERSAND"),
     ("left", "PLUS", "MINUS"),
     ("left", "TIMES", "DIVIDE", "FLOOR_DIVIDE", "MOD"),
     (
@@ -5,6 +5,7 @@ from ..core.ast import (
     BinaryExpr,
     ComparisonExpr,
     CallExpr,
+    GeneratorExpr,
     TupleExpr,
     ListExpr,
     DictExpr,
@@ -73,6 +74,24 @@ class ExpressionRules:
         else:
             p[0] = TupleExpr(elements=elements, line=line, col=col)
 
+    def p_atom_generator(self, p):
+        """atom : LPAREN generator_body RPAREN"""
+        p[0] = p[2]
+
+    # (x * x for x in xs if x > 0); the for targets are the loop's
+    def p_generator_body(self, p):
+        """generator_body : expr FOR for_targets IN expr
+        | expr FOR for_targets IN expr IF expr"""
+        line, col = _pos(p, 2)
+        p[0] = GeneratorExpr(
+            element=p[1],
+            target=p[3],
+            iterable=p[5],
+            condition=p[7] if len(p) == 8 else None,
+            line=line,
+            col=col,
+        )
+
     def p_atom_list(self, p):
         """atom : LBRACKET elements_opt RBRACKET"""
         line, col = _pos(p, 1)
@@ -197,6 +216,13 @@ class ExpressionRules:
         line, col = _pos(p, 1)
         p[0] = BinaryExpr(left=p[1], op=p[2], right=p[3], line=line, col=col)
 
+    def p_expr_bitwise(self, p):
+        """expr : expr PIPE expr
+        | expr CARET expr
+        | expr AMPERSAND expr"""
+        line, col = _pos(p, 1)
+        p[0] = BinaryExpr(left=p[1], op=p[2], right=p[3], line=line, col=col)
+
     # ---------------------- COMPARISONS ----------------------
     def p_expr_comparison(self, p):
         """expr : expr EQUALS expr
@@ -222,6 +248,12 @@ class ExpressionRules:
         line, col = _pos(p, 2)
         p[0] = CallExpr(callee=p[1], args=p[3], line=line, col=col)
 
+    # sum(x for x in xs): a generator expression as the only argument
+    def p_expr_call_generator(self, p):
+        "expr : atom LPAREN generator_body RPAREN"
+        line, col = _pos(p, 2)
+        p[0] = CallExpr(callee=p[1], args=[p[3]], line=line, col=col)
+
     # ---------------------- EXPRESSION LISTS ----------------------
     def p_arg_list_opt(self, p):
         """arg_list_opt : expr COMMA arg_list_opt
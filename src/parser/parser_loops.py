@@ -1,4 +1,4 @@
-from ..core.ast import While, For, Identifier
+from ..core.ast import While, For, Identifier, TupleExpr
 from .parser_utils import _pos
 
 
@@ -10,10 +10,27 @@ class LoopRules:
         p[0] = While(cond=p[2], body=p[4])
 
     def p_for_stmt(self, p):
-        """for_stmt : FOR ID IN expr COLON suite"""
-        line, col = _pos(p, 2)
+        """for_stmt : FOR for_targets IN expr COLON suite"""
         p[0] = For(
-            target=Identifier(name=p[2], line=line, col=col),
+            target=p[2],
             iterable=p[4],
             body=p[6],
         )
+
+    # x, or k, v to unpack each item
+    def p_for_targets(self, p):
+        """for_targets : ID
+        | ID COMMA for_target_names"""
+        line, col = _pos(p, 1)
+        target = Identifier(name=p[1], line=line, col=col)
+        if len(p) == 2:
+            p[0] = target
+        else:
+            p[0] = TupleExpr(elements=[target] + p[3], line=line, col=col)
+
+    def p_for_target_names(self, p):
+        """for_target_names : ID
+        | ID COMMA for_target_names"""
+        line, col = _pos(p, 1)
+        target = Identifier(name=p[1], line=line, col=col)
+        p[0] = [target] if len(p) == 2 else [target] + p[3]
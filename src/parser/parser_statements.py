@@ -2,6 +2,7 @@ from ..core.ast import (
     ExprStmt,
     Assign,
     Return,
+    Yield,
     Break,
     Continue,
     Pass,
@@ -31,12 +32,13 @@ class StatementRules:
     def p_small_stmt(self, p):
         """small_stmt : assignment
         | return_stmt
+        | yield_stmt
         | break_stmt
         | continue_stmt
         | pass_stmt
         | expr"""
         if len(p) == 2:
-            if not isinstance(p[1], (Assign, Return, Break, Continue, Pass)):
+            if not isinstance(p[1], (Assign, Return, Yield, Break, Continue, Pass)):
                 line, col = _pos(p, 1)
                 p[0] = ExprStmt(value=p[1], line=line, col=col)
             else:
@@ -137,6 +139,12 @@ class StatementRules:
         else:
             p[0] = Return(value=None)
 
+    def p_yield_stmt(self, p):
+        """yield_stmt : YIELD expr
+        | YIELD"""
+        line, col = _pos(p, 1)
+        p[0] = Yield(value=p[2] if len(p) == 3 else None, line=line, col=col)
+
     def p_break_stmt(self, p):
         "break_stmt : BREAK"
         p[0] = Break()
@@ -6,9 +6,9 @@ _tabversion = '3.10'
 
 _lr_method = 'LALR'
 
-_lr_signature = 'moduleleftORleftANDleftEQUALSNOT_EQUALSLESS_THANLESS_THAN_EQUALSGREATER_THANGREATER_THAN_EQUALSleftPLUSMINUSleftTIMESDIVIDEFLOOR_DIVIDEMODrightUPLUSUMINUSNOTrightPOWERAND ASSIGN BREAK CLASS COLON COMMA CONTINUE DEDENT DEF DIVIDE DIVIDE_ASSIGN DOT ELIF ELSE EQUALS FALSE FLOOR_DIVIDE FLOOR_DIVIDE_ASSIGN FOR GREATER_THAN GREATER_THAN_EQUALS ID IF IN INDENT LBRACE LBRACKET LESS_THAN LESS_THAN_EQUALS LPAREN MINUS MINUS_ASSIGN MOD MOD_ASSIGN NEWLINE NONE NOT NOT_EQUALS NUMBER OR PASS PLUS PLUS_ASSIGN POWER POWER_ASSIGN RBRACE RBRACKET RETURN RPAREN STRING TIMES TIMES_ASSIGN TRUE WHILEif_stmt : IF expr COLON suite elif_blocks else_block_optcompound_statement : if_stmt\n| while_stmt\n| for_stmt\n| funcdef\n| classdeffuncdef : DEF ID LPAREN param_list_opt RPAREN COLON suitewhile_stmt : WHILE expr COLON suiteelif_blocks : ELIF expr COLON suite elif_blocks\n|for_stmt : FOR ID IN expr COLON suitesuite : simple_statement\n| INDENT statement_list DEDENTclassdef : CLASS ID COLON suiteelse_block_opt : ELSE COLON suite\n|statement : simple_statement\n| compound_statementparam_list_opt : param COMMA param_list_opt\n| param\n|expr : atomexpr : LPAREN expr RPARENsimple_statement : small_stmtatom : atom DOT IDsmall_stmt : assignment\n| return_stmt\n| break_stmt\n| continue_stmt\n| pass_stmt\n| exprparam : ID\n| ID ASSIGN expratom : NUMBERatom : STRINGatom : TRUEassignment : atom LBRACKET expr RBRACKET ASSIGN expr\n| atom LBRACKET expr RBRACKET PLUS_ASSIGN expr\n| atom LBRACKET expr RBRACKET MINUS_ASSIGN expr\n| atom LBRACKET expr RBRACKET TIMES_ASSIGN expr\n| atom LBRACKET expr RBRACKET DIVIDE_ASSIGN expr\n| atom LBRACKET expr RBRACKET FLOOR_DIVIDE_ASSIGN expr\n| atom LBRACKET expr RBRACKET MOD_ASSIGN expr\n| atom LBRACKET expr RBRACKET POWER_ASSIGN expratom : FALSEatom : NONEatom : IDassignment : atom DOT ID ASSIGN expr\n| atom DOT ID PLUS_ASSIGN expr\n| atom DOT ID MINUS_ASSIGN expr\n| atom DOT ID TIMES_ASSIGN expr\n| atom DOT ID DIVIDE_ASSIGN expr\n| atom DOT ID FLOOR_DIVIDE_ASSIGN expr\n| atom DOT ID MOD_ASSIGN expr\n| atom DOT ID POWER_ASSIGN expratom : LPAREN elements_opt RPARENatom : LBRACKET elements_opt RBRACKETassignment : assign_targets ASSIGN expr\n| assign_targets PLUS_ASSIGN expr\n| assign_targets MINUS_ASSIGN expr\n| assign_targets TIMES_ASSIGN expr\n| assign_targets DIVIDE_ASSIGN expr\n| assign_targets FLOOR_DIVIDE_ASSIGN expr\n| assign_targets MOD_ASSIGN expr\n| assign_targets POWER_ASSIGN expratom : atom LBRACKET expr RBRACKETatom : LBRACE key_value_list_opt RBRACEatom : atom LBRACKET subscript_item RBRACKETsubscript_item : exprassign_targets : assign_targets ASSIGN target\n| targetsubscript_item : opt_expr COLON opt_exprtarget : ID\n| LPAREN elements_opt RPAREN\n| LBRACKET elements_opt RBRACKET\n| target LBRACKET expr RBRACKET\n| target DOT IDsubscript_item : opt_expr COLON opt_expr COLON opt_exprsubscript_item : COLON opt_exprsubscript_item : opt_expr COLONsubscript_item : COLONmodule : statement_listsubscript_item : COLON COLON opt_exprreturn_stmt : RETURN expr\n| RETURNstatement_list : statement\n| statement_list statementopt_expr :opt_expr : exprbreak_stmt : BREAKatom : LBRACE set_elements RBRACEcontinue_stmt : CONTINUEpass_stmt : PASSset_elements : exprset_elements : set_elements COMMA exprset_elements : set_elements COMMAexpr : PLUS expr %prec UPLUSexpr : MINUS expr %prec UMINUSexpr : NOT exprexpr : expr POWER expr %prec POWERexpr : expr TIMES expr\n| expr DIVIDE expr\n| expr FLOOR_DIVIDE expr\n| expr MOD exprexpr : expr PLUS expr\n| expr MINUS exprexpr : expr EQUALS expr\n| expr NOT_EQUALS expr\n| expr LESS_THAN expr\n| expr LESS_THAN_EQUALS expr\n| expr GREATER_THAN expr\n| expr GREATER_THAN_EQUALS expr\n| expr IN exprexpr : expr AND expr\n| expr OR exprexpr : atom LPAREN arg_list_opt RPARENarg_list_opt : expr COMMA arg_list_opt\n| exprarg_list_opt :key_value_list : key_value\n| key_value COMMA key_value_listkey_value_list_opt : key_value_list\n| emptykey_value : expr COLON exprelements_opt : elements\n| emptyelements : expr\n| elements COMMA exprempty :'
+_lr_signature = 'moduleleftORleftANDleftEQUALSNOT_EQUALSLESS_THANLESS_THAN_EQUALSGREATER_THANGREATER_THAN_EQUALSleftPIPEleftCARETleftAMPERSANDleftPLUSMINUSleftTIMESDIVIDEFLOOR_DIVIDEMODrightUPLUSUMINUSNOTrightPOWERDEF OR RETURN BREAK NONE AND PASS NOT WHILE ELSE CONTINUE FOR ELIF CLASS IF FALSE TRUE IN YIELD ID INDENT DEDENT NUMBER STRING PLUS MINUS TIMES DIVIDE FLOOR_DIVIDE MOD POWER PIPE CARET AMPERSAND EQUALS NOT_EQUALS LESS_THAN LESS_THAN_EQUALS GREATER_THAN GREATER_THAN_EQUALS ASSIGN PLUS_ASSIGN MINUS_ASSIGN TIMES_ASSIGN DIVIDE_ASSIGN FLOOR_DIVIDE_ASSIGN MOD_ASSIGN POWER_ASSIGN LPAREN RPAREN LBRACE RBRACE LBRACKET RBRACKET COLON COMMA DOT NEWLINEif_stmt : IF expr COLON suite elif_blocks else_block_optcompound_statement : if_stmt\n| while_stmt\n| for_stmt\n| funcdef\n| classdeffuncdef : DEF ID LPAREN param_list_opt RPAREN COLON suitewhile_stmt : WHILE expr COLON suiteelif_blocks : ELIF expr COLON suite elif_blocks\n|for_stmt : FOR for_targets IN expr COLON suitesuite : simple_statement\n| INDENT statement_list DEDENTclassdef : CLASS ID COLON suiteelse_block_opt : ELSE COLON suite\n|for_targets : ID\n| ID COMMA for_target_namesstatement : simple_statement\n| compound_statementparam_list_opt : param COMMA param_list_opt\n| param\n|expr : atomexpr : LPAREN expr RPARENsimple_statement : small_stmtatom : atom DOT IDfor_target_names : ID\n| ID COMMA for_target_namessmall_stmt : assignment\n| return_stmt\n| yield_stmt\n| break_stmt\n| continue_stmt\n| pass_stmt\n| exprparam : ID\n| ID ASSIGN expratom : NUMBERatom : STRINGatom : TRUEassignment : atom LBRACKET expr RBRACKET ASSIGN expr\n| atom LBRACKET expr RBRACKET PLUS_ASSIGN expr\n| atom LBRACKET expr RBRACKET MINUS_ASSIGN expr\n| atom LBRACKET expr RBRACKET TIMES_ASSIGN expr\n| atom LBRACKET expr RBRACKET DIVIDE_ASSIGN expr\n| atom LBRACKET expr RBRACKET FLOOR_DIVIDE_ASSIGN expr\n| atom LBRACKET expr RBRACKET MOD_ASSIGN expr\n| atom LBRACKET expr RBRACKET POWER_ASSIGN expratom : FALSEatom : NONEatom : IDassignment : atom DOT ID ASSIGN expr\n| atom DOT ID PLUS_ASSIGN expr\n| atom DOT ID MINUS_ASSIGN expr\n| atom DOT ID TIMES_ASSIGN expr\n| atom DOT ID DIVIDE_ASSIGN expr\n| atom DOT ID FLOOR_DIVIDE_ASSIGN expr\n| atom DOT ID MOD_ASSIGN expr\n| atom DOT ID POWER_ASSIGN expratom : LPAREN elements_opt RPARENatom : LPAREN generator_body RPARENassignment : assign_targets ASSIGN expr\n| assign_targets PLUS_ASSIGN expr\n| assign_targets MINUS_ASSIGN expr\n| assign_targets TIMES_ASSIGN expr\n| assign_targets DIVIDE_ASSIGN expr\n| assign_targets FLOOR_DIVIDE_ASSIGN expr\n| assign_targets MOD_ASSIGN expr\n| assign_targets POWER_ASSIGN exprgenerator_body : expr FOR for_targets IN expr\n| expr FOR for_targets IN expr IF expratom : LBRACKET elements_opt RBRACKETatom : atom LBRACKET expr RBRACKETassign_targets : assign_targets ASSIGN target\n| targetatom : LBRACE key_value_list_opt RBRACEtarget : ID\n| LPAREN elements_opt RPAREN\n| LBRACKET elements_opt RBRACKET\n| target LBRACKET expr RBRACKET\n| target DOT IDatom : atom LBRACKET subscript_item RBRACKETsubscript_item : exprsubscript_item : opt_expr COLON opt_exprsubscript_item : opt_expr COLON opt_expr COLON opt_exprmodule : statement_listsubscript_item : COLON opt_exprreturn_stmt : RETURN expr\n| RETURNstatement_list : statement\n| statement_list statementsubscript_item : opt_expr COLONyield_stmt : YIELD expr\n| YIELDsubscript_item : COLONbreak_stmt : BREAKsubscript_item : COLON COLON opt_exprcontinue_stmt : CONTINUEopt_expr :pass_stmt : PASSopt_expr : expratom : LBRACE set_elements RBRACEset_elements : exprset_elements : set_elements COMMA exprset_elements : set_elements COMMAexpr : PLUS expr %prec UPLUSexpr : MINUS expr %prec UMINUSexpr : NOT exprexpr : expr POWER expr %prec POWERexpr : expr TIMES expr\n| expr DIVIDE expr\n| expr FLOOR_DIVIDE expr\n| expr MOD exprexpr : expr PLUS expr\n| expr MINUS exprexpr : expr PIPE expr\n| expr CARET expr\n| expr AMPERSAND exprexpr : expr EQUALS expr\n| expr NOT_EQUALS expr\n| expr LESS_THAN expr\n| expr LESS_THAN_EQUALS expr\n| expr GREATER_THAN expr\n| expr GREATER_THAN_EQUALS expr\n| expr IN exprexpr : expr AND expr\n| expr OR exprexpr : atom LPAREN arg_list_opt RPARENexpr : atom LPAREN generator_body RPARENarg_list_opt : expr COMMA arg_list_opt\n| exprarg_list_opt :key_value_list : key_value\n| key_value COMMA key_value_listkey_value_list_opt : key_value_list\n| emptykey_value : expr COLON exprelements_opt : elements\n| emptyelements : expr\n| elements COMMA exprempty :'
     
-_lr_action_items = {'IF':([0,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,21,25,28,29,30,31,35,36,37,38,39,42,60,62,85,86,87,88,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,121,122,129,132,133,136,138,139,140,141,142,143,144,145,146,152,153,154,155,157,158,159,165,166,167,180,189,191,192,207,208,209,210,211,212,213,214,216,217,218,221,222,226,227,228,229,230,231,232,233,237,239,240,241,],[18,18,-86,-17,-18,-24,-2,-3,-4,-5,-6,-26,-27,-28,-29,-30,-31,-47,-22,-85,-90,-92,-93,-34,-35,-36,-45,-46,-87,-22,-47,-84,-97,-98,-99,-100,-101,-102,-103,-104,-105,-106,-107,-108,-109,-110,-111,-112,-113,-114,-115,-23,-56,-25,-57,-58,-47,-59,-60,-61,-62,-63,-64,-65,-67,-91,-10,-12,18,-25,-56,-57,-8,-14,-66,-68,-116,-16,18,-66,-48,-49,-50,-51,-52,-53,-54,-55,-56,-57,-1,-13,-11,-37,-38,-39,-40,-41,-42,-43,-44,-7,-15,-10,-9,]),'WHILE':([0,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,21,25,28,29,30,31,35,36,37,38,39,42,60,62,85,86,87,88,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,121,122,129,132,133,136,138,139,140,141,142,143,144,145,146,152,153,154,155,157,158,159,165,166,167,180,189,191,192,207,208,209,210,211,212,213,214,216,217,218,221,222,226,227,228,229,230,231,232,233,237,239,240,241,],[19,19,-86,-17,-18,-24,-2,-3,-4,-5,-6,-26,-27,-28,-29,-30,-31,-47,-22,-85,-90,-92,-93,-34,-35,-36,-45,-46,-87,-22,-47,-84,-97,-98,-99,-100,-101,-102,-103,-104,-105,-106,-107,-108,-109,-110,-111,-112,-113,-114,-115,-23,-56,-25,-57,-58,-47,-59,-60,-61,-62,-63,-64,-65,-67,-91,-10,-12,19,-25,-56,-57,-8,-14,-66,-68,-116,-16,19,-66,-48,-49,-50,-51,-52,-53,-54,-55,-56,-57,-1,-13,-11,-37,-38,-39,-40,-41,-42,-43,-44,-7,-15,-10,-9,]),'FOR':([0,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,21,25,28,29,30,31,35,36,37,38,39,42,60,62,85,86,87,88,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,121,122,129,132,133,136,138,139,140,141,142,143,144,145,146,152,153,154,155,157,158,159,165,166,167,180,189,191,192,207,208,209,210,211,212,213,214,216,217,218,221,222,226,227,228,229,230,231,232,233,237,239,240,241,],[20,20,-86,-17,-18,-24,-2,-3,-4,-5,-6,-26,-27,-28,-29,-30,-31,-47,-22,-85,-90,-92,-93,-34,-35,-36,-45,-46,-87,-22,-47,-84,-97,-98,-99,-100,-101,-102,-103,-104,-105,-106,-107,-108,-109,-110,-111,-112,-113,-114,-115,-23,-56,-25,-57,-58,-47,-59,-60,-61,-62,-63,-64,-65,-67,-91,-10,-12,20,-25,-56,-57,-8,-14,-66,-68,-116,-16,20,-66,-48,-49,-50,-51,-52,-53,-54,-55,-56,-57,-1,-13,-11,-37,-38,-39,-40,-41,-42,-43,-44,-7,-15,-10,-9,]),'DEF':([0,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,21,25,28,29,30,31,35,36,37,38,39,42,60,62,85,86,87,88,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,121,122,129,132,133,136,138,139,140,141,142,143,144,145,146,152,153,154,155,157,158,159,165,166,167,180,189,191,192,207,208,209,210,211,212,213,214,216,217,218,221,222,226,227,228,229,230,231,232,233,237,239,240,241,],[22,22,-86,-17,-18,-24,-2,-3,-4,-5,-6,-26,-27,-28,-29,-30,-31,-47,-22,-85,-90,-92,-93,-34,-35,-36,-45,-46,-87,-22,-47,-84,-97,-98,-99,-100,-101,-102,-103,-104,-105,-106,-107,-108,-109,-110,-111,-112,-113,-114,-115,-23,-56,-25,-57,-58,-47,-59,-60,-61,-62,-63,-64,-65,-67,-91,-10,-12,22,-25,-56,-57,-8,-14,-66,-68,-116,-16,22,-66,-48,-49,-50,-51,-52,-53,-54,-55,-56,-57,-1,-13,-11,-37,-38,-39,-40,-41,-42,-43,-44,-7,-15,-10,-9,]),'CLASS':([0,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,21,25,28,29,30,31,35,36,37,38,39,42,60,62,85,86,87,88,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,121,122,129,132,133,136,138,139,140,141,142,143,144,145,146,152,153,154,155,157,158,159,165,166,167,180,189,191,192,207,208,209,210,211,212,213,214,216,217,218,221,222,226,227,228,229,230,231,232,233,237,239,240,241,],[24,24,-86,-17,-18,-24,-2,-3,-4,-5,-6,-26,-27,-28,-29,-30,-31,-47,-22,-85,-90,-92,-93,-34,-35,-36,-45,-46,-87,-22,-47,-84,-97,-98,-99,-100,-101,-102,-103,-104,-105,-106,-107,-108,-109,-110,-111,-112,-113,-114,-115,-23,-56,-25,-57,-58,-47,-59,-60,-61,-62,-63,-64,-65,-67,-91,-10,-12,24,-25,-56,-57,-8,-14,-66,-68,-116,-16,24,-66,-48,-49,-50,-51,-52,-53,-54,-55,-56,-57,-1,-13,-11,-37,-38,-39,-40,-41,-42,-43,-44,-7,-15,-10,-9,]),'RETURN':([0,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,21,25,28,29,30,31,35,36,37,38,39,42,60,62,85,86,87,88,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,118,121,122,124,129,132,133,136,138,139,140,141,142,143,144,145,146,152,153,154,155,157,158,159,165,166,167,180,189,191,192,193,207,208,209,210,211,212,213,214,216,217,218,221,222,224,226,227,228,229,230,231,232,233,235,236,237,239,240,241,],[28,28,-86,-17,-18,-24,-2,-3,-4,-5,-6,-26,-27,-28,-29,-30,-31,-47,-22,-85,-90,-92,-93,-34,-35,-36,-45,-46,-87,-22,-47,-84,-97,-98,-99,-100,-101,-102,-103,-104,-105,-106,-107,-108,-109,-110,-111,-112,-113,-114,-115,28,28,-23,-56,28,-25,-57,-58,-47,-59,-60,-61,-62,-63,-64,-65,-67,-91,-10,-12,28,-25,-56,-57,-8,-14,-66,-68,-116,-16,28,-66,28,-48,-49,-50,-51,-52,-53,-54,-55,-56,-57,-1,-13,-11,28,-37,-38,-39,-40,-41,-42,-43,-44,28,28,-7,-15,-10,-9,]),'BREAK':([0,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,21,25,28,29,30,31,35,36,37,38,39,42,60,62,85,86,87,88,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,118,121,122,124,129,132,133,136,138,139,140,141,142,143,144,145,146,152,153,154,155,157,158,159,165,166,167,180,189,191,192,193,207,208,209,210,211,212,213,214,216,217,218,221,222,224,226,227,228,229,230,231,232,233,235,236,237,239,240,241,],[29,29,-86,-17,-18,-24,-2,-3,-4,-5,-6,-26,-27,-28,-29,-30,-31,-47,-22,-85,-90,-92,-93,-34,-35,-36,-45,-46,-87,-22,-47,-84,-97,-98,-99,-100,-101,-102,-103,-104,-105,-106,-107,-108,-109,-110,-111,-112,-113,-114,-115,29,29,-23,-56,29,-25,-57,-58,-47,-59,-60,-61,-62,-63,-64,-65,-67,-91,-10,-12,29,-25,-56,-57,-8,-14,-66,-68,-116,-16,29,-66,29,-48,-49,-50,-51,-52,-53,-54,-55,-56,-57,-1,-13,-11,29,-37,-38,-39,-40,-41,-42,-43,-44,29,29,-7,-15,-10,-9,]),'CONTINUE':([0,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,21,25,28,29,30,31,35,36,37,38,39,42,60,62,85,86,87,88,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,118,121,122,124,129,132,133,136,138,139,140,141,142,143,144,145,146,152,153,154,155,157,158,159,165,166,167,180,189,191,192,193,207,208,209,210,211,212,213,214,216,217,218,221,222,224,226,227,228,229,230,231,232,233,235,236,237,239,240,241,],[30,30,-86,-17,-18,-24,-2,-3,-4,-5,-6,-26,-27,-28,-29,-30,-31,-47,-22,-85,-90,-92,-93,-34,-35,-36,-45,-46,-87,-22,-47,-84,-97,-98,-99,-100,-101,-102,-103,-104,-105,-106,-107,-108,-109,-110,-111,-112,-113,-114,-115,30,30,-23,-56,30,-25,-57,-58,-47,-59,-60,-61,-62,-63,-64,-65,-67,-91,-10,-12,30,-25,-56,-57,-8,-14,-66,-68,-116,-16,30,-66,30,-48,-49,-50,-51,-52,-53,-54,-55,-56,-57,-1,-13,-11,30,-37,-38,-39,-40,-41,-42,-43,-44,30,30,-7,-15,-10,-9,]),'PASS':([0,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,21,25,28,29,30,31,35,36,37,38,39,42,60,62,85,86,87,88,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,118,121,122,124,129,132,133,136,138,139,140,141,142,143,144,145,146,152,153,154,155,157,158,159,165,166,167,180,189,191,192,193,207,208,209,210,211,212,213,214,216,217,218,221,222,224,226,227,228,229,230,231,232,233,235,236,237,239,240,241,],[31,31,-86,-17,-18,-24,-2,-3,-4,-5,-6,-26,-27,-28,-29,-30,-31,-47,-22,-85,-90,-92,-93,-34,-35,-36,-45,-46,-87,-22,-47,-84,-97,-98,-99,-100,-101,-102,-103,-104,-105,-106,-107,-108,-109,-110,-111,-112,-113,-114,-115,31,31,-23,-56,31,-25,-57,-58,-47,-59,-60,-61,-62,-63,-64,-65,-67,-91,-10,-12,31,-25,-56,-57,-8,-14,-66,-68,-116,-16,31,-66,31,-48,-49,-50,-51,-52,-53,-54,-55,-56,-57,-1,-13,-11,31,-37,-38,-39,-40,-41,-42,-43,-44,31,31,-7,-15,-10,-9,]),'LPAREN':([0,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,21,23,25,26,28,29,30,31,32,33,34,35,36,37,38,39,40,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,60,61,62,63,66,72,74,77,78,79,80,81,82,83,84,85,86,87,88,95,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,115,118,119,121,122,123,124,128,129,132,133,135,136,137,138,139,140,141,142,143,144,145,146,147,148,149,152,153,154,155,157,158,159,165,166,167,168,169,172,173,174,175,176,177,178,179,180,181,189,190,191,192,193,194,197,198,199,200,201,202,203,204,207,208,209,210,211,212,213,214,216,217,218,221,222,224,226,227,228,229,230,231,232,233,234,235,236,237,239,240,241,],[23,23,-86,-17,-18,-24,-2,-3,-4,-5,-6,-26,-27,-28,-29,-30,-31,61,61,-47,61,74,61,61,-90,-92,-93,61,61,61,-34,-35,-36,-45,-46,61,-87,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,74,61,-47,61,120,61,61,135,61,61,61,61,61,61,61,-84,-97,-98,-99,61,-100,-101,-102,-103,-104,-105,-106,-107,-108,-109,-110,-111,-112,-113,-114,-115,23,61,23,61,-23,-56,61,23,61,-25,-57,-58,61,-47,61,-59,-60,-61,-62,-63,-64,-65,-67,-91,61,61,61,-10,-12,23,-25,-56,-57,-8,-14,-66,-68,61,61,61,61,61,61,61,61,61,61,-116,61,-16,61,23,-66,23,61,61,61,61,61,61,61,61,61,-48,-49,-50,-51,-52,-53,-54,-55,-56,-57,-1,-13,-11,23,-37,-38,-39,-40,-41,-42,-43,-44,61,23,23,-7,-15,-10,-9,]),'PLUS':([0,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,21,23,25,26,28,29,30,31,32,33,34,35,36,37,38,39,40,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,64,67,72,74,76,77,78,79,80,81,82,83,84,85,86,87,88,93,95,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,115,118,119,121,122,123,124,125,128,129,131,132,133,135,136,137,138,139,140,141,142,143,144,145,146,147,148,149,150,152,153,154,155,156,157,158,159,160,164,165,166,167,168,169,171,172,173,174,175,176,177,178,179,180,181,184,185,187,189,190,191,192,193,194,197,198,199,200,201,202,203,204,207,208,209,210,211,212,213,214,216,217,218,220,221,222,223,224,226,227,228,229,230,231,232,233,234,235,236,237,239,240,241,],[32,32,-86,-17,-18,-24,-2,-3,-4,-5,-6,-26,-27,-28,-29,-30,48,32,32,-47,32,-22,32,32,-90,-92,-93,32,32,32,-34,-35,-36,-45,-46,32,-87,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,48,-22,32,-47,32,48,48,32,32,48,32,32,32,32,32,32,32,32,48,-97,-98,-99,48,32,-100,-101,-102,-103,-104,-105,-106,48,48,48,48,48,48,48,48,48,32,32,32,32,-23,-56,32,32,48,32,-25,48,-57,48,32,-47,32,48,48,48,48,48,48,48,-67,-91,32,32,32,48,-10,-12,32,-25,48,-56,-57,-8,48,48,-14,-66,-68,32,32,48,32,32,32,32,32,32,32,32,-116,32,48,48,48,-16,32,32,-66,32,32,32,32,32,32,32,32,32,32,48,48,48,48,48,48,48,48,-56,-57,-1,48,-13,-11,48,32,48,48,48,48,48,48,48,48,32,32,32,-7,-15,-10,-9,]),'MINUS':([0,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,21,23,25,26,28,29,30,31,32,33,34,35,36,37,38,39,40,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,64,67,72,74,76,77,78,79,80,81,82,83,84,85,86,87,88,93,95,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,115,118,119,121,122,123,124,125,128,129,131,132,133,135,136,137,138,139,140,141,142,143,144,145,146,147,148,149,150,152,153,154,155,156,157,158,159,160,164,165,166,167,168,169,171,172,173,174,175,176,177,178,179,180,181,184,185,187,189,190,191,192,193,194,197,198,199,200,201,202,203,204,207,208,209,210,211,212,213,214,216,217,218,220,221,222,223,224,226,227,228,229,230,231,232,233,234,235,236,237,239,240,241,],[33,33,-86,-17,-18,-24,-2,-3,-4,-5,-6,-26,-27,-28,-29,-30,49,33,33,-47,33,-22,33,33,-90,-92,-93,33,33,33,-34,-35,-36,-45,-46,33,-87,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,49,-22,33,-47,33,49,49,33,33,49,33,33,33,33,33,33,33,33,49,-97,-98,-99,49,33,-100,-101,-102,-103,-104,-105,-106,49,49,49,49,49,49,49,49,49,33,33,33,33,-23,-56,33,33,49,33,-25,49,-57,49,33,-47,33,49,49,49,49,49,49,49,-67,-91,33,33,33,49,-10,-12,33,-25,49,-56,-57,-8,49,49,-14,-66,-68,33,33,49,33,33,33,33,33,33,33,33,-116,33,49,49,49,-16,33,33,-66,33,33,33,33,33,33,33,33,33,33,49,49,49,49,49,49,49,49,-56,-57,-1,49,-13,-11,49,33,49,49,49,49,49,49,49,49,33,33,33,-7,-15,-10,-9,]),'NOT':([0,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,21,23,25,26,28,29,30,31,32,33,34,35,36,37,38,39,40,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,60,61,62,63,72,74,77,78,79,80,81,82,83,84,85,86,87,88,95,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,115,118,119,121,122,123,124,128,129,132,133,135,136,137,138,139,140,141,142,143,144,145,146,147,148,149,152,153,154,155,157,158,159,165,166,167,168,169,172,173,174,175,176,177,178,179,180,181,189,190,191,192,193,194,197,198,199,200,201,202,203,204,207,208,209,210,211,212,213,214,216,217,218,221,222,224,226,227,228,229,230,231,232,233,234,235,236,237,239,240,241,],[34,34,-86,-17,-18,-24,-2,-3,-4,-5,-6,-26,-27,-28,-29,-30,-31,34,34,-47,34,-22,34,34,-90,-92,-93,34,34,34,-34,-35,-36,-45,-46,34,-87,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,-22,34,-47,34,34,34,34,34,34,34,34,34,34,34,-84,-97,-98,-99,34,-100,-101,-102,-103,-104,-105,-106,-107,-108,-109,-110,-111,-112,-113,-114,-115,34,34,34,34,-23,-56,34,34,34,-25,-57,-58,34,-47,34,-59,-60,-61,-62,-63,-64,-65,-67,-91,34,34,34,-10,-12,34,-25,-56,-57,-8,-14,-66,-68,34,34,34,34,34,34,34,34,34,34,-116,34,-16,34,34,-66,34,34,34,34,34,34,34,34,34,34,-48,-49,-50,-51,-52,-53,-54,-55,-56,-57,-1,-13,-11,34,-37,-38,-39,-40,-41,-42,-43,-44,34,34,34,-7,-15,-10,-9,]),'NUMBER':([0,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,21,23,25,26,28,29,30,31,32,33,34,35,36,37,38,39,40,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,60,61,62,63,72,74,77,78,79,80,81,82,83,84,85,86,87,88,95,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,115,118,119,121,122,123,124,128,129,132,133,135,136,137,138,139,140,141,142,143,144,145,146,147,148,149,152,153,154,155,157,158,159,165,166,167,168,169,172,173,174,175,176,177,178,179,180,181,189,190,191,192,193,194,197,198,199,200,201,202,203,204,207,208,209,210,211,212,213,214,216,217,218,221,222,224,226,227,228,229,230,231,232,233,234,235,236,237,239,240,241,],[35,35,-86,-17,-18,-24,-2,-3,-4,-5,-6,-26,-27,-28,-29,-30,-31,35,35,-47,35,-22,35,35,-90,-92,-93,35,35,35,-34,-35,-36,-45,-46,35,-87,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,-22,35,-47,35,35,35,35,35,35,35,35,35,35,35,-84,-97,-98,-99,35,-100,-101,-102,-103,-104,-105,-106,-107,-108,-109,-110,-111,-112,-113,-114,-115,35,35,35,35,-23,-56,35,35,35,-25,-57,-58,35,-47,35,-59,-60,-61,-62,-63,-64,-65,-67,-91,35,35,35,-10,-12,35,-25,-56,-57,-8,-14,-66,-68,35,35,35,35,35,35,35,35,35,35,-116,35,-16,35,35,-66,35,35,35,35,35,35,35,35,35,35,-48,-49,-50,-51,-52,-53,-54,-55,-56,-57,-1,-13,-11,35,-37,-38,-39,-40,-41,-42,-43,-44,35,35,35,-7,-15,-10,-9,]),'STRING':([0,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,21,23,25,26,28,29,30,31,32,33,34,35,36,37,38,39,40,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,60,61,62,63,72,74,77,78,79,80,81,82,83,84,85,86,87,88,95,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,115,118,119,121,122,123,124,128,129,132,133,135,136,137,138,139,140,141,142,143,144,145,146,147,148,149,152,153,154,155,157,158,159,165,166,167,168,169,172,173,174,175,176,177,178,179,180,181,189,190,191,192,193,194,197,198,199,200,201,202,203,204,207,208,209,210,211,212,213,214,216,217,218,221,222,224,226,227,228,229,230,231,232,233,234,235,236,237,239,240,241,],[36,36,-86,-17,-18,-24,-2,-3,-4,-5,-6,-26,-27,-28,-29,-30,-31,36,36,-47,36,-22,36,36,-90,-92,-93,36,36,36,-34,-35,-36,-45,-46,36,-87,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,-22,36,-47,36,36,36,36,36,36,36,36,36,36,36,-84,-97,-98,-99,36,-100,-101,-102,-103,-104,-105,-106,-107,-108,-109,-110,-111,-112,-113,-114,-115,36,36,36,36,-23,-56,36,36,36,-25,-57,-58,36,-47,36,-59,-60,-61,-62,-63,-64,-65,-67,-91,36,36,36,-10,-12,36,-25,-56,-57,-8,-14,-66,-68,36,36,36,36,36,36,36,36,36,36,-116,36,-16,36,36,-66,36,36,36,36,36,36,36,36,36,36,-48,-49,-50,-51,-52,-53,-54,-55,-56,-57,-1,-13,-11,36,-37,-38,-39,-40,-41,-42,-43,-44,36,36,36,-7,-15,-10,-9,]),'TRUE':([0,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,21,23,25,26,28,29,30,31,32,33,34,35,36,37,38,39,40,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,60,61,62,63,72,74,77,78,79,80,81,82,83,84,85,86,87,88,95,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,115,118,119,121,122,123,124,128,129,132,133,135,136,137,138,139,140,141,142,143,144,145,146,147,148,149,152,153,154,155,157,158,159,165,166,167,168,169,172,173,174,175,176,177,178,179,180,181,189,190,191,192,193,194,197,198,199,200,201,202,203,204,207,208,209,210,211,212,213,214,216,217,218,221,222,224,226,227,228,229,230,231,232,233,234,235,236,237,239,240,241,],[37,37,-86,-17,-18,-24,-2,-3,-4,-5,-6,-26,-27,-28,-29,-30,-31,37,37,-47,37,-22,37,37,-90,-92,-93,37,37,37,-34,-35,-36,-45,-46,37,-87,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,-22,37,-47,37,37,37,37,37,37,37,37,37,37,37,-84,-97,-98,-99,37,-100,-101,-102,-103,-104,-105,-106,-107,-108,-109,-110,-111,-112,-113,-114,-115,37,37,37,37,-23,-56,37,37,37,-25,-57,-58,37,-47,37,-59,-60,-61,-62,-63,-64,-65,-67,-91,37,37,37,-10,-12,37,-25,-56,-57,-8,-14,-66,-68,37,37,37,37,37,37,37,37,37,37,-116,37,-16,37,37,-66,37,37,37,37,37,37,37,37,37,37,-48,-49,-50,-51,-52,-53,-54,-55,-56,-57,-1,-13,-11,37,-37,-38,-39,-40,-41,-42,-43,-44,37,37,37,-7,-15,-10,-9,]),'FALSE':([0,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,21,23,25,26,28,29,30,31,32,33,34,35,36,37,38,39,40,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,60,61,62,63,72,74,77,78,79,80,81,82,83,84,85,86,87,88,95,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,115,118,119,121,122,123,124,128,129,132,133,135,136,137,138,139,140,141,142,143,144,145,146,147,148,149,152,153,154,155,157,158,159,165,166,167,168,169,172,173,174,175,176,177,178,179,180,181,189,190,191,192,193,194,197,198,199,200,201,202,203,204,207,208,209,210,211,212,213,214,216,217,218,221,222,224,226,227,228,229,230,231,232,233,234,235,236,237,239,240,241,],[38,38,-86,-17,-18,-24,-2,-3,-4,-5,-6,-26,-27,-28,-29,-30,-31,38,38,-47,38,-22,38,38,-90,-92,-93,38,38,38,-34,-35,-36,-45,-46,38,-87,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,-22,38,-47,38,38,38,38,38,38,38,38,38,38,38,-84,-97,-98,-99,38,-100,-101,-102,-103,-104,-105,-106,-107,-108,-109,-110,-111,-112,-113,-114,-115,38,38,38,38,-23,-56,38,38,38,-25,-57,-58,38,-47,38,-59,-60,-61,-62,-63,-64,-65,-67,-91,38,38,38,-10,-12,38,-25,-56,-57,-8,-14,-66,-68,38,38,38,38,38,38,38,38,38,38,-116,38,-16,38,38,-66,38,38,38,38,38,38,38,38,38,38,-48,-49,-50,-51,-52,-53,-54,-55,-56,-57,-1,-13,-11,38,-37,-38,-39,-40,-41,-42,-43,-44,38,38,38,-7,-15,-10,-9,]),'NONE':([0,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,21,23,25,26,28,29,30,31,32,33,34,35,36,37,38,39,40,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,60,61,62,63,72,74,77,78,79,80,81,82,83,84,85,86,87,88,95,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,115,118,119,121,122,123,124,128,129,132,133,135,136,137,138,139,140,141,142,143,144,145,146,147,148,149,152,153,154,155,157,158,159,165,166,167,168,169,172,173,174,175,176,177,178,179,180,181,189,190,191,192,193,194,197,198,199,200,201,202,203,204,207,208,209,210,211,212,213,214,216,217,218,221,222,224,226,227,228,229,230,231,232,233,234,235,236,237,239,240,241,],[39,39,-86,-17,-18,-24,-2,-3,-4,-5,-6,-26,-27,-28,-29,-30,-31,39,39,-47,39,-22,39,39,-90,-92,-93,39,39,39,-34,-35,-36,-45,-46,39,-87,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,-22,39,-47,39,39,39,39,39,39,39,39,39,39,39,-84,-97,-98,-99,39,-100,-101,-102,-103,-104,-105,-106,-107,-108,-109,-110,-111,-112,-113,-114,-115,39,39,39,39,-23,-56,39,39,39,-25,-57,-58,39,-47,39,-59,-60,-61,-62,-63,-64,-65,-67,-91,39,39,39,-10,-12,39,-25,-56,-57,-8,-14,-66,-68,39,39,39,39,39,39,39,39,39,39,-116,39,-16,39,39,-66,39,39,39,39,39,39,39,39,39,39,-48,-49,-50,-51,-52,-53,-54,-55,-56,-57,-1,-13,-11,39,-37,-38,-39,-40,-41,-42,-43,-44,39,39,39,-7,-15,-10,-9,]),'ID':([0,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,28,29,30,31,32,33,34,35,36,37,38,39,40,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,60,61,62,63,72,73,74,77,78,79,80,81,82,83,84,85,86,87,88,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,118,119,120,121,122,123,124,128,129,132,133,135,136,137,138,139,140,141,142,143,144,145,146,147,148,149,152,153,154,155,157,158,159,165,166,167,168,169,172,173,174,175,176,177,178,179,180,181,189,190,191,192,193,194,196,197,198,199,200,201,202,203,204,207,208,209,210,211,212,213,214,216,217,218,221,222,224,226,227,228,229,230,231,232,233,234,235,236,237,239,240,241,],[21,21,-86,-17,-18,-24,-2,-3,-4,-5,-6,-26,-27,-28,-29,-30,-31,62,62,65,-47,66,62,71,-22,62,62,-90,-92,-93,62,62,62,-34,-35,-36,-45,-46,62,-87,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,-22,62,-47,62,62,129,62,136,62,62,62,62,62,62,62,-84,-97,-98,-99,62,151,-100,-101,-102,-103,-104,-105,-106,-107,-108,-109,-110,-111,-112,-113,-114,-115,21,155,62,21,62,161,-23,-56,62,21,62,-25,-57,-58,62,-47,62,-59,-60,-61,-62,-63,-64,-65,-67,-91,62,62,62,-10,-12,21,-25,-56,-57,-8,-14,-66,-68,62,62,62,62,62,62,62,62,62,62,-116,62,-16,62,21,-66,21,62,161,62,62,62,62,62,62,62,62,-48,-49,-50,-51,-52,-53,-54,-55,-56,-57,-1,-13,-11,21,-37,-38,-39,-40,-41,-42,-43,-44,62,21,21,-7,-15,-10,-9,]),'LBRACKET':([0,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,21,23,25,26,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,60,61,62,63,72,74,77,78,79,80,81,82,83,84,85,86,87,88,95,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,115,118,119,121,122,123,124,128,129,132,133,134,135,136,137,138,139,140,141,142,143,144,145,146,147,148,149,151,152,153,154,155,157,158,159,165,166,167,168,169,172,173,174,175,176,177,178,179,180,181,188,189,190,191,192,193,194,197,198,199,200,201,202,203,204,207,208,209,210,211,212,213,214,216,217,218,221,222,224,226,227,228,229,230,231,232,233,234,235,236,237,239,240,241,],[26,26,-86,-17,-18,-24,-2,-3,-4,-5,-6,-26,-27,-28,-29,-30,-31,63,63,-47,63,72,63,63,-90,-92,-93,63,63,63,-34,-35,-36,-45,-46,63,95,-87,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,115,63,-47,63,63,63,137,63,63,63,63,63,63,63,-84,-97,-98,-99,63,-100,-101,-102,-103,-104,-105,-106,-107,-108,-109,-110,-111,-112,-113,-114,-115,26,63,26,63,-23,-56,63,26,63,-25,-57,-58,95,63,-47,63,-59,-60,-61,-62,-63,-64,-65,-67,-91,63,63,63,-77,-10,-12,26,-25,-56,-57,-8,-14,-66,-68,63,63,63,63,63,63,63,63,63,63,-116,63,-76,-16,63,26,-66,26,63,63,63,63,63,63,63,63,63,-48,-49,-50,-51,-52,-53,-54,-55,-56,-57,-1,-13,-11,26,-37,-38,-39,-40,-41,-42,-43,-44,63,26,26,-7,-15,-10,-9,]),'LBRACE':([0,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,21,23,25,26,28,29,30,31,32,33,34,35,36,37,38,39,40,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,60,61,62,63,72,74,77,78,79,80,81,82,83,84,85,86,87,88,95,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,115,118,119,121,122,123,124,128,129,132,133,135,136,137,138,139,140,141,142,143,144,145,146,147,148,149,152,153,154,155,157,158,159,165,166,167,168,169,172,173,174,175,176,177,178,179,180,181,189,190,191,192,193,194,197,198,199,200,201,202,203,204,207,208,209,210,211,212,213,214,216,217,218,221,222,224,226,227,228,229,230,231,232,233,234,235,236,237,239,240,241,],[40,40,-86,-17,-18,-24,-2,-3,-4,-5,-6,-26,-27,-28,-29,-30,-31,40,40,-47,40,-22,40,40,-90,-92,-93,40,40,40,-34,-35,-36,-45,-46,40,-87,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,-22,40,-47,40,40,40,40,40,40,40,40,40,40,40,-84,-97,-98,-99,40,-100,-101,-102,-103,-104,-105,-106,-107,-108,-109,-110,-111,-112,-113,-114,-115,40,40,40,40,-23,-56,40,40,40,-25,-57,-58,40,-47,40,-59,-60,-61,-62,-63,-64,-65,-67,-91,40,40,40,-10,-12,40,-25,-56,-57,-8,-14,-66,-68,40,40,40,40,40,40,40,40,40,40,-116,40,-16,40,40,-66,40,40,40,40,40,40,40,40,40,40,-48,-49,-50,-51,-52,-53,-54,-55,-56,-57,-1,-13,-11,40,-37,-38,-39,-40,-41,-42,-43,-44,40,40,40,-7,-15,-10,-9,]),'$end':([1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,21,25,28,29,30,31,35,36,37,38,39,42,60,62,85,86,87,88,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,121,122,129,132,133,136,138,139,140,141,142,143,144,145,146,152,153,155,157,158,159,165,166,167,180,189,192,207,208,209,210,211,212,213,214,216,217,218,221,222,226,227,228,229,230,231,232,233,237,239,240,241,],[0,-82,-86,-17,-18,-24,-2,-3,-4,-5,-6,-26,-27,-28,-29,-30,-31,-47,-22,-85,-90,-92,-93,-34,-35,-36,-45,-46,-87,-22,-47,-84,-97,-98,-99,-100,-101,-102,-103,-104,-105,-106,-107,-108,-109,-110,-111,-112,-113,-114,-115,-23,-56,-25,-57,-58,-47,-59,-60,-61,-62,-63,-64,-65,-67,-91,-10,-12,-25,-56,-57,-8,-14,-66,-68,-116,-16,-66,-48,-49,-50,-51,-52,-53,-54,-55,-56,-57,-1,-13,-11,-37,-38,-39,-40,-41,-42,-43,-44,-7,-15,-10,-9,]),'DEDENT':([3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,21,25,28,29,30,31,35,36,37,38,39,42,60,62,85,86,87,88,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,121,122,129,132,133,136,138,139,140,141,142,143,144,145,146,152,153,155,157,158,159,165,166,167,180,189,191,192,207,208,209,210,211,212,213,214,216,217,218,221,222,226,227,228,229,230,231,232,233,237,239,240,241,],[-86,-17,-18,-24,-2,-3,-4,-5,-6,-26,-27,-28,-29,-30,-31,-47,-22,-85,-90,-92,-93,-34,-35,-36,-45,-46,-87,-22,-47,-84,-97,-98,-99,-100,-101,-102,-103,-104,-105,-106,-107,-108,-109,-110,-111,-112,-113,-114,-115,-23,-56,-25,-57,-58,-47,-59,-60,-61,-62,-63,-64,-65,-67,-91,-10,-12,-25,-56,-57,-8,-14,-66,-68,-116,-16,221,-66,-48,-49,-50,-51,-52,-53,-54,-55,-56,-57,-1,-13,-11,-37,-38,-39,-40,-41,-42,-43,-44,-7,-15,-10,-9,]),'ELIF':([6,12,13,14,15,16,17,21,25,28,29,30,31,35,36,37,38,39,60,62,85,86,87,88,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,121,122,129,132,133,136,138,139,140,141,142,143,144,145,146,152,153,155,157,158,166,167,180,192,207,208,209,210,211,212,213,214,216,217,221,226,227,228,229,230,231,232,233,240,],[-24,-26,-27,-28,-29,-30,-31,-47,-22,-85,-90,-92,-93,-34,-35,-36,-45,-46,-22,-47,-84,-97,-98,-99,-100,-101,-102,-103,-104,-105,-106,-107,-108,-109,-110,-111,-112,-113,-114,-115,-23,-56,-25,-57,-58,-47,-59,-60,-61,-62,-63,-64,-65,-67,-91,190,-12,-25,-56,-57,-66,-68,-116,-66,-48,-49,-50,-51,-52,-53,-54,-55,-56,-57,-13,-37,-38,-39,-40,-41,-42,-43,-44,190,]),'ELSE':([6,12,13,14,15,16,17,21,25,28,29,30,31,35,36,37,38,39,60,62,85,86,87,88,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,121,122,129,132,133,136,138,139,140,141,142,143,144,145,146,152,153,155,157,158,166,167,180,189,192,207,208,209,210,211,212,213,214,216,217,221,226,227,228,229,230,231,232,233,240,241,],[-24,-26,-27,-28,-29,-30,-31,-47,-22,-85,-90,-92,-93,-34,-35,-36,-45,-46,-22,-47,-84,-97,-98,-99,-100,-101,-102,-103,-104,-105,-106,-107,-108,-109,-110,-111,-112,-113,-114,-115,-23,-56,-25,-57,-58,-47,-59,-60,-61,-62,-63,-64,-65,-67,-91,-10,-12,-25,-56,-57,-66,-68,-116,219,-66,-48,-49,-50,-51,-52,-53,-54,-55,-56,-57,-13,-37,-38,-39,-40,-41,-42,-43,-44,-10,-9,]),'POWER':([17,21,25,35,36,37,38,39,59,60,62,64,67,76,85,86,87,88,93,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,121,122,125,129,131,132,133,136,138,139,140,141,142,143,144,145,146,150,155,156,157,158,160,164,166,167,171,180,184,185,187,192,207,208,209,210,211,212,213,214,216,217,220,223,226,227,228,229,230,231,232,233,],[43,-47,-22,-34,-35,-36,-45,-46,43,-22,-47,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,-23,-56,43,-25,43,-57,43,-47,43,43,43,43,43,43,43,-67,-91,43,-25,43,-56,-57,43,43,-66,-68,43,-116,43,43,43,-66,43,43,43,43,43,43,43,43,-56,-57,43,43,43,43,43,43,43,43,43,43,]),'TIMES':([17,21,25,35,36,37,38,39,59,60,62,64,67,76,85,86,87,88,93,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,121,122,125,129,131,132,133,136,138,139,140,141,142,143,144,145,146,150,155,156,157,158,160,164,166,167,171,180,184,185,187,192,207,208,209,210,211,212,213,214,216,217,220,223,226,227,228,229,230,231,232,233,],[44,-47,-22,-34,-35,-36,-45,-46,44,-22,-47,44,44,44,44,-97,-98,-99,44,-100,-101,-102,-103,-104,44,44,44,44,44,44,44,44,44,44,44,-23,-56,44,-25,44,-57,44,-47,44,44,44,44,44,44,44,-67,-91,44,-25,44,-56,-57,44,44,-66,-68,44,-116,44,44,44,-66,44,44,44,44,44,44,44,44,-56,-57,44,44,44,44,44,44,44,44,44,44,]),'DIVIDE':([17,21,25,35,36,37,38,39,59,60,62,64,67,76,85,86,87,88,93,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,121,122,125,129,131,132,133,136,138,139,140,141,142,143,144,145,146,150,155,156,157,158,160,164,166,167,171,180,184,185,187,192,207,208,209,210,211,212,213,214,216,217,220,223,226,227,228,229,230,231,232,233,],[45,-47,-22,-34,-35,-36,-45,-46,45,-22,-47,45,45,45,45,-97,-98,-99,45,-100,-101,-102,-103,-104,45,45,45,45,45,45,45,45,45,45,45,-23,-56,45,-25,45,-57,45,-47,45,45,45,45,45,45,45,-67,-91,45,-25,45,-56,-57,45,45,-66,-68,45,-116,45,45,45,-66,45,45,45,45,45,45,45,45,-56,-57,45,45,45,45,45,45,45,45,45,45,]),'FLOOR_DIVIDE':([17,21,25,35,36,37,38,39,59,60,62,64,67,76,85,86,87,88,93,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,121,122,125,129,131,132,133,136,138,139,140,141,142,143,144,145,146,150,155,156,157,158,160,164,166,167,171,180,184,185,187,192,207,208,209,210,211,212,213,214,216,217,220,223,226,227,228,229,230,231,232,233,],[46,-47,-22,-34,-35,-36,-45,-46,46,-22,-47,46,46,46,46,-97,-98,-99,46,-100,-101,-102,-103,-104,46,46,46,46,46,46,46,46,46,46,46,-23,-56,46,-25,46,-57,46,-47,46,46,46,46,46,46,46,-67,-91,46,-25,46,-56,-57,46,46,-66,-68,46,-116,46,46,46,-66,46,46,46,46,46,46,46,46,-56,-57,46,46,46,46,46,46,46,46,46,46,]),'MOD':([17,21,25,35,36,37,38,39,59,60,62,64,67,76,85,86,87,88,93,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,121,122,125,129,131,132,133,136,138,139,140,141,142,143,144,145,146,150,155,156,157,158,160,164,166,167,171,180,184,185,187,192,207,208,209,210,211,212,213,214,216,217,220,223,226,227,228,229,230,231,232,233,],[47,-47,-22,-34,-35,-36,-45,-46,47,-22,-47,47,47,47,47,-97,-98,-99,47,-100,-101,-102,-103,-104,47,47,47,47,47,47,47,47,47,47,47,-23,-56,47,-25,47,-57,47,-47,47,47,47,47,47,47,47,-67,-91,47,-25,47,-56,-57,47,47,-66,-68,47,-116,47,47,47,-66,47,47,47,47,47,47,47,47,-56,-57,47,47,47,47,47,47,47,47,47,47,]),'EQUALS':([17,21,25,35,36,37,38,39,59,60,62,64,67,76,85,86,87,88,93,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,121,122,125,129,131,132,133,136,138,139,140,141,142,143,144,145,146,150,155,156,157,158,160,164,166,167,171,180,184,185,187,192,207,208,209,210,211,212,213,214,216,217,220,223,226,227,228,229,230,231,232,233,],[50,-47,-22,-34,-35,-36,-45,-46,50,-22,-47,50,50,50,50,-97,-98,-99,50,-100,-101,-102,-103,-104,-105,-106,-107,-108,-109,-110,-111,-112,50,50,50,-23,-56,50,-25,50,-57,50,-47,50,50,50,50,50,50,50,-67,-91,50,-25,50,-56,-57,50,50,-66,-68,50,-116,50,50,50,-66,50,50,50,50,50,50,50,50,-56,-57,50,50,50,50,50,50,50,50,50,50,]),'NOT_EQUALS':([17,21,25,35,36,37,38,39,59,60,62,64,67,76,85,86,87,88,93,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,121,122,125,129,131,132,133,136,138,139,140,141,142,143,144,145,146,150,155,156,157,158,160,164,166,167,171,180,184,185,187,192,207,208,209,210,211,212,213,214,216,217,220,223,226,227,228,229,230,231,232,233,],[51,-47,-22,-34,-35,-36,-45,-46,51,-22,-47,51,51,51,51,-97,-98,-99,51,-100,-101,-102,-103,-104,-105,-106,-107,-108,-109,-110,-111,-112,51,51,51,-23,-56,51,-25,51,-57,51,-47,51,51,51,51,51,51,51,-67,-91,51,-25,51,-56,-57,51,51,-66,-68,51,-116,51,51,51,-66,51,51,51,51,51,51,51,51,-56,-57,51,51,51,51,51,51,51,51,51,51,]),'LESS_THAN':([17,21,25,35,36,37,38,39,59,60,62,64,67,76,85,86,87,88,93,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,121,122,125,129,131,132,133,136,138,139,140,141,142,143,144,145,146,150,155,156,157,158,160,164,166,167,171,180,184,185,187,192,207,208,209,210,211,212,213,214,216,217,220,223,226,227,228,229,230,231,232,233,],[52,-47,-22,-34,-35,-36,-45,-46,52,-22,-47,52,52,52,52,-97,-98,-99,52,-100,-101,-102,-103,-104,-105,-106,-107,-108,-109,-110,-111,-112,52,52,52,-23,-56,52,-25,52,-57,52,-47,52,52,52,52,52,52,52,-67,-91,52,-25,52,-56,-57,52,52,-66,-68,52,-116,52,52,52,-66,52,52,52,52,52,52,52,52,-56,-57,52,52,52,52,52,52,52,52,52,52,]),'LESS_THAN_EQUALS':([17,21,25,35,36,37,38,39,59,60,62,64,67,76,85,86,87,88,93,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,121,122,125,129,131,132,133,136,138,139,140,141,142,143,144,145,146,150,155,156,157,158,160,164,166,167,171,180,184,185,187,192,207,208,209,210,211,212,213,214,216,217,220,223,226,227,228,229,230,231,232,233,],[53,-47,-22,-34,-35,-36,-45,-46,53,-22,-47,53,53,53,53,-97,-98,-99,53,-100,-101,-102,-103,-104,-105,-106,-107,-108,-109,-110,-111,-112,53,53,53,-23,-56,53,-25,53,-57,53,-47,53,53,53,53,53,53,53,-67,-91,53,-25,53,-56,-57,53,53,-66,-68,53,-116,53,53,53,-66,53,53,53,53,53,53,53,53,-56,-57,53,53,53,53,53,53,53,53,53,53,]),'GREATER_THAN':([17,21,25,35,36,37,38,39,59,60,62,64,67,76,85,86,87,88,93,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,121,122,125,129,131,132,133,136,138,139,140,141,142,143,144,145,146,150,155,156,157,158,160,164,166,167,171,180,184,185,187,192,207,208,209,210,211,212,213,214,216,217,220,223,226,227,228,229,230,231,232,233,],[54,-47,-22,-34,-35,-36,-45,-46,54,-22,-47,54,54,54,54,-97,-98,-99,54,-100,-101,-102,-103,-104,-105,-106,-107,-108,-109,-110,-111,-112,54,54,54,-23,-56,54,-25,54,-57,54,-47,54,54,54,54,54,54,54,-67,-91,54,-25,54,-56,-57,54,54,-66,-68,54,-116,54,54,54,-66,54,54,54,54,54,54,54,54,-56,-57,54,54,54,54,54,54,54,54,54,54,]),'GREATER_THAN_EQUALS':([17,21,25,35,36,37,38,39,59,60,62,64,67,76,85,86,87,88,93,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,121,122,125,129,131,132,133,136,138,139,140,141,142,143,144,145,146,150,155,156,157,158,160,164,166,167,171,180,184,185,187,192,207,208,209,210,211,212,213,214,216,217,220,223,226,227,228,229,230,231,232,233,],[55,-47,-22,-34,-35,-36,-45,-46,55,-22,-47,55,55,55,55,-97,-98,-99,55,-100,-101,-102,-103,-104,-105,-106,-107,-108,-109,-110,-111,-112,55,55,55,-23,-56,55,-25,55,-57,55,-47,55,55,55,55,55,55,55,-67,-91,55,-25,55,-56,-57,55,55,-66,-68,55,-116,55,55,55,-66,55,55,55,55,55,55,55,55,-56,-57,55,55,55,55,55,55,55,55,55,55,]),'IN':([17,21,25,35,36,37,38,39,59,60,62,64,65,67,76,85,86,87,88,93,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,121,122,125,129,131,132,133,136,138,139,140,141,142,143,144,145,146,150,155,156,157,158,160,164,166,167,171,180,184,185,187,192,207,208,209,210,211,212,213,214,216,217,220,223,226,227,228,229,230,231,232,233,],[56,-47,-22,-34,-35,-36,-45,-46,56,-22,-47,56,119,56,56,56,-97,-98,-99,56,-100,-101,-102,-103,-104,-105,-106,-107,-108,-109,-110,-111,-112,56,-114,-115,-23,-56,56,-25,56,-57,56,-47,56,56,56,56,56,56,56,-67,-91,56,-25,56,-56,-57,56,56,-66,-68,56,-116,56,56,56,-66,56,56,56,56,56,56,56,56,-56,-57,56,56,56,56,56,56,56,56,56,56,]),'AND':([17,21,25,35,36,37,38,39,59,60,62,64,67,76,85,86,87,88,93,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,121,122,125,129,131,132,133,136,138,139,140,141,142,143,144,145,146,150,155,156,157,158,160,164,166,167,171,180,184,185,187,192,207,208,209,210,211,212,213,214,216,217,220,223,226,227,228,229,230,231,232,233,],[57,-47,-22,-34,-35,-36,-45,-46,57,-22,-47,57,57,57,57,-97,-98,-99,57,-100,-101,-102,-103,-104,-105,-106,-107,-108,-109,-110,-111,-112,57,-114,57,-23,-56,57,-25,57,-57,57,-47,57,57,57,57,57,57,57,-67,-91,57,-25,57,-56,-57,57,57,-66,-68,57,-116,57,57,57,-66,57,57,57,57,57,57,57,57,-56,-57,57,57,57,57,57,57,57,57,57,57,]),'OR':([17,21,25,35,36,37,38,39,59,60,62,64,67,76,85,86,87,88,93,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,121,122,125,129,131,132,133,136,138,139,140,141,142,143,144,145,146,150,155,156,157,158,160,164,166,167,171,180,184,185,187,192,207,208,209,210,211,212,213,214,216,217,220,223,226,227,228,229,230,231,232,233,],[58,-47,-22,-34,-35,-36,-45,-46,58,-22,-47,58,58,58,58,-97,-98,-99,58,-100,-101,-102,-103,-104,-105,-106,-107,-108,-109,-110,-111,-112,58,-114,-115,-23,-56,58,-25,58,-57,58,-47,58,58,58,58,58,58,58,-67,-91,58,-25,58,-56,-57,58,58,-66,-68,58,-116,58,58,58,-66,58,58,58,58,58,58,58,58,-56,-57,58,58,58,58,58,58,58,58,58,58,]),'DOT':([21,25,35,36,37,38,39,41,60,62,122,129,132,134,136,145,146,151,155,157,158,166,167,188,192,216,217,],[-47,73,-34,-35,-36,-45,-46,96,114,-47,-56,-25,-57,96,-47,-67,-91,-77,-25,-56,-57,-66,-68,-76,-66,-56,-57,]),'ASSIGN':([21,27,41,122,129,132,134,136,151,161,166,188,216,217,],[-73,77,-71,-74,172,-75,-70,-73,-77,194,197,-76,-74,-75,]),'PLUS_ASSIGN':([21,27,41,122,129,132,134,136,151,166,188,216,217,],[-73,78,-71,-74,173,-75,-70,-73,-77,198,-76,-74,-75,]),'MINUS_ASSIGN':([21,27,41,122,129,132,134,136,151,166,188,216,217,],[-73,79,-71,-74,174,-75,-70,-73,-77,199,-76,-74,-75,]),'TIMES_ASSIGN':([21,27,41,122,129,132,134,136,151,166,188,216,217,],[-73,80,-71,-74,175,-75,-70,-73,-77,200,-76,-74,-75,]),'DIVIDE_ASSIGN':([21,27,41,122,129,132,134,136,151,166,188,216,217,],[-73,81,-71,-74,176,-75,-70,-73,-77,201,-76,-74,-75,]),'FLOOR_DIVIDE_ASSIGN':([21,27,41,122,129,132,134,136,151,166,188,216,217,],[-73,82,-71,-74,177,-75,-70,-73,-77,202,-76,-74,-75,]),'MOD_ASSIGN':([21,27,41,122,129,132,134,136,151,166,188,216,217,],[-73,83,-71,-74,178,-75,-70,-73,-77,203,-76,-74,-75,]),'POWER_ASSIGN':([21,27,41,122,129,132,134,136,151,166,188,216,217,],[-73,84,-71,-74,179,-75,-70,-73,-77,204,-76,-74,-75,]),'RPAREN':([23,35,36,37,38,39,60,61,62,67,68,69,70,74,86,87,88,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,116,120,121,130,131,135,145,146,155,157,158,161,162,163,164,167,180,181,182,192,196,215,223,225,],[-129,-34,-35,-36,-45,-46,-22,-129,-47,121,122,-125,-126,-119,-97,-98,-99,-100,-101,-102,-103,-104,-105,-106,-107,-108,-109,-110,-111,-112,-113,-114,-115,157,-21,-23,180,-118,-129,-67,-91,-25,-56,-57,-32,195,-20,-128,-68,-116,-119,216,-66,-21,-117,-33,-19,]),'RBRACKET':([26,35,36,37,38,39,60,62,63,69,70,75,76,86,87,88,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,117,121,125,126,128,137,145,146,150,155,156,157,158,164,167,168,169,170,171,180,183,192,205,206,234,238,],[-129,-34,-35,-36,-45,-46,-22,-47,-129,-125,-126,132,-127,-97,-98,-99,-100,-101,-102,-103,-104,-105,-106,-107,-108,-109,-110,-111,-112,-113,-114,-115,158,-23,166,167,-81,-129,-67,-91,188,-25,192,-56,-57,-128,-68,-80,-88,-79,-89,-116,217,-66,-72,-83,-88,-78,]),'COLON':([35,36,37,38,39,59,60,62,64,71,72,86,87,88,93,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,115,121,125,127,128,145,146,155,156,157,158,160,167,168,171,180,187,192,195,205,219,220,],[-34,-35,-36,-45,-46,113,-22,-47,118,124,128,-97,-98,-99,148,-100,-101,-102,-103,-104,-105,-106,-107,-108,-109,-110,-111,-112,-113,-114,-115,128,-23,-89,168,169,-67,-91,-25,-89,-56,-57,193,-68,-88,-89,-116,148,-66,224,234,235,236,]),'COMMA':([35,36,37,38,39,60,62,67,69,76,86,87,88,90,93,94,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,121,131,145,146,147,155,157,158,161,163,164,167,180,184,185,192,223,],[-34,-35,-36,-45,-46,-22,-47,-127,123,-127,-97,-98,-99,147,-94,149,-100,-101,-102,-103,-104,-105,-106,-107,-108,-109,-110,-111,-112,-113,-114,-115,-23,181,-67,-91,-96,-25,-56,-57,-32,196,-128,-68,-116,-95,-124,-66,-33,]),'RBRACE':([35,36,37,38,39,40,60,62,86,87,88,89,90,91,92,93,94,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,121,145,146,147,155,157,158,167,180,184,185,186,192,],[-34,-35,-36,-45,-46,-129,-22,-47,-97,-98,-99,145,146,-122,-123,-94,-120,-100,-101,-102,-103,-104,-105,-106,-107,-108,-109,-110,-111,-112,-113,-114,-115,-23,-67,-91,-96,-25,-56,-57,-68,-116,-95,-124,-121,-66,]),'INDENT':([113,118,124,193,224,235,236,],[154,154,154,154,154,154,154,]),}
+_lr_action_items = {'IF':([0,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,23,26,29,30,31,32,33,37,38,39,40,41,44,65,67,92,93,94,95,96,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,133,135,136,143,147,148,151,153,154,155,156,157,158,159,160,161,167,168,169,170,172,173,174,183,184,185,198,199,208,210,211,228,229,230,231,232,233,234,235,238,239,240,243,244,249,250,251,252,253,254,255,256,257,261,264,265,267,],[19,19,-91,-19,-20,-26,-2,-3,-4,-5,-6,-30,-31,-32,-33,-34,-35,-36,-52,-24,-90,-95,-97,-99,-101,-39,-40,-41,-50,-51,-92,-24,-52,-89,-94,-107,-108,-109,-110,-111,-112,-113,-114,-115,-116,-117,-118,-119,-120,-121,-122,-123,-124,-125,-126,-127,-128,-25,-61,-62,-27,-73,-63,-52,-64,-65,-66,-67,-68,-69,-70,-77,-103,-10,-12,19,-27,-61,-73,-8,-14,-74,-83,-129,-130,-16,19,-74,-53,-54,-55,-56,-57,-58,-59,-60,-61,-73,-1,-13,-11,262,-42,-43,-44,-45,-46,-47,-48,-49,-7,-15,-10,-9,]),'WHILE':([0,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,23,26,29,30,31,32,33,37,38,39,40,41,44,65,67,92,93,94,95,96,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,133,135,136,143,147,148,151,153,154,155,156,157,158,159,160,161,167,168,169,170,172,173,174,183,184,185,198,199,208,210,211,228,229,230,231,232,233,234,235,238,239,240,243,244,250,251,252,253,254,255,256,257,261,264,265,267,],[20,20,-91,-19,-20,-26,-2,-3,-4,-5,-6,-30,-31,-32,-33,-34,-35,-36,-52,-24,-90,-95,-97,-99,-101,-39,-40,-41,-50,-51,-92,-24,-52,-89,-94,-107,-108,-109,-110,-111,-112,-113,-114,-115,-116,-117,-118,-119,-120,-121,-122,-123,-124,-125,-126,-127,-128,-25,-61,-62,-27,-73,-63,-52,-64,-65,-66,-67,-68,-69,-70,-77,-103,-10,-12,20,-27,-61,-73,-8,-14,-74,-83,-129,-130,-16,20,-74,-53,-54,-55,-56,-57,-58,-59,-60,-61,-73,-1,-13,-11,-42,-43,-44,-45,-46,-47,-48,-49,-7,-15,-10,-9,]),'FOR':([0,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,23,26,29,30,31,32,33,37,38,39,40,41,44,65,67,73,92,93,94,95,96,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,133,135,136,143,146,147,148,151,153,154,155,156,157,158,159,160,161,167,168,169,170,172,173,174,183,184,185,198,199,208,210,211,228,229,230,231,232,233,234,235,238,239,240,243,244,250,251,252,253,254,255,256,257,261,264,265,267,],[21,21,-91,-19,-20,-26,-2,-3,-4,-5,-6,-30,-31,-32,-33,-34,-35,-36,-52,-24,-90,-95,-97,-99,-101,-39,-40,-41,-50,-51,-92,-24,-52,134,-89,-94,-107,-108,-109,-110,-111,-112,-113,-114,-115,-116,-117,-118,-119,-120,-121,-122,-123,-124,-125,-126,-127,-128,-25,-61,-62,-27,134,-73,-63,-52,-64,-65,-66,-67,-68,-69,-70,-77,-103,-10,-12,21,-27,-61,-73,-8,-14,-74,-83,-129,-130,-16,21,-74,-53,-54,-55,-56,-57,-58,-59,-60,-61,-73,-1,-13,-11,-42,-43,-44,-45,-46,-47,-48,-49,-7,-15,-10,-9,]),'DEF':([0,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,23,26,29,30,31,32,33,37,38,39,40,41,44,65,67,92,93,94,95,96,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,133,135,136,143,147,148,151,153,154,155,156,157,158,159,160,161,167,168,169,170,172,173,174,183,184,185,198,199,208,210,211,228,229,230,231,232,233,234,235,238,239,240,243,244,250,251,252,253,254,255,256,257,261,264,265,267,],[22,22,-91,-19,-20,-26,-2,-3,-4,-5,-6,-30,-31,-32,-33,-34,-35,-36,-52,-24,-90,-95,-97,-99,-101,-39,-40,-41,-50,-51,-92,-24,-52,-89,-94,-107,-108,-109,-110,-111,-112,-113,-114,-115,-116,-117,-118,-119,-120,-121,-122,-123,-124,-125,-126,-127,-128,-25,-61,-62,-27,-73,-63,-52,-64,-65,-66,-67,-68,-69,-70,-77,-103,-10,-12,22,-27,-61,-73,-8,-14,-74,-83,-129,-130,-16,22,-74,-53,-54,-55,-56,-57,-58,-59,-60,-61,-73,-1,-13,-11,-42,-43,-44,-45,-46,-47,-48,-49,-7,-15,-10,-9,]),'CLASS':([0,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,23,26,29,30,31,32,33,37,38,39,40,41,44,65,67,92,93,94,95,96,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,133,135,136,143,147,148,151,153,154,155,156,157,158,159,160,161,167,168,169,170,172,173,174,183,184,185,198,199,208,210,211,228,229,230,231,232,233,234,235,238,239,240,243,244,250,251,252,253,254,255,256,257,261,264,265,267,],[25,25,-91,-19,-20,-26,-2,-3,-4,-5,-6,-30,-31,-32,-33,-34,-35,-36,-52,-24,-90,-95,-97,-99,-101,-39,-40,-41,-50,-51,-92,-24,-52,-89,-94,-107,-108,-109,-110,-111,-112,-113,-114,-115,-116,-117,-118,-119,-120,-121,-122,-123,-124,-125,-126,-127,-128,-25,-61,-62,-27,-73,-63,-52,-64,-65,-66,-67,-68,-69,-70,-77,-103,-10,-12,25,-27,-61,-73,-8,-14,-74,-83,-129,-130,-16,25,-74,-53,-54,-55,-56,-57,-58,-59,-60,-61,-73,-1,-13,-11,-42,-43,-44,-45,-46,-47,-48,-49,-7,-15,-10,-9,]),'RETURN':([0,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,23,26,29,30,31,32,33,37,38,39,40,41,44,65,67,92,93,94,95,96,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,124,129,133,135,136,138,143,147,148,151,153,154,155,156,157,158,159,160,161,167,168,169,170,172,173,174,183,184,185,198,199,208,210,211,212,228,229,230,231,232,233,234,235,238,239,240,243,244,247,250,251,252,253,254,255,256,257,259,260,261,264,265,267,],[29,29,-91,-19,-20,-26,-2,-3,-4,-5,-6,-30,-31,-32,-33,-34,-35,-36,-52,-24,-90,-95,-97,-99,-101,-39,-40,-41,-50,-51,-92,-24,-52,-89,-94,-107,-108,-109,-110,-111,-112,-113,-114,-115,-116,-117,-118,-119,-120,-121,-122,-123,-124,-125,-126,-127,-128,29,29,-25,-61,-62,29,-27,-73,-63,-52,-64,-65,-66,-67,-68,-69,-70,-77,-103,-10,-12,29,-27,-61,-73,-8,-14,-74,-83,-129,-130,-16,29,-74,29,-53,-54,-55,-56,-57,-58,-59,-60,-61,-73,-1,-13,-11,29,-42,-43,-44,-45,-46,-47,-48,-49,29,29,-7,-15,-10,-9,]),'YIELD':([0,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,23,26,29,30,31,32,33,37,38,39,40,41,44,65,67,92,93,94,95,96,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,124,129,133,135,136,138,143,147,148,151,153,154,155,156,157,158,159,160,161,167,168,169,170,172,173,174,183,184,185,198,199,208,210,211,212,228,229,230,231,232,233,234,235,238,239,240,243,244,247,250,251,252,253,254,255,256,257,259,260,261,264,265,267,],[30,30,-91,-19,-20,-26,-2,-3,-4,-5,-6,-30,-31,-32,-33,-34,-35,-36,-52,-24,-90,-95,-97,-99,-101,-39,-40,-41,-50,-51,-92,-24,-52,-89,-94,-107,-108,-109,-110,-111,-112,-113,-114,-115,-116,-117,-118,-119,-120,-121,-122,-123,-124,-125,-126,-127,-128,30,30,-25,-61,-62,30,-27,-73,-63,-52,-64,-65,-66,-67,-68,-69,-70,-77,-103,-10,-12,30,-27,-61,-73,-8,-14,-74,-83,-129,-130,-16,30,-74,30,-53,-54,-55,-56,-57,-58,-59,-60,-61,-73,-1,-13,-11,30,-42,-43,-44,-45,-46,-47,-48,-49,30,30,-7,-15,-10,-9,]),'BREAK':([0,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,23,26,29,30,31,32,33,37,38,39,40,41,44,65,67,92,93,94,95,96,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,124,129,133,135,136,138,143,147,148,151,153,154,155,156,157,158,159,160,161,167,168,169,170,172,173,174,183,184,185,198,199,208,210,211,212,228,229,230,231,232,233,234,235,238,239,240,243,244,247,250,251,252,253,254,255,256,257,259,260,261,264,265,267,],[31,31,-91,-19,-20,-26,-2,-3,-4,-5,-6,-30,-31,-32,-33,-34,-35,-36,-52,-24,-90,-95,-97,-99,-101,-39,-40,-41,-50,-51,-92,-24,-52,-89,-94,-107,-108,-109,-110,-111,-112,-113,-114,-115,-116,-117,-118,-119,-120,-121,-122,-123,-124,-125,-126,-127,-128,31,31,-25,-61,-62,31,-27,-73,-63,-52,-64,-65,-66,-67,-68,-69,-70,-77,-103,-10,-12,31,-27,-61,-73,-8,-14,-74,-83,-129,-130,-16,31,-74,31,-53,-54,-55,-56,-57,-58,-59,-60,-61,-73,-1,-13,-11,31,-42,-43,-44,-45,-46,-47,-48,-49,31,31,-7,-15,-10,-9,]),'CONTINUE':([0,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,23,26,29,30,31,32,33,37,38,39,40,41,44,65,67,92,93,94,95,96,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,124,129,133,135,136,138,143,147,148,151,153,154,155,156,157,158,159,160,161,167,168,169,170,172,173,174,183,184,185,198,199,208,210,211,212,228,229,230,231,232,233,234,235,238,239,240,243,244,247,250,251,252,253,254,255,256,257,259,260,261,264,265,267,],[32,32,-91,-19,-20,-26,-2,-3,-4,-5,-6,-30,-31,-32,-33,-34,-35,-36,-52,-24,-90,-95,-97,-99,-101,-39,-40,-41,-50,-51,-92,-24,-52,-89,-94,-107,-108,-109,-110,-111,-112,-113,-114,-115,-116,-117,-118,-119,-120,-121,-122,-123,-124,-125,-126,-127,-128,32,32,-25,-61,-62,32,-27,-73,-63,-52,-64,-65,-66,-67,-68,-69,-70,-77,-103,-10,-12,32,-27,-61,-73,-8,-14,-74,-83,-129,-130,-16,32,-74,32,-53,-54,-55,-56,-57,-58,-59,-60,-61,-73,-1,-13,-11,32,-42,-43,-44,-45,-46,-47,-48,-49,32,32,-7,-15,-10,-9,]),'PASS':([0,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,23,26,29,30,31,32,33,37,38,39,40,41,44,65,67,92,93,94,95,96,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,124,129,133,135,136,138,143,147,148,151,153,154,155,156,157,158,159,160,161,167,168,169,170,172,173,174,183,184,185,198,199,208,210,211,212,228,229,230,231,232,233,234,235,238,239,240,243,244,247,250,251,252,253,254,255,256,257,259,260,261,264,265,267,],[33,33,-91,-19,-20,-26,-2,-3,-4,-5,-6,-30,-31,-32,-33,-34,-35,-36,-52,-24,-90,-95,-97,-99,-101,-39,-40,-41,-50,-51,-92,-24,-52,-89,-94,-107,-108,-109,-110,-111,-112,-113,-114,-115,-116,-117,-118,-119,-120,-121,-122,-123,-124,-125,-126,-127,-128,33,33,-25,-61,-62,33,-27,-73,-63,-52,-64,-65,-66,-67,-68,-69,-70,-77,-103,-10,-12,33,-27,-61,-73,-8,-14,-74,-83,-129,-130,-16,33,-74,33,-53,-54,-55,-56,-57,-58,-59,-60,-61,-73,-1,-13,-11,33,-42,-43,-44,-45,-46,-47,-48,-49,33,33,-7,-15,-10,-9,]),'LPAREN':([0,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,23,24,26,27,29,30,31,32,33,34,35,36,37,38,39,40,41,42,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,65,66,67,68,72,79,81,84,85,86,87,88,89,90,91,92,93,94,95,96,103,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,124,126,129,130,133,135,136,137,138,142,143,147,148,150,151,152,153,154,155,156,157,158,159,160,161,162,163,164,167,168,169,170,172,173,174,183,184,185,186,187,190,191,192,193,194,195,196,197,198,199,200,208,209,210,211,212,214,217,218,219,220,221,222,223,224,225,228,229,230,231,232,233,234,235,238,239,240,243,244,247,250,251,252,253,254,255,256,257,258,259,260,261,262,264,265,267,],[24,24,-91,-19,-20,-26,-2,-3,-4,-5,-6,-30,-31,-32,-33,-34,-35,-36,66,66,-52,66,81,66,66,66,-97,-99,-101,66,66,66,-39,-40,-41,-50,-51,66,-92,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,81,66,-52,66,132,66,66,150,66,66,66,66,66,66,66,-89,-94,-107,-108,-109,66,-110,-111,-112,-113,-114,-115,-116,-117,-118,-119,-120,-121,-122,-123,-124,-125,-126,-127,-128,24,66,24,66,-25,-61,-62,66,24,66,-27,-73,-63,66,-52,66,-64,-65,-66,-67,-68,-69,-70,-77,-103,66,66,66,-10,-12,24,-27,-61,-73,-8,-14,-74,-83,66,66,66,66,66,66,66,66,66,66,-129,-130,66,-16,66,24,-74,24,66,66,66,66,66,66,66,66,66,66,-53,-54,-55,-56,-57,-58,-59,-60,-61,-73,-1,-13,-11,24,-42,-43,-44,-45,-46,-47,-48,-49,66,24,24,-7,66,-15,-10,-9,]),'PLUS':([0,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,23,24,26,27,29,30,31,32,33,34,35,36,37,38,39,40,41,42,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,64,65,66,67,68,69,73,79,81,83,84,85,86,87,88,89,90,91,92,93,94,95,96,101,103,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,124,126,129,130,133,135,136,137,138,139,142,143,146,147,148,150,151,152,153,154,155,156,157,158,159,160,161,162,163,164,165,167,168,169,170,171,172,173,174,175,182,183,184,185,186,187,189,190,191,192,193,194,195,196,197,198,199,200,203,204,206,208,209,210,211,212,214,217,218,219,220,221,222,223,224,225,228,229,230,231,232,233,234,235,236,238,239,240,242,243,244,246,247,249,250,251,252,253,254,255,256,257,258,259,260,261,262,264,265,266,267,],[34,34,-91,-19,-20,-26,-2,-3,-4,-5,-6,-30,-31,-32,-33,-34,-35,50,34,34,-52,34,-24,34,34,34,-97,-99,-101,34,34,34,-39,-40,-41,-50,-51,34,-92,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,50,-24,34,-52,34,50,50,34,34,50,34,34,34,34,34,34,34,34,50,50,-107,-108,-109,50,34,-110,-111,-112,-113,-114,-115,-116,50,50,50,50,50,50,50,50,50,50,50,50,34,34,34,34,-25,-61,-62,34,34,50,34,-27,50,-73,50,34,-52,34,50,50,50,50,50,50,50,-77,-103,34,34,34,50,-10,-12,34,-27,50,-61,-73,-8,50,50,-14,-74,-83,34,34,50,34,34,34,34,34,34,34,34,-129,-130,34,50,50,50,-16,34,34,-74,34,34,34,34,34,34,34,34,34,34,34,50,50,50,50,50,50,50,50,50,-61,-73,-1,50,-13,-11,50,34,50,50,50,50,50,50,50,50,50,34,34,34,-7,34,-15,-10,50,-9,]),'MINUS':([0,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,23,24,26,27,29,30,31,32,33,34,35,36,37,38,39,40,41,42,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,64,65,66,67,68,69,73,79,81,83,84,85,86,87,88,89,90,91,92,93,94,95,96,101,103,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,124,126,129,130,133,135,136,137,138,139,142,143,146,147,148,150,151,152,153,154,155,156,157,158,159,160,161,162,163,164,165,167,168,169,170,171,172,173,174,175,182,183,184,185,186,187,189,190,191,192,193,194,195,196,197,198,199,200,203,204,206,208,209,210,211,212,214,217,218,219,220,221,222,223,224,225,228,229,230,231,232,233,234,235,236,238,239,240,242,243,244,246,247,249,250,251,252,253,254,255,256,257,258,259,260,261,262,264,265,266,267,],[35,35,-91,-19,-20,-26,-2,-3,-4,-5,-6,-30,-31,-32,-33,-34,-35,51,35,35,-52,35,-24,35,35,35,-97,-99,-101,35,35,35,-39,-40,-41,-50,-51,35,-92,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,51,-24,35,-52,35,51,51,35,35,51,35,35,35,35,35,35,35,35,51,51,-107,-108,-109,51,35,-110,-111,-112,-113,-114,-115,-116,51,51,51,51,51,51,51,51,51,51,51,51,35,35,35,35,-25,-61,-62,35,35,51,35,-27,51,-73,51,35,-52,35,51,51,51,51,51,51,51,-77,-103,35,35,35,51,-10,-12,35,-27,51,-61,-73,-8,51,51,-14,-74,-83,35,35,51,35,35,35,35,35,35,35,35,-129,-130,35,51,51,51,-16,35,35,-74,35,35,35,35,35,35,35,35,35,35,35,51,51,51,51,51,51,51,51,51,-61,-73,-1,51,-13,-11,51,35,51,51,51,51,51,51,51,51,51,35,35,35,-7,35,-15,-10,51,-9,]),'NOT':([0,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,23,24,26,27,29,30,31,32,33,34,35,36,37,38,39,40,41,42,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,65,66,67,68,79,81,84,85,86,87,88,89,90,91,92,93,94,95,96,103,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,124,126,129,130,133,135,136,137,138,142,143,147,148,150,151,152,153,154,155,156,157,158,159,160,161,162,163,164,167,168,169,170,172,173,174,183,184,185,186,187,190,191,192,193,194,195,196,197,198,199,200,208,209,210,211,212,214,217,218,219,220,221,222,223,224,225,228,229,230,231,232,233,234,235,238,239,240,243,244,247,250,251,252,253,254,255,256,257,258,259,260,261,262,264,265,267,],[36,36,-91,-19,-20,-26,-2,-3,-4,-5,-6,-30,-31,-32,-33,-34,-35,-36,36,36,-52,36,-24,36,36,36,-97,-99,-101,36,36,36,-39,-40,-41,-50,-51,36,-92,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,-24,36,-52,36,36,36,36,36,36,36,36,36,36,36,-89,-94,-107,-108,-109,36,-110,-111,-112,-113,-114,-115,-116,-117,-118,-119,-120,-121,-122,-123,-124,-125,-126,-127,-128,36,36,36,36,-25,-61,-62,36,36,36,-27,-73,-63,36,-52,36,-64,-65,-66,-67,-68,-69,-70,-77,-103,36,36,36,-10,-12,36,-27,-61,-73,-8,-14,-74,-83,36,36,36,36,36,36,36,36,36,36,-129,-130,36,-16,36,36,-74,36,36,36,36,36,36,36,36,36,36,36,-53,-54,-55,-56,-57,-58,-59,-60,-61,-73,-1,-13,-11,36,-42,-43,-44,-45,-46,-47,-48,-49,36,36,36,-7,36,-15,-10,-9,]),'NUMBER':([0,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,23,24,26,27,29,30,31,32,33,34,35,36,37,38,39,40,41,42,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,65,66,67,68,79,81,84,85,86,87,88,89,90,91,92,93,94,95,96,103,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,124,126,129,130,133,135,136,137,138,142,143,147,148,150,151,152,153,154,155,156,157,158,159,160,161,162,163,164,167,168,169,170,172,173,174,183,184,185,186,187,190,191,192,193,194,195,196,197,198,199,200,208,209,210,211,212,214,217,218,219,220,221,222,223,224,225,228,229,230,231,232,233,234,235,238,239,240,243,244,247,250,251,252,253,254,255,256,257,258,259,260,261,262,264,265,267,],[37,37,-91,-19,-20,-26,-2,-3,-4,-5,-6,-30,-31,-32,-33,-34,-35,-36,37,37,-52,37,-24,37,37,37,-97,-99,-101,37,37,37,-39,-40,-41,-50,-51,37,-92,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,-24,37,-52,37,37,37,37,37,37,37,37,37,37,37,-89,-94,-107,-108,-109,37,-110,-111,-112,-113,-114,-115,-116,-117,-118,-119,-120,-121,-122,-123,-124,-125,-126,-127,-128,37,37,37,37,-25,-61,-62,37,37,37,-27,-73,-63,37,-52,37,-64,-65,-66,-67,-68,-69,-70,-77,-103,37,37,37,-10,-12,37,-27,-61,-73,-8,-14,-74,-83,37,37,37,37,37,37,37,37,37,37,-129,-130,37,-16,37,37,-74,37,37,37,37,37,37,37,37,37,37,37,-53,-54,-55,-56,-57,-58,-59,-60,-61,-73,-1,-13,-11,37,-42,-43,-44,-45,-46,-47,-48,-49,37,37,37,-7,37,-15,-10,-9,]),'STRING':([0,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,23,24,26,27,29,30,31,32,33,34,35,36,37,38,39,40,41,42,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,65,66,67,68,79,81,84,85,86,87,88,89,90,91,92,93,94,95,96,103,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,124,126,129,130,133,135,136,137,138,142,143,147,148,150,151,152,153,154,155,156,157,158,159,160,161,162,163,164,167,168,169,170,172,173,174,183,184,185,186,187,190,191,192,193,194,195,196,197,198,199,200,208,209,210,211,212,214,217,218,219,220,221,222,223,224,225,228,229,230,231,232,233,234,235,238,239,240,243,244,247,250,251,252,253,254,255,256,257,258,259,260,261,262,264,265,267,],[38,38,-91,-19,-20,-26,-2,-3,-4,-5,-6,-30,-31,-32,-33,-34,-35,-36,38,38,-52,38,-24,38,38,38,-97,-99,-101,38,38,38,-39,-40,-41,-50,-51,38,-92,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,-24,38,-52,38,38,38,38,38,38,38,38,38,38,38,-89,-94,-107,-108,-109,38,-110,-111,-112,-113,-114,-115,-116,-117,-118,-119,-120,-121,-122,-123,-124,-125,-126,-127,-128,38,38,38,38,-25,-61,-62,38,38,38,-27,-73,-63,38,-52,38,-64,-65,-66,-67,-68,-69,-70,-77,-103,38,38,38,-10,-12,38,-27,-61,-73,-8,-14,-74,-83,38,38,38,38,38,38,38,38,38,38,-129,-130,38,-16,38,38,-74,38,38,38,38,38,38,38,38,38,38,38,-53,-54,-55,-56,-57,-58,-59,-60,-61,-73,-1,-13,-11,38,-42,-43,-44,-45,-46,-47,-48,-49,38,38,38,-7,38,-15,-10,-9,]),'TRUE':([0,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,23,24,26,27,29,30,31,32,33,34,35,36,37,38,39,40,41,42,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,65,66,67,68,79,81,84,85,86,87,88,89,90,91,92,93,94,95,96,103,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,124,126,129,130,133,135,136,137,138,142,143,147,148,150,151,152,153,154,155,156,157,158,159,160,161,162,163,164,167,168,169,170,172,173,174,183,184,185,186,187,190,191,192,193,194,195,196,197,198,199,200,208,209,210,211,212,214,217,218,219,220,221,222,223,224,225,228,229,230,231,232,233,234,235,238,239,240,243,244,247,250,251,252,253,254,255,256,257,258,259,260,261,262,264,265,267,],[39,39,-91,-19,-20,-26,-2,-3,-4,-5,-6,-30,-31,-32,-33,-34,-35,-36,39,39,-52,39,-24,39,39,39,-97,-99,-101,39,39,39,-39,-40,-41,-50,-51,39,-92,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,-24,39,-52,39,39,39,39,39,39,39,39,39,39,39,-89,-94,-107,-108,-109,39,-110,-111,-112,-113,-114,-115,-116,-117,-118,-119,-120,-121,-122,-123,-124,-125,-126,-127,-128,39,39,39,39,-25,-61,-62,39,39,39,-27,-73,-63,39,-52,39,-64,-65,-66,-67,-68,-69,-70,-77,-103,39,39,39,-10,-12,39,-27,-61,-73,-8,-14,-74,-83,39,39,39,39,39,39,39,39,39,39,-129,-130,39,-16,39,39,-74,39,39,39,39,39,39,39,39,39,39,39,-53,-54,-55,-56,-57,-58,-59,-60,-61,-73,-1,-13,-11,39,-42,-43,-44,-45,-46,-47,-48,-49,39,39,39,-7,39,-15,-10,-9,]),'FALSE':([0,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,23,24,26,27,29,30,31,32,33,34,35,36,37,38,39,40,41,42,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,65,66,67,68,79,81,84,85,86,87,88,89,90,91,92,93,94,95,96,103,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,124,126,129,130,133,135,136,137,138,142,143,147,148,150,151,152,153,154,155,156,157,158,159,160,161,162,163,164,167,168,169,170,172,173,174,183,184,185,186,187,190,191,192,193,194,195,196,197,198,199,200,208,209,210,211,212,214,217,218,219,220,221,222,223,224,225,228,229,230,231,232,233,234,235,238,239,240,243,244,247,250,251,252,253,254,255,256,257,258,259,260,261,262,264,265,267,],[40,40,-91,-19,-20,-26,-2,-3,-4,-5,-6,-30,-31,-32,-33,-34,-35,-36,40,40,-52,40,-24,40,40,40,-97,-99,-101,40,40,40,-39,-40,-41,-50,-51,40,-92,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,-24,40,-52,40,40,40,40,40,40,40,40,40,40,40,-89,-94,-107,-108,-109,40,-110,-111,-112,-113,-114,-115,-116,-117,-118,-119,-120,-121,-122,-123,-124,-125,-126,-127,-128,40,40,40,40,-25,-61,-62,40,40,40,-27,-73,-63,40,-52,40,-64,-65,-66,-67,-68,-69,-70,-77,-103,40,40,40,-10,-12,40,-27,-61,-73,-8,-14,-74,-83,40,40,40,40,40,40,40,40,40,40,-129,-130,40,-16,40,40,-74,40,40,40,40,40,40,40,40,40,40,40,-53,-54,-55,-56,-57,-58,-59,-60,-61,-73,-1,-13,-11,40,-42,-43,-44,-45,-46,-47,-48,-49,40,40,40,-7,40,-15,-10,-9,]),'NONE':([0,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,23,24,26,27,29,30,31,32,33,34,35,36,37,38,39,40,41,42,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,65,66,67,68,79,81,84,85,86,87,88,89,90,91,92,93,94,95,96,103,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,124,126,129,130,133,135,136,137,138,142,143,147,148,150,151,152,153,154,155,156,157,158,159,160,161,162,163,164,167,168,169,170,172,173,174,183,184,185,186,187,190,191,192,193,194,195,196,197,198,199,200,208,209,210,211,212,214,217,218,219,220,221,222,223,224,225,228,229,230,231,232,233,234,235,238,239,240,243,244,247,250,251,252,253,254,255,256,257,258,259,260,261,262,264,265,267,],[41,41,-91,-19,-20,-26,-2,-3,-4,-5,-6,-30,-31,-32,-33,-34,-35,-36,41,41,-52,41,-24,41,41,41,-97,-99,-101,41,41,41,-39,-40,-41,-50,-51,41,-92,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,-24,41,-52,41,41,41,41,41,41,41,41,41,41,41,-89,-94,-107,-108,-109,41,-110,-111,-112,-113,-114,-115,-116,-117,-118,-119,-120,-121,-122,-123,-124,-125,-126,-127,-128,41,41,41,41,-25,-61,-62,41,41,41,-27,-73,-63,41,-52,41,-64,-65,-66,-67,-68,-69,-70,-77,-103,41,41,41,-10,-12,41,-27,-61,-73,-8,-14,-74,-83,41,41,41,41,41,41,41,41,41,41,-129,-130,41,-16,41,41,-74,41,41,41,41,41,41,41,41,41,41,41,-53,-54,-55,-56,-57,-58,-59,-60,-61,-73,-1,-13,-11,41,-42,-43,-44,-45,-46,-47,-48,-49,41,41,41,-7,41,-15,-10,-9,]),'ID':([0,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,29,30,31,32,33,34,35,36,37,38,39,40,41,42,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,65,66,67,68,79,80,81,84,85,86,87,88,89,90,91,92,93,94,95,96,103,104,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,129,130,131,132,133,134,135,136,137,138,142,143,147,148,150,151,152,153,154,155,156,157,158,159,160,161,162,163,164,167,168,169,170,172,173,174,183,184,185,186,187,190,191,192,193,194,195,196,197,198,199,200,208,209,210,211,212,213,214,216,217,218,219,220,221,222,223,224,225,228,229,230,231,232,233,234,235,238,239,240,243,244,247,250,251,252,253,254,255,256,257,258,259,260,261,262,264,265,267,],[23,23,-91,-19,-20,-26,-2,-3,-4,-5,-6,-30,-31,-32,-33,-34,-35,-36,67,67,71,72,-52,67,78,-24,67,67,67,-97,-99,-101,67,67,67,-39,-40,-41,-50,-51,67,-92,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,67,-24,67,-52,67,67,143,67,151,67,67,67,67,67,67,67,-89,-94,-107,-108,-109,67,166,-110,-111,-112,-113,-114,-115,-116,-117,-118,-119,-120,-121,-122,-123,-124,-125,-126,-127,-128,23,170,67,23,67,176,178,-25,71,-61,-62,67,23,67,-27,-73,-63,67,-52,67,-64,-65,-66,-67,-68,-69,-70,-77,-103,67,67,67,-10,-12,23,-27,-61,-73,-8,-14,-74,-83,67,67,67,67,67,67,67,67,67,67,-129,-130,67,-16,67,23,-74,23,176,67,178,67,67,67,67,67,67,67,67,67,-53,-54,-55,-56,-57,-58,-59,-60,-61,-73,-1,-13,-11,23,-42,-43,-44,-45,-46,-47,-48,-49,67,23,23,-7,67,-15,-10,-9,]),'LBRACKET':([0,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,23,24,26,27,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,65,66,67,68,79,81,84,85,86,87,88,89,90,91,92,93,94,95,96,103,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,124,126,129,130,133,135,136,137,138,142,143,147,148,149,150,151,152,153,154,155,156,157,158,159,160,161,162,163,164,166,167,168,169,170,172,173,174,183,184,185,186,187,190,191,192,193,194,195,196,197,198,199,200,207,208,209,210,211,212,214,217,218,219,220,221,222,223,224,225,228,229,230,231,232,233,234,235,238,239,240,243,244,247,250,251,252,253,254,255,256,257,258,259,260,261,262,264,265,267,],[27,27,-91,-19,-20,-26,-2,-3,-4,-5,-6,-30,-31,-32,-33,-34,-35,-36,68,68,-52,68,79,68,68,68,-97,-99,-101,68,68,68,-39,-40,-41,-50,-51,68,103,-92,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,126,68,-52,68,68,68,152,68,68,68,68,68,68,68,-89,-94,-107,-108,-109,68,-110,-111,-112,-113,-114,-115,-116,-117,-118,-119,-120,-121,-122,-123,-124,-125,-126,-127,-128,27,68,27,68,-25,-61,-62,68,27,68,-27,-73,-63,103,68,-52,68,-64,-65,-66,-67,-68,-69,-70,-77,-103,68,68,68,-82,-10,-12,27,-27,-61,-73,-8,-14,-74,-83,68,68,68,68,68,68,68,68,68,68,-129,-130,68,-81,-16,68,27,-74,27,68,68,68,68,68,68,68,68,68,68,-53,-54,-55,-56,-57,-58,-59,-60,-61,-73,-1,-13,-11,27,-42,-43,-44,-45,-46,-47,-48,-49,68,27,27,-7,68,-15,-10,-9,]),'LBRACE':([0,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,23,24,26,27,29,30,31,32,33,34,35,36,37,38,39,40,41,42,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,65,66,67,68,79,81,84,85,86,87,88,89,90,91,92,93,94,95,96,103,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,124,126,129,130,133,135,136,137,138,142,143,147,148,150,151,152,153,154,155,156,157,158,159,160,161,162,163,164,167,168,169,170,172,173,174,183,184,185,186,187,190,191,192,193,194,195,196,197,198,199,200,208,209,210,211,212,214,217,218,219,220,221,222,223,224,225,228,229,230,231,232,233,234,235,238,239,240,243,244,247,250,251,252,253,254,255,256,257,258,259,260,261,262,264,265,267,],[42,42,-91,-19,-20,-26,-2,-3,-4,-5,-6,-30,-31,-32,-33,-34,-35,-36,42,42,-52,42,-24,42,42,42,-97,-99,-101,42,42,42,-39,-40,-41,-50,-51,42,-92,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,-24,42,-52,42,42,42,42,42,42,42,42,42,42,42,-89,-94,-107,-108,-109,42,-110,-111,-112,-113,-114,-115,-116,-117,-118,-119,-120,-121,-122,-123,-124,-125,-126,-127,-128,42,42,42,42,-25,-61,-62,42,42,42,-27,-73,-63,42,-52,42,-64,-65,-66,-67,-68,-69,-70,-77,-103,42,42,42,-10,-12,42,-27,-61,-73,-8,-14,-74,-83,42,42,42,42,42,42,42,42,42,42,-129,-130,42,-16,42,42,-74,42,42,42,42,42,42,42,42,42,42,42,-53,-54,-55,-56,-57,-58,-59,-60,-61,-73,-1,-13,-11,42,-42,-43,-44,-45,-46,-47,-48,-49,42,42,42,-7,42,-15,-10,-9,]),'$end':([1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,23,26,29,30,31,32,33,37,38,39,40,41,44,65,67,92,93,94,95,96,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,133,135,136,143,147,148,151,153,154,155,156,157,158,159,160,161,167,168,170,172,173,174,183,184,185,198,199,208,211,228,229,230,231,232,233,234,235,238,239,240,243,244,250,251,252,253,254,255,256,257,261,264,265,267,],[0,-87,-91,-19,-20,-26,-2,-3,-4,-5,-6,-30,-31,-32,-33,-34,-35,-36,-52,-24,-90,-95,-97,-99,-101,-39,-40,-41,-50,-51,-92,-24,-52,-89,-94,-107,-108,-109,-110,-111,-112,-113,-114,-115,-116,-117,-118,-119,-120,-121,-122,-123,-124,-125,-126,-127,-128,-25,-61,-62,-27,-73,-63,-52,-64,-65,-66,-67,-68,-69,-70,-77,-103,-10,-12,-27,-61,-73,-8,-14,-74,-83,-129,-130,-16,-74,-53,-54,-55,-56,-57,-58,-59,-60,-61,-73,-1,-13,-11,-42,-43,-44,-45,-46,-47,-48,-49,-7,-15,-10,-9,]),'DEDENT':([3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,23,26,29,30,31,32,33,37,38,39,40,41,44,65,67,92,93,94,95,96,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,133,135,136,143,147,148,151,153,154,155,156,157,158,159,160,161,167,168,170,172,173,174,183,184,185,198,199,208,210,211,228,229,230,231,232,233,234,235,238,239,240,243,244,250,251,252,253,254,255,256,257,261,264,265,267,],[-91,-19,-20,-26,-2,-3,-4,-5,-6,-30,-31,-32,-33,-34,-35,-36,-52,-24,-90,-95,-97,-99,-101,-39,-40,-41,-50,-51,-92,-24,-52,-89,-94,-107,-108,-109,-110,-111,-112,-113,-114,-115,-116,-117,-118,-119,-120,-121,-122,-123,-124,-125,-126,-127,-128,-25,-61,-62,-27,-73,-63,-52,-64,-65,-66,-67,-68,-69,-70,-77,-103,-10,-12,-27,-61,-73,-8,-14,-74,-83,-129,-130,-16,243,-74,-53,-54,-55,-56,-57,-58,-59,-60,-61,-73,-1,-13,-11,-42,-43,-44,-45,-46,-47,-48,-49,-7,-15,-10,-9,]),'ELIF':([6,12,13,14,15,16,17,18,23,26,29,30,31,32,33,37,38,39,40,41,65,67,92,93,94,95,96,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,133,135,136,143,147,148,151,153,154,155,156,157,158,159,160,161,167,168,170,172,173,184,185,198,199,211,228,229,230,231,232,233,234,235,238,239,243,250,251,252,253,254,255,256,257,265,],[-26,-30,-31,-32,-33,-34,-35,-36,-52,-24,-90,-95,-97,-99,-101,-39,-40,-41,-50,-51,-24,-52,-89,-94,-107,-108,-109,-110,-111,-112,-113,-114,-115,-116,-117,-118,-119,-120,-121,-122,-123,-124,-125,-126,-127,-128,-25,-61,-62,-27,-73,-63,-52,-64,-65,-66,-67,-68,-69,-70,-77,-103,209,-12,-27,-61,-73,-74,-83,-129,-130,-74,-53,-54,-55,-56,-57,-58,-59,-60,-61,-73,-13,-42,-43,-44,-45,-46,-47,-48,-49,209,]),'ELSE':([6,12,13,14,15,16,17,18,23,26,29,30,31,32,33,37,38,39,40,41,65,67,92,93,94,95,96,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,133,135,136,143,147,148,151,153,154,155,156,157,158,159,160,161,167,168,170,172,173,184,185,198,199,208,211,228,229,230,231,232,233,234,235,238,239,243,250,251,252,253,254,255,256,257,265,267,],[-26,-30,-31,-32,-33,-34,-35,-36,-52,-24,-90,-95,-97,-99,-101,-39,-40,-41,-50,-51,-24,-52,-89,-94,-107,-108,-109,-110,-111,-112,-113,-114,-115,-116,-117,-118,-119,-120,-121,-122,-123,-124,-125,-126,-127,-128,-25,-61,-62,-27,-73,-63,-52,-64,-65,-66,-67,-68,-69,-70,-77,-103,-10,-12,-27,-61,-73,-74,-83,-129,-130,241,-74,-53,-54,-55,-56,-57,-58,-59,-60,-61,-73,-13,-42,-43,-44,-45,-46,-47,-48,-49,-10,-9,]),'POWER':([18,23,26,37,38,39,40,41,64,65,67,69,73,83,92,93,94,95,96,101,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,133,135,136,139,143,146,147,148,151,153,154,155,156,157,158,159,160,161,165,170,171,172,173,175,182,184,185,189,198,199,203,204,206,211,228,229,230,231,232,233,234,235,236,238,239,242,246,249,250,251,252,253,254,255,256,257,266,],[45,-52,-24,-39,-40,-41,-50,-51,45,-24,-52,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,-25,-61,-62,45,-27,45,-73,45,-52,45,45,45,45,45,45,45,-77,-103,45,-27,45,-61,-73,45,45,-74,-83,45,-129,-130,45,45,45,-74,45,45,45,45,45,45,45,45,45,-61,-73,45,45,45,45,45,45,45,45,45,45,45,45,]),'TIMES':([18,23,26,37,38,39,40,41,64,65,67,69,73,83,92,93,94,95,96,101,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,133,135,136,139,143,146,147,148,151,153,154,155,156,157,158,159,160,161,165,170,171,172,173,175,182,184,185,189,198,199,203,204,206,211,228,229,230,231,232,233,234,235,236,238,239,242,246,249,250,251,252,253,254,255,256,257,266,],[46,-52,-24,-39,-40,-41,-50,-51,46,-24,-52,46,46,46,46,46,-107,-108,-109,46,-110,-111,-112,-113,-114,46,46,46,46,46,46,46,46,46,46,46,46,46,46,-25,-61,-62,46,-27,46,-73,46,-52,46,46,46,46,46,46,46,-77,-103,46,-27,46,-61,-73,46,46,-74,-83,46,-129,-130,46,46,46,-74,46,46,46,46,46,46,46,46,46,-61,-73,46,46,46,46,46,46,46,46,46,46,46,46,]),'DIVIDE':([18,23,26,37,38,39,40,41,64,65,67,69,73,83,92,93,94,95,96,101,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,133,135,136,139,143,146,147,148,151,153,154,155,156,157,158,159,160,161,165,170,171,172,173,175,182,184,185,189,198,199,203,204,206,211,228,229,230,231,232,233,234,235,236,238,239,242,246,249,250,251,252,253,254,255,256,257,266,],[47,-52,-24,-39,-40,-41,-50,-51,47,-24,-52,47,47,47,47,47,-107,-108,-109,47,-110,-111,-112,-113,-114,47,47,47,47,47,47,47,47,47,47,47,47,47,47,-25,-61,-62,47,-27,47,-73,47,-52,47,47,47,47,47,47,47,-77,-103,47,-27,47,-61,-73,47,47,-74,-83,47,-129,-130,47,47,47,-74,47,47,47,47,47,47,47,47,47,-61,-73,47,47,47,47,47,47,47,47,47,47,47,47,]),'FLOOR_DIVIDE':([18,23,26,37,38,39,40,41,64,65,67,69,73,83,92,93,94,95,96,101,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,133,135,136,139,143,146,147,148,151,153,154,155,156,157,158,159,160,161,165,170,171,172,173,175,182,184,185,189,198,199,203,204,206,211,228,229,230,231,232,233,234,235,236,238,239,242,246,249,250,251,252,253,254,255,256,257,266,],[48,-52,-24,-39,-40,-41,-50,-51,48,-24,-52,48,48,48,48,48,-107,-108,-109,48,-110,-111,-112,-113,-114,48,48,48,48,48,48,48,48,48,48,48,48,48,48,-25,-61,-62,48,-27,48,-73,48,-52,48,48,48,48,48,48,48,-77,-103,48,-27,48,-61,-73,48,48,-74,-83,48,-129,-130,48,48,48,-74,48,48,48,48,48,48,48,48,48,-61,-73,48,48,48,48,48,48,48,48,48,48,48,48,]),'MOD':([18,23,26,37,38,39,40,41,64,65,67,69,73,83,92,93,94,95,96,101,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,133,135,136,139,143,146,147,148,151,153,154,155,156,157,158,159,160,161,165,170,171,172,173,175,182,184,185,189,198,199,203,204,206,211,228,229,230,231,232,233,234,235,236,238,239,242,246,249,250,251,252,253,254,255,256,257,266,],[49,-52,-24,-39,-40,-41,-50,-51,49,-24,-52,49,49,49,49,49,-107,-108,-109,49,-110,-111,-112,-113,-114,49,49,49,49,49,49,49,49,49,49,49,49,49,49,-25,-61,-62,49,-27,49,-73,49,-52,49,49,49,49,49,49,49,-77,-103,49,-27,49,-61,-73,49,49,-74,-83,49,-129,-130,49,49,49,-74,49,49,49,49,49,49,49,49,49,-61,-73,49,49,49,49,49,49,49,49,49,49,49,49,]),'PIPE':([18,23,26,37,38,39,40,41,64,65,67,69,73,83,92,93,94,95,96,101,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,133,135,136,139,143,146,147,148,151,153,154,155,156,157,158,159,160,161,165,170,171,172,173,175,182,184,185,189,198,199,203,204,206,211,228,229,230,231,232,233,234,235,236,238,239,242,246,249,250,251,252,253,254,255,256,257,266,],[52,-52,-24,-39,-40,-41,-50,-51,52,-24,-52,52,52,52,52,52,-107,-108,-109,52,-110,-111,-112,-113,-114,-115,-116,-117,-118,-119,52,52,52,52,52,52,52,52,52,-25,-61,-62,52,-27,52,-73,52,-52,52,52,52,52,52,52,52,-77,-103,52,-27,52,-61,-73,52,52,-74,-83,52,-129,-130,52,52,52,-74,52,52,52,52,52,52,52,52,52,-61,-73,52,52,52,52,52,52,52,52,52,52,52,52,]),'CARET':([18,23,26,37,38,39,40,41,64,65,67,69,73,83,92,93,94,95,96,101,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,133,135,136,139,143,146,147,148,151,153,154,155,156,157,158,159,160,161,165,170,171,172,173,175,182,184,185,189,198,199,203,204,206,211,228,229,230,231,232,233,234,235,236,238,239,242,246,249,250,251,252,253,254,255,256,257,266,],[53,-52,-24,-39,-40,-41,-50,-51,53,-24,-52,53,53,53,53,53,-107,-108,-109,53,-110,-111,-112,-113,-114,-115,-116,53,-118,-119,53,53,53,53,53,53,53,53,53,-25,-61,-62,53,-27,53,-73,53,-52,53,53,53,53,53,53,53,-77,-103,53,-27,53,-61,-73,53,53,-74,-83,53,-129,-130,53,53,53,-74,53,53,53,53,53,53,53,53,53,-61,-73,53,53,53,53,53,53,53,53,53,53,53,53,]),'AMPERSAND':([18,23,26,37,38,39,40,41,64,65,67,69,73,83,92,93,94,95,96,101,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,133,135,136,139,143,146,147,148,151,153,154,155,156,157,158,159,160,161,165,170,171,172,173,175,182,184,185,189,198,199,203,204,206,211,228,229,230,231,232,233,234,235,236,238,239,242,246,249,250,251,252,253,254,255,256,257,266,],[54,-52,-24,-39,-40,-41,-50,-51,54,-24,-52,54,54,54,54,54,-107,-108,-109,54,-110,-111,-112,-113,-114,-115,-116,54,54,-119,54,54,54,54,54,54,54,54,54,-25,-61,-62,54,-27,54,-73,54,-52,54,54,54,54,54,54,54,-77,-103,54,-27,54,-61,-73,54,54,-74,-83,54,-129,-130,54,54,54,-74,54,54,54,54,54,54,54,54,54,-61,-73,54,54,54,54,54,54,54,54,54,54,54,54,]),'EQUALS':([18,23,26,37,38,39,40,41,64,65,67,69,73,83,92,93,94,95,96,101,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,133,135,136,139,143,146,147,148,151,153,154,155,156,157,158,159,160,161,165,170,171,172,173,175,182,184,185,189,198,199,203,204,206,211,228,229,230,231,232,233,234,235,236,238,239,242,246,249,250,251,252,253,254,255,256,257,266,],[55,-52,-24,-39,-40,-41,-50,-51,55,-24,-52,55,55,55,55,55,-107,-108,-109,55,-110,-111,-112,-113,-114,-115,-116,-117,-118,-119,-120,-121,-122,-123,-124,-125,55,55,55,-25,-61,-62,55,-27,55,-73,55,-52,55,55,55,55,55,55,55,-77,-103,55,-27,55,-61,-73,55,55,-74,-83,55,-129,-130,55,55,55,-74,55,55,55,55,55,55,55,55,55,-61,-73,55,55,55,55,55,55,55,55,55,55,55,55,]),'NOT_EQUALS':([18,23,26,37,38,39,40,41,64,65,67,69,73,83,92,93,94,95,96,101,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,133,135,136,139,143,146,147,148,151,153,154,155,156,157,158,159,160,161,165,170,171,172,173,175,182,184,185,189,198,199,203,204,206,211,228,229,230,231,232,233,234,235,236,238,239,242,246,249,250,251,252,253,254,255,256,257,266,],[56,-52,-24,-39,-40,-41,-50,-51,56,-24,-52,56,56,56,56,56,-107,-108,-109,56,-110,-111,-112,-113,-114,-115,-116,-117,-118,-119,-120,-121,-122,-123,-124,-125,56,56,56,-25,-61,-62,56,-27,56,-73,56,-52,56,56,56,56,56,56,56,-77,-103,56,-27,56,-61,-73,56,56,-74,-83,56,-129,-130,56,56,56,-74,56,56,56,56,56,56,56,56,56,-61,-73,56,56,56,56,56,56,56,56,56,56,56,56,]),'LESS_THAN':([18,23,26,37,38,39,40,41,64,65,67,69,73,83,92,93,94,95,96,101,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,133,135,136,139,143,146,147,148,151,153,154,155,156,157,158,159,160,161,165,170,171,172,173,175,182,184,185,189,198,199,203,204,206,211,228,229,230,231,232,233,234,235,236,238,239,242,246,249,250,251,252,253,254,255,256,257,266,],[57,-52,-24,-39,-40,-41,-50,-51,57,-24,-52,57,57,57,57,57,-107,-108,-109,57,-110,-111,-112,-113,-114,-115,-116,-117,-118,-119,-120,-121,-122,-123,-124,-125,57,57,57,-25,-61,-62,57,-27,57,-73,57,-52,57,57,57,57,57,57,57,-77,-103,57,-27,57,-61,-73,57,57,-74,-83,57,-129,-130,57,57,57,-74,57,57,57,57,57,57,57,57,57,-61,-73,57,57,57,57,57,57,57,57,57,57,57,57,]),'LESS_THAN_EQUALS':([18,23,26,37,38,39,40,41,64,65,67,69,73,83,92,93,94,95,96,101,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,133,135,136,139,143,146,147,148,151,153,154,155,156,157,158,159,160,161,165,170,171,172,173,175,182,184,185,189,198,199,203,204,206,211,228,229,230,231,232,233,234,235,236,238,239,242,246,249,250,251,252,253,254,255,256,257,266,],[58,-52,-24,-39,-40,-41,-50,-51,58,-24,-52,58,58,58,58,58,-107,-108,-109,58,-110,-111,-112,-113,-114,-115,-116,-117,-118,-119,-120,-121,-122,-123,-124,-125,58,58,58,-25,-61,-62,58,-27,58,-73,58,-52,58,58,58,58,58,58,58,-77,-103,58,-27,58,-61,-73,58,58,-74,-83,58,-129,-130,58,58,58,-74,58,58,58,58,58,58,58,58,58,-61,-73,58,58,58,58,58,58,58,58,58,58,58,58,]),'GREATER_THAN':([18,23,26,37,38,39,40,41,64,65,67,69,73,83,92,93,94,95,96,101,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,133,135,136,139,143,146,147,148,151,153,154,155,156,157,158,159,160,161,165,170,171,172,173,175,182,184,185,189,198,199,203,204,206,211,228,229,230,231,232,233,234,235,236,238,239,242,246,249,250,251,252,253,254,255,256,257,266,],[59,-52,-24,-39,-40,-41,-50,-51,59,-24,-52,59,59,59,59,59,-107,-108,-109,59,-110,-111,-112,-113,-114,-115,-116,-117,-118,-119,-120,-121,-122,-123,-124,-125,59,59,59,-25,-61,-62,59,-27,59,-73,59,-52,59,59,59,59,59,59,59,-77,-103,59,-27,59,-61,-73,59,59,-74,-83,59,-129,-130,59,59,59,-74,59,59,59,59,59,59,59,59,59,-61,-73,59,59,59,59,59,59,59,59,59,59,59,59,]),'GREATER_THAN_EQUALS':([18,23,26,37,38,39,40,41,64,65,67,69,73,83,92,93,94,95,96,101,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,133,135,136,139,143,146,147,148,151,153,154,155,156,157,158,159,160,161,165,170,171,172,173,175,182,184,185,189,198,199,203,204,206,211,228,229,230,231,232,233,234,235,236,238,239,242,246,249,250,251,252,253,254,255,256,257,266,],[60,-52,-24,-39,-40,-41,-50,-51,60,-24,-52,60,60,60,60,60,-107,-108,-109,60,-110,-111,-112,-113,-114,-115,-116,-117,-118,-119,-120,-121,-122,-123,-124,-125,60,60,60,-25,-61,-62,60,-27,60,-73,60,-52,60,60,60,60,60,60,60,-77,-103,60,-27,60,-61,-73,60,60,-74,-83,60,-129,-130,60,60,60,-74,60,60,60,60,60,60,60,60,60,-61,-73,60,60,60,60,60,60,60,60,60,60,60,60,]),'IN':([18,23,26,37,38,39,40,41,64,65,67,69,70,71,73,83,92,93,94,95,96,101,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,133,135,136,139,143,146,147,148,151,153,154,155,156,157,158,159,160,161,165,170,171,172,173,175,176,177,181,182,184,185,189,198,199,203,204,206,211,228,229,230,231,232,233,234,235,236,238,239,242,245,246,249,250,251,252,253,254,255,256,257,266,],[61,-52,-24,-39,-40,-41,-50,-51,61,-24,-52,61,130,-17,61,61,61,61,-107,-108,-109,61,-110,-111,-112,-113,-114,-115,-116,-117,-118,-119,-120,-121,-122,-123,-124,-125,61,-127,-128,-25,-61,-62,61,-27,61,-73,61,-52,61,61,61,61,61,61,61,-77,-103,61,-27,61,-61,-73,61,-28,-18,217,61,-74,-83,61,-129,-130,61,61,61,-74,61,61,61,61,61,61,61,61,61,-61,-73,61,-29,61,61,61,61,61,61,61,61,61,61,61,]),'AND':([18,23,26,37,38,39,40,41,64,65,67,69,73,83,92,93,94,95,96,101,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,133,135,136,139,143,146,147,148,151,153,154,155,156,157,158,159,160,161,165,170,171,172,173,175,182,184,185,189,198,199,203,204,206,211,228,229,230,231,232,233,234,235,236,238,239,242,246,249,250,251,252,253,254,255,256,257,266,],[62,-52,-24,-39,-40,-41,-50,-51,62,-24,-52,62,62,62,62,62,-107,-108,-109,62,-110,-111,-112,-113,-114,-115,-116,-117,-118,-119,-120,-121,-122,-123,-124,-125,62,-127,62,-25,-61,-62,62,-27,62,-73,62,-52,62,62,62,62,62,62,62,-77,-103,62,-27,62,-61,-73,62,62,-74,-83,62,-129,-130,62,62,62,-74,62,62,62,62,62,62,62,62,62,-61,-73,62,62,62,62,62,62,62,62,62,62,62,62,]),'OR':([18,23,26,37,38,39,40,41,64,65,67,69,73,83,92,93,94,95,96,101,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,133,135,136,139,143,146,147,148,151,153,154,155,156,157,158,159,160,161,165,170,171,172,173,175,182,184,185,189,198,199,203,204,206,211,228,229,230,231,232,233,234,235,236,238,239,242,246,249,250,251,252,253,254,255,256,257,266,],[63,-52,-24,-39,-40,-41,-50,-51,63,-24,-52,63,63,63,63,63,-107,-108,-109,63,-110,-111,-112,-113,-114,-115,-116,-117,-118,-119,-120,-121,-122,-123,-124,-125,63,-127,-128,-25,-61,-62,63,-27,63,-73,63,-52,63,63,63,63,63,63,63,-77,-103,63,-27,63,-61,-73,63,63,-74,-83,63,-129,-130,63,63,63,-74,63,63,63,63,63,63,63,63,63,-61,-73,63,63,63,63,63,63,63,63,63,63,63,63,]),'DOT':([23,26,37,38,39,40,41,43,65,67,135,136,143,147,149,151,160,161,166,170,172,173,184,185,207,211,238,239,],[-52,80,-39,-40,-41,-50,-51,104,125,-52,-61,-62,-27,-73,104,-52,-77,-103,-82,-27,-61,-73,-74,-83,-81,-74,-61,-73,]),'ASSIGN':([23,28,43,135,143,147,149,151,166,178,184,207,238,239,],[-78,84,-76,-79,190,-80,-75,-78,-82,214,218,-81,-79,-80,]),'PLUS_ASSIGN':([23,28,43,135,143,147,149,151,166,184,207,238,239,],[-78,85,-76,-79,191,-80,-75,-78,-82,219,-81,-79,-80,]),'MINUS_ASSIGN':([23,28,43,135,143,147,149,151,166,184,207,238,239,],[-78,86,-76,-79,192,-80,-75,-78,-82,220,-81,-79,-80,]),'TIMES_ASSIGN':([23,28,43,135,143,147,149,151,166,184,207,238,239,],[-78,87,-76,-79,193,-80,-75,-78,-82,221,-81,-79,-80,]),'DIVIDE_ASSIGN':([23,28,43,135,143,147,149,151,166,184,207,238,239,],[-78,88,-76,-79,194,-80,-75,-78,-82,222,-81,-79,-80,]),'FLOOR_DIVIDE_ASSIGN':([23,28,43,135,143,147,149,151,166,184,207,238,239,],[-78,89,-76,-79,195,-80,-75,-78,-82,223,-81,-79,-80,]),'MOD_ASSIGN':([23,28,43,135,143,147,149,151,166,184,207,238,239,],[-78,90,-76,-79,196,-80,-75,-78,-82,224,-81,-79,-80,]),'POWER_ASSIGN':([23,28,43,135,143,147,149,151,166,184,207,238,239,],[-78,91,-76,-79,197,-80,-75,-78,-82,225,-81,-79,-80,]),'RPAREN':([24,37,38,39,40,41,65,66,67,73,74,75,76,77,81,94,95,96,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,127,132,133,136,144,145,146,150,160,161,170,172,173,178,179,180,182,185,198,199,200,201,211,216,236,237,246,248,249,266,],[-143,-39,-40,-41,-50,-51,-24,-143,-52,133,135,136,-139,-140,-133,-107,-108,-109,-110,-111,-112,-113,-114,-115,-116,-117,-118,-119,-120,-121,-122,-123,-124,-125,-126,-127,-128,172,-23,-25,-62,198,199,-132,-143,-77,-103,-27,-61,-73,-37,215,-22,-142,-83,-129,-130,-133,238,-74,-23,-132,-131,-38,-21,-71,-72,]),'RBRACKET':([27,37,38,39,40,41,65,67,68,76,77,82,83,94,95,96,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,128,133,136,139,140,142,152,160,161,165,170,171,172,173,182,185,186,187,188,189,198,199,202,211,226,227,258,263,],[-143,-39,-40,-41,-50,-51,-24,-52,-143,-139,-140,147,-141,-107,-108,-109,-110,-111,-112,-113,-114,-115,-116,-117,-118,-119,-120,-121,-122,-123,-124,-125,-126,-127,-128,173,-25,-62,184,185,-96,-143,-77,-103,207,-27,211,-61,-73,-142,-83,-93,-100,-88,-102,-129,-130,239,-74,-85,-98,-100,-86,]),'COLON':([37,38,39,40,41,64,65,67,69,78,79,94,95,96,101,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,126,133,136,139,141,142,160,161,170,171,172,173,175,185,186,189,198,199,206,211,215,226,241,242,],[-39,-40,-41,-50,-51,124,-24,-52,129,138,142,-107,-108,-109,163,-110,-111,-112,-113,-114,-115,-116,-117,-118,-119,-120,-121,-122,-123,-124,-125,-126,-127,-128,142,-25,-62,-102,186,187,-77,-103,-27,-102,-61,-73,212,-83,-100,-102,-129,-130,163,-74,247,258,259,260,]),'COMMA':([37,38,39,40,41,65,67,71,73,76,83,94,95,96,98,101,102,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,133,136,146,160,161,162,170,172,173,176,178,180,182,185,198,199,203,204,211,236,246,],[-39,-40,-41,-50,-51,-24,-52,131,-141,137,-141,-107,-108,-109,162,-104,164,-110,-111,-112,-113,-114,-115,-116,-117,-118,-119,-120,-121,-122,-123,-124,-125,-126,-127,-128,-25,-62,200,-77,-103,-106,-27,-61,-73,213,-37,216,-142,-83,-129,-130,-105,-138,-74,200,-38,]),'RBRACE':([37,38,39,40,41,42,65,67,94,95,96,97,98,99,100,101,102,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,133,136,160,161,162,170,172,173,185,198,199,203,204,205,211,],[-39,-40,-41,-50,-51,-143,-24,-52,-107,-108,-109,160,161,-136,-137,-104,-134,-110,-111,-112,-113,-114,-115,-116,-117,-118,-119,-120,-121,-122,-123,-124,-125,-126,-127,-128,-25,-62,-77,-103,-106,-27,-61,-73,-83,-129,-130,-105,-138,-135,-74,]),'INDENT':([124,129,138,212,247,259,260,],[169,169,169,169,169,169,169,]),}
 
 _lr_action = {}
 for _k, _v in _lr_action_items.items():
@@ -17,7 +17,7 @@ for _k, _v in _lr_action_items.items():
       _lr_action[_x][_k] = _y
 del _lr_action_items
 
-_lr_goto_items = {'module':([0,],[1,]),'statement_list':([0,154,],[2,191,]),'statement':([0,2,154,191,],[3,42,3,42,]),'simple_statement':([0,2,113,118,124,154,191,193,224,235,236,],[4,4,153,153,153,4,4,153,153,153,153,]),'compound_statement':([0,2,154,191,],[5,5,5,5,]),'small_stmt':([0,2,113,118,124,154,191,193,224,235,236,],[6,6,6,6,6,6,6,6,6,6,6,]),'if_stmt':([0,2,154,191,],[7,7,7,7,]),'while_stmt':([0,2,154,191,],[8,8,8,8,]),'for_stmt':([0,2,154,191,],[9,9,9,9,]),'funcdef':([0,2,154,191,],[10,10,10,10,]),'classdef':([0,2,154,191,],[11,11,11,11,]),'assignment':([0,2,113,118,124,154,191,193,224,235,236,],[12,12,12,12,12,12,12,12,12,12,12,]),'return_stmt':([0,2,113,118,124,154,191,193,224,235,236,],[13,13,13,13,13,13,13,13,13,13,13,]),'break_stmt':([0,2,113,118,124,154,191,193,224,235,236,],[14,14,14,14,14,14,14,14,14,14,14,]),'continue_stmt':([0,2,113,118,124,154,191,193,224,235,236,],[15,15,15,15,15,15,15,15,15,15,15,]),'pass_stmt':([0,2,113,118,124,154,191,193,224,235,236,],[16,16,16,16,16,16,16,16,16,16,16,]),'expr':([0,2,18,19,23,26,28,32,33,34,40,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,61,63,72,74,77,78,79,80,81,82,83,84,95,113,115,118,119,123,124,128,135,137,147,148,149,154,168,169,172,173,174,175,176,177,178,179,181,190,191,193,194,197,198,199,200,201,202,203,204,224,234,235,236,],[17,17,59,64,67,76,85,86,87,88,93,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,67,76,125,131,133,138,139,140,141,142,143,144,150,17,156,17,160,164,17,171,67,76,184,185,187,17,171,171,207,208,209,210,211,212,213,214,131,220,17,17,223,226,227,228,229,230,231,232,233,17,171,17,17,]),'atom':([0,2,18,19,23,26,28,32,33,34,40,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,61,63,72,74,77,78,79,80,81,82,83,84,95,113,115,118,119,123,124,128,135,137,147,148,149,154,168,169,172,173,174,175,176,177,178,179,181,190,191,193,194,197,198,199,200,201,202,203,204,224,234,235,236,],[25,25,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,25,60,25,60,60,25,60,60,60,60,60,60,25,60,60,60,60,60,60,60,60,60,60,60,60,25,25,60,60,60,60,60,60,60,60,60,25,60,25,25,]),'assign_targets':([0,2,113,118,124,154,191,193,224,235,236,],[27,27,27,27,27,27,27,27,27,27,27,]),'target':([0,2,77,113,118,124,154,191,193,224,235,236,],[41,41,134,41,41,41,41,41,41,41,41,41,]),'elements_opt':([23,26,61,63,135,137,],[68,75,116,117,182,183,]),'elements':([23,26,61,63,135,137,],[69,69,69,69,69,69,]),'empty':([23,26,40,61,63,135,137,],[70,70,92,70,70,70,70,]),'key_value_list_opt':([40,],[89,]),'set_elements':([40,],[90,]),'key_value_list':([40,149,],[91,186,]),'key_value':([40,149,],[94,94,]),'subscript_item':([72,115,],[126,126,]),'opt_expr':([72,115,128,168,169,234,],[127,127,170,205,206,238,]),'arg_list_opt':([74,181,],[130,215,]),'suite':([113,118,124,193,224,235,236,],[152,159,165,222,237,239,240,]),'param_list_opt':([120,196,],[162,225,]),'param':([120,196,],[163,163,]),'elif_blocks':([152,240,],[189,241,]),'else_block_opt':([189,],[218,]),}
+_lr_goto_items = {'module':([0,],[1,]),'statement_list':([0,169,],[2,210,]),'statement':([0,2,169,210,],[3,44,3,44,]),'simple_statement':([0,2,124,129,138,169,210,212,247,259,260,],[4,4,168,168,168,4,4,168,168,168,168,]),'compound_statement':([0,2,169,210,],[5,5,5,5,]),'small_stmt':([0,2,124,129,138,169,210,212,247,259,260,],[6,6,6,6,6,6,6,6,6,6,6,]),'if_stmt':([0,2,169,210,],[7,7,7,7,]),'while_stmt':([0,2,169,210,],[8,8,8,8,]),'for_stmt':([0,2,169,210,],[9,9,9,9,]),'funcdef':([0,2,169,210,],[10,10,10,10,]),'classdef':([0,2,169,210,],[11,11,11,11,]),'assignment':([0,2,124,129,138,169,210,212,247,259,260,],[12,12,12,12,12,12,12,12,12,12,12,]),'return_stmt':([0,2,124,129,138,169,210,212,247,259,260,],[13,13,13,13,13,13,13,13,13,13,13,]),'yield_stmt':([0,2,124,129,138,169,210,212,247,259,260,],[14,14,14,14,14,14,14,14,14,14,14,]),'break_stmt':([0,2,124,129,138,169,210,212,247,259,260,],[15,15,15,15,15,15,15,15,15,15,15,]),'continue_stmt':([0,2,124,129,138,169,210,212,247,259,260,],[16,16,16,16,16,16,16,16,16,16,16,]),'pass_stmt':([0,2,124,129,138,169,210,212,247,259,260,],[17,17,17,17,17,17,17,17,17,17,17,]),'expr':([0,2,19,20,24,27,29,30,34,35,36,42,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,66,68,79,81,84,85,86,87,88,89,90,91,103,124,126,129,130,137,138,142,150,152,162,163,164,169,186,187,190,191,192,193,194,195,196,197,200,209,210,212,214,217,218,219,220,221,222,223,224,225,247,258,259,260,262,],[18,18,64,69,73,83,92,93,94,95,96,101,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,73,83,139,146,148,153,154,155,156,157,158,159,165,18,171,18,175,182,18,189,73,83,203,204,206,18,189,189,228,229,230,231,232,233,234,235,236,242,18,18,246,249,250,251,252,253,254,255,256,257,18,189,18,18,266,]),'atom':([0,2,19,20,24,27,29,30,34,35,36,42,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,66,68,79,81,84,85,86,87,88,89,90,91,103,124,126,129,130,137,138,142,150,152,162,163,164,169,186,187,190,191,192,193,194,195,196,197,200,209,210,212,214,217,218,219,220,221,222,223,224,225,247,258,259,260,262,],[26,26,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,26,65,26,65,65,26,65,65,65,65,65,65,26,65,65,65,65,65,65,65,65,65,65,65,65,26,26,65,65,65,65,65,65,65,65,65,65,26,65,26,26,65,]),'assign_targets':([0,2,124,129,138,169,210,212,247,259,260,],[28,28,28,28,28,28,28,28,28,28,28,]),'target':([0,2,84,124,129,138,169,210,212,247,259,260,],[43,43,149,43,43,43,43,43,43,43,43,43,]),'for_targets':([21,134,],[70,181,]),'elements_opt':([24,27,66,68,150,152,],[74,82,127,128,201,202,]),'generator_body':([24,66,81,150,],[75,75,145,75,]),'elements':([24,27,66,68,150,152,],[76,76,76,76,76,76,]),'empty':([24,27,42,66,68,150,152,],[77,77,100,77,77,77,77,]),'key_value_list_opt':([42,],[97,]),'set_elements':([42,],[98,]),'key_value_list':([42,164,],[99,205,]),'key_value':([42,164,],[102,102,]),'subscript_item':([79,126,],[140,140,]),'opt_expr':([79,126,142,186,187,258,],[141,141,188,226,227,263,]),'arg_list_opt':([81,200,],[144,237,]),'suite':([124,129,138,212,247,259,260,],[167,174,183,244,261,264,265,]),'for_target_names':([131,213,],[177,245,]),'param_list_opt':([132,216,],[179,248,]),'param':([132,216,],[180,180,]),'elif_blocks':([167,265,],[208,267,]),'else_block_opt':([208,],[240,]),}
 
 _lr_goto = {}
 for _k, _v in _lr_goto_items.items():
@@ -37,123 +37,137 @@ _lr_productions = [
   ('while_stmt -> WHILE expr COLON suite','while_stmt',4,'p_while_stmt','parser_loops.py',9),
   ('elif_blocks -> ELIF expr COLON suite elif_blocks','elif_blocks',5,'p_elif_blocks','parser_conditionals.py',10),
   ('elif_blocks -> <empty>','elif_blocks',0,'p_elif_blocks','parser_conditionals.py',11),
-  ('for_stmt -> FOR ID IN expr COLON suite','for_stmt',6,'p_for_stmt','parser_loops.py',13),
+  ('for_stmt -> FOR for_targets IN expr COLON suite','for_stmt',6,'p_for_stmt','parser_loops.py',13),
   ('suite -> simple_statement','suite',1,'p_suite','parser_blocks.py',16),
   ('suite -> INDENT statement_list DEDENT','suite',3,'p_suite','parser_blocks.py',17),
   ('classdef -> CLASS ID COLON suite','classdef',4,'p_classdef','parser_definitions.py',16),
   ('else_block_opt -> ELSE COLON suite','else_block_opt',3,'p_else_block_opt','parser_conditionals.py',18),
   ('else_block_opt -> <empty>','else_block_opt',0,'p_else_block_opt','parser_conditionals.py',19),
-  ('statement -> simple_statement','statement',1,'p_statement','parser_statements.py',21),
-  ('statement -> compound_statement','statement',1,'p_statement','parser_statements.py',22),
+  ('for_targets -> ID','for_targets',1,'p_for_targets','parser_loops.py',22),
+  ('for_targets -> ID COMMA for_target_names','for_targets',3,'p_for_targets','parser_loops.py',23),
+  ('statement -> simple_statement','statement',1,'p_statement','parser_statements.py',22),
+  ('statement -> compound_statement','statement',1,'p_statement','parser_statements.py',23),
   ('param_list_opt -> param COMMA param_list_opt','param_list_opt',3,'p_param_list_opt','parser_definitions.py',23),
   ('param_list_opt -> param','param_list_opt',1,'p_param_list_opt','parser_definitions.py',24),
   ('param_list_opt -> <empty>','param_list_opt',0,'p_param_list_opt','parser_definitions.py',25),
-  ('expr -> atom','expr',1,'p_expr_atom','parser_expressions.py',23),
-  ('expr -> LPAREN expr RPAREN','expr',3,'p_expr_group','parser_expressions.py',27),
-  ('simple_statement -> small_stmt','simple_statement',1,'p_simple_statement','parser_statements.py',28),
-  ('atom -> atom DOT ID','atom',3,'p_atom_attribute','parser_expressions.py',31),
-  ('small_stmt -> assignment','small_stmt',1,'p_small_stmt','parser_statements.py',32),
-  ('small_stmt -> return_stmt','small_stmt',1,'p_small_stmt','parser_statements.py',33),
-  ('small_stmt -> break_stmt','small_stmt',1,'p_small_stmt','parser_statements.py',34),
-  ('small_stmt -> continue_stmt','small_stmt',1,'p_small_stmt','parser_statements.py',35),
-  ('small_stmt -> pass_stmt','small_stmt',1,'p_small_stmt','parser_statements.py',36),
-  ('small_stmt -> expr','small_stmt',1,'p_small_stmt','parser_statements.py',37),
+  ('expr -> atom','expr',1,'p_expr_atom','parser_expressions.py',24),
+  ('expr -> LPAREN expr RPAREN','expr',3,'p_expr_group','parser_expressions.py',28),
+  ('simple_statement -> small_stmt','simple_statement',1,'p_simple_statement','parser_statements.py',29),
+  ('atom -> atom DOT ID','atom',3,'p_atom_attribute','parser_expressions.py',32),
+  ('for_target_names -> ID','for_target_names',1,'p_for_target_names','parser_loops.py',32),
+  ('for_target_names -> ID COMMA for_target_names','for_target_names',3,'p_for_target_names','parser_loops.py',33),
+  ('small_stmt -> assignment','small_stmt',1,'p_small_stmt','parser_statements.py',33),
+  ('small_stmt -> return_stmt','small_stmt',1,'p_small_stmt','parser_statements.py',34),
+  ('small_stmt -> yield_stmt','small_stmt',1,'p_small_stmt','parser_statements.py',35),
+  ('small_stmt -> break_stmt','small_stmt',1,'p_small_stmt','parser_statements.py',36),
+  ('small_stmt -> continue_stmt','small_stmt',1,'p_small_stmt','parser_statements.py',37),
+  ('small_stmt -> pass_stmt','small_stmt',1,'p_small_stmt','parser_statements.py',38),
+  ('small_stmt -> expr','small_stmt',1,'p_small_stmt','parser_statements.py',39),
   ('param -> ID','param',1,'p_param','parser_definitions.py',34),
   ('param -> ID ASSIGN expr','param',3,'p_param','parser_definitions.py',35),
-  ('atom -> NUMBER','atom',1,'p_atom_number','parser_expressions.py',37),
-  ('atom -> STRING','atom',1,'p_atom_string','parser_expressions.py',42),
-  ('atom -> TRUE','atom',1,'p_atom_true','parser_expressions.py',47),
-  ('assignment -> atom LBRACKET expr RBRACKET ASSIGN expr','assignment',6,'p_assignment_subscript','parser_statements.py',48),
-  ('assignment -> atom LBRACKET expr RBRACKET PLUS_ASSIGN expr','assignment',6,'p_assignment_subscript','parser_statements.py',49),
-  ('assignment -> atom LBRACKET expr RBRACKET MINUS_ASSIGN expr','assignment',6,'p_assignment_subscript','parser_statements.py',50),
-  ('assignment -> atom LBRACKET expr RBRACKET TIMES_ASSIGN expr','assignment',6,'p_assignment_subscript','parser_statements.py',51),
-  ('assignment -> atom LBRACKET expr RBRACKET DIVIDE_ASSIGN expr','assignment',6,'p_assignment_subscript','parser_statements.py',52),
-  ('assignment -> atom LBRACKET expr RBRACKET FLOOR_DIVIDE_ASSIGN expr','assignment',6,'p_assignment_subscript','parser_statements.py',53),
-  ('assignment -> atom LBRACKET expr RBRACKET MOD_ASSIGN expr','assignment',6,'p_assignment_subscript','parser_statements.py',54),
-  ('assignment -> atom LBRACKET expr RBRACKET POWER_ASSIGN expr','assignment',6,'p_assignment_subscript','parser_statements.py',55),
-  ('atom -> FALSE','atom',1,'p_atom_false','parser_expressions.py',52),
-  ('atom -> NONE','atom',1,'p_atom_none','parser_expressions.py',57),
-  ('atom -> ID','atom',1,'p_atom_identifier','parser_expressions.py',62),
-  ('assignment -> atom DOT ID ASSIGN expr','assignment',5,'p_assignment_attribute','parser_statements.py',64),
-  ('assignment -> atom DOT ID PLUS_ASSIGN expr','assignment',5,'p_assignment_attribute','parser_statements.py',65),
-  ('assignment -> atom DOT ID MINUS_ASSIGN expr','assignment',5,'p_assignment_attribute','parser_statements.py',66),
-  ('assignment -> atom DOT ID TIMES_ASSIGN expr','assignment',5,'p_assignment_attribute','parser_statements.py',67),
-  ('assignment -> atom DOT ID DIVIDE_ASSIGN expr','assignment',5,'p_assignment_attribute','parser_statements.py',68),
-  ('assignment -> atom DOT ID FLOOR_DIVIDE_ASSIGN expr','assignment',5,'p_assignment_attribute','parser_statements.py',69),
-  ('assignment -> atom DOT ID MOD_ASSIGN expr','assignment',5,'p_assignment_attribute','parser_statements.py',70),
-  ('assignment -> atom DOT ID POWER_ASSIGN expr','assignment',5,'p_assignment_attribute','parser_statements.py',71),
-  ('atom -> LPAREN elements_opt RPAREN','atom',3,'p_atom_paren','parser_expressions.py',68),
-  ('atom -> LBRACKET elements_opt RBRACKET','atom',3,'p_atom_list','parser_expressions.py',77),
-  ('assignment -> assign_targets ASSIGN expr','assignment',3,'p_assignment','parser_statements.py',80),
-  ('assignment -> assign_targets PLUS_ASSIGN expr','assignment',3,'p_assignment','parser_statements.py',81),
-  ('assignment -> assign_targets MINUS_ASSIGN expr','assignment',3,'p_assignment','parser_statements.py',82),
-  ('assignment -> assign_targets TIMES_ASSIGN expr','assignment',3,'p_assignment','parser_statements.py',83),
-  ('assignment -> assign_targets DIVIDE_ASSIGN expr','assignment',3,'p_assignment','parser_statements.py',84),
-  ('assignment -> assign_targets FLOOR_DIVIDE_ASSIGN expr','assignment',3,'p_assignment','parser_statements.py',85),
-  ('assignment -> assign_targets MOD_ASSIGN expr','assignment',3,'p_assignment','parser_statements.py',86),
-  ('assignment -> assign_targets POWER_ASSIGN expr','assignment',3,'p_assignment','parser_statements.py',87),
-  ('atom -> atom LBRACKET expr RBRACKET','atom',4,'p_atom_subscript','parser_expressions.py',82),
-  ('atom -> LBRACE key_value_list_opt RBRACE','atom',3,'p_atom_dict','parser_expressions.py',88),
-  ('atom -> atom LBRACKET subscript_item RBRACKET','atom',4,'p_atom_subscript_slice','parser_expressions.py',95),
-  ('subscript_item -> expr','subscript_item',1,'p_subscript_item_index','parser_expressions.py',100),
-  ('assign_targets -> assign_targets ASSIGN target','assign_targets',3,'p_assign_targets','parser_statements.py',101),
-  ('assign_targets -> target','assign_targets',1,'p_assign_targets','parser_statements.py',102),
-  ('subscript_item -> opt_expr COLON opt_expr','subscript_item',3,'p_subscript_item_slice_2','parser_expressions.py',104),
-  ('target -> ID','target',1,'p_target','parser_statements.py',109),
-  ('target -> LPAREN elements_opt RPAREN','target',3,'p_target','parser_statements.py',110),
-  ('target -> LBRACKET elements_opt RBRACKET','target',3,'p_target','parser_statements.py',111),
-  ('target -> target LBRACKET expr RBRACKET','target',4,'p_target','parser_statements.py',112),
-  ('target -> target DOT ID','target',3,'p_target','parser_statements.py',113),
-  ('subscript_item -> opt_expr COLON opt_expr COLON opt_expr','subscript_item',5,'p_subscript_item_slice_3','parser_expressions.py',110),
-  ('subscript_item -> COLON opt_expr','subscript_item',2,'p_subscript_item_slice_head','parser_expressions.py',116),
-  ('subscript_item -> opt_expr COLON','subscript_item',2,'p_subscript_item_slice_tail','parser_expressions.py',121),
-  ('subscript_item -> COLON','subscript_item',1,'p_subscript_item_slice_all','parser_expressions.py',126),
-  ('module -> statement_list','module',1,'p_module','parser.py',128),
-  ('subscript_item -> COLON COLON opt_expr','subscript_item',3,'p_subscript_item_slice_step_only','parser_expressions.py',131),
-  ('return_stmt -> RETURN expr','return_stmt',2,'p_return_stmt','parser_statements.py',133),
-  ('return_stmt -> RETURN','return_stmt',1,'p_return_stmt','parser_statements.py',134),
-  ('statement_list -> statement','statement_list',1,'p_statement_list','parser.py',135),
-  ('statement_list -> statement_list statement','statement_list',2,'p_statement_list','parser.py',136),
-  ('opt_expr -> <empty>','opt_expr',0,'p_opt_expr_empty','parser_expressions.py',136),
-  ('opt_expr -> expr','opt_expr',1,'p_opt_expr_expr','parser_expressions.py',140),
-  ('break_stmt -> BREAK','break_stmt',1,'p_break_stmt','parser_statements.py',141),
-  ('atom -> LBRACE set_elements RBRACE','atom',3,'p_atom_set','parser_expressions.py',145),
-  ('continue_stmt -> CONTINUE','continue_stmt',1,'p_continue_stmt','parser_statements.py',145),
-  ('pass_stmt -> PASS','pass_stmt',1,'p_pass_stmt','parser_statements.py',149),
-  ('set_elements -> expr','set_elements',1,'p_set_elements_single','parser_expressions.py',150),
-  ('set_elements -> set_elements COMMA expr','set_elements',3,'p_set_elements_multi','parser_expressions.py',154),
-  ('set_elements -> set_elements COMMA','set_elements',2,'p_set_elements_trailing','parser_expressions.py',159),
-  ('expr -> PLUS expr','expr',2,'p_expr_unary_plus','parser_expressions.py',165),
-  ('expr -> MINUS expr','expr',2,'p_expr_unary_minus','parser_expressions.py',171),
-  ('expr -> NOT expr','expr',2,'p_expr_unary_not','parser_expressions.py',176),
-  ('expr -> expr POWER expr','expr',3,'p_expr_power','parser_expressions.py',182),
-  ('expr -> expr TIMES expr','expr',3,'p_expr_multiplicative','parser_expressions.py',187),
-  ('expr -> expr DIVIDE expr','expr',3,'p_expr_multiplicative','parser_expressions.py',188),
-  ('expr -> expr FLOOR_DIVIDE expr','expr',3,'p_expr_multiplicative','parser_expressions.py',189),
-  ('expr -> expr MOD expr','expr',3,'p_expr_multiplicative','parser_expressions.py',190),
-  ('expr -> expr PLUS expr','expr',3,'p_expr_additive','parser_expressions.py',195),
-  ('expr -> expr MINUS expr','expr',3,'p_expr_additive','parser_expressions.py',196),
-  ('expr -> expr EQUALS expr','expr',3,'p_expr_comparison','parser_expressions.py',202),
-  ('expr -> expr NOT_EQUALS expr','expr',3,'p_expr_comparison','parser_expressions.py',203),
-  ('expr -> expr LESS_THAN expr','expr',3,'p_expr_comparison','parser_expressions.py',204),
-  ('expr -> expr LESS_THAN_EQUALS expr','expr',3,'p_expr_comparison','parser_expressions.py',205),
-  ('expr -> expr GREATER_THAN expr','expr',3,'p_expr_comparison','parser_expressions.py',206),
-  ('expr -> expr GREATER_THAN_EQUALS expr','expr',3,'p_expr_comparison','parser_expressions.py',207),
-  ('expr -> expr IN expr','expr',3,'p_expr_comparison','parser_expressions.py',208),
-  ('expr -> expr AND expr','expr',3,'p_expr_logical','parser_expressions.py',214),
-  ('expr -> expr OR expr','expr',3,'p_expr_logical','parser_expressions.py',215),
-  ('expr -> atom LPAREN arg_list_opt RPAREN','expr',4,'p_expr_call','parser_expressions.py',221),
-  ('arg_list_opt -> expr COMMA arg_list_opt','arg_list_opt',3,'p_arg_list_opt','parser_expressions.py',227),
-  ('arg_list_opt -> expr','arg_list_opt',1,'p_arg_list_opt','parser_expressions.py',228),
-  ('arg_list_opt -> <empty>','arg_list_opt',0,'p_arg_list_opt_empty','parser_expressions.py',235),
-  ('key_value_list -> key_value','key_value_list',1,'p_key_value_list','parser_expressions.py',239),
-  ('key_value_list -> key_value COMMA key_value_list','key_value_list',3,'p_key_value_list','parser_expressions.py',240),
-  ('key_value_list_opt -> key_value_list','key_value_list_opt',1,'p_key_value_list_opt','parser_expressions.py',247),
-  ('key_value_list_opt -> empty','key_value_list_opt',1,'p_key_value_list_opt','parser_expressions.py',248),
-  ('key_value -> expr COLON expr','key_value',3,'p_key_value','parser_expressions.py',252),
-  ('elements_opt -> elements','elements_opt',1,'p_elements_opt','parser_expressions.py',256),
-  ('elements_opt -> empty','elements_opt',1,'p_elements_opt','parser_expressions.py',257),
-  ('elements -> expr','elements',1,'p_elements','parser_expressions.py',261),
-  ('elements -> elements COMMA expr','elements',3,'p_elements','parser_expressions.py',262),
-  ('empty -> <empty>','empty',0,'p_empty','parser_expressions.py',269),
+  ('atom -> NUMBER','atom',1,'p_atom_number','parser_expressions.py',38),
+  ('atom -> STRING','atom',1,'p_atom_string','parser_expressions.py',43),
+  ('atom -> TRUE','atom',1,'p_atom_true','parser_expressions.py',48),
+  ('assignment -> atom LBRACKET expr RBRACKET ASSIGN expr','assignment',6,'p_assignment_subscript','parser_statements.py',50),
+  ('assignment -> atom LBRACKET expr RBRACKET PLUS_ASSIGN expr','assignment',6,'p_assignment_subscript','parser_statements.py',51),
+  ('assignment -> atom LBRACKET expr RBRACKET MINUS_ASSIGN expr','assignment',6,'p_assignment_subscript','parser_statements.py',52),
+  ('assignment -> atom LBRACKET expr RBRACKET TIMES_ASSIGN expr','assignment',6,'p_assignment_subscript','parser_statements.py',53),
+  ('assignment -> atom LBRACKET expr RBRACKET DIVIDE_ASSIGN expr','assignment',6,'p_assignment_subscript','parser_statements.py',54),
+  ('assignment -> atom LBRACKET expr RBRACKET FLOOR_DIVIDE_ASSIGN expr','assignment',6,'p_assignment_subscript','parser_statements.py',55),
+  ('assignment -> atom LBRACKET expr RBRACKET MOD_ASSIGN expr','assignment',6,'p_assignment_subscript','parser_statements.py',56),
+  ('assignment -> atom LBRACKET expr RBRACKET POWER_ASSIGN expr','assignment',6,'p_assignment_subscript','parser_statements.py',57),
+  ('atom -> FALSE','atom',1,'p_atom_false','parser_expressions.py',53),
+  ('atom -> NONE','atom',1,'p_atom_none','parser_expressions.py',58),
+  ('atom -> ID','atom',1,'p_atom_identifier','parser_expressions.py',63),
+  ('assignment -> atom DOT ID ASSIGN expr','assignment',5,'p_assignment_attribute','parser_statements.py',66),
+  ('assignment -> atom DOT ID PLUS_ASSIGN expr','assignment',5,'p_assignment_attribute','parser_statements.py',67),
+  ('assignment -> atom DOT ID MINUS_ASSIGN expr','assignment',5,'p_assignment_attribute','parser_statements.py',68),
+  ('assignment -> atom DOT ID TIMES_ASSIGN expr','assignment',5,'p_assignment_attribute','parser_statements.py',69),
+  ('assignment -> atom DOT ID DIVIDE_ASSIGN expr','assignment',5,'p_assignment_attribute','parser_statements.py',70),
+  ('assignment -> atom DOT ID FLOOR_DIVIDE_ASSIGN expr','assignment',5,'p_assignment_attribute','parser_statements.py',71),
+  ('assignment -> atom DOT ID MOD_ASSIGN expr','assignment',5,'p_assignment_attribute','parser_statements.py',72),
+  ('assignment -> atom DOT ID POWER_ASSIGN expr','assignment',5,'p_assignment_attribute','parser_statements.py',73),
+  ('atom -> LPAREN elements_opt RPAREN','atom',3,'p_atom_paren','parser_expressions.py',69),
+  ('atom -> LPAREN generator_body RPAREN','atom',3,'p_atom_generator','parser_expressions.py',78),
+  ('assignment -> assign_targets ASSIGN expr','assignment',3,'p_assignment','parser_statements.py',82),
+  ('assignment -> assign_targets PLUS_ASSIGN expr','assignment',3,'p_assignment','parser_statements.py',83),
+  ('assignment -> assign_targets MINUS_ASSIGN expr','assignment',3,'p_assignment','parser_statements.py',84),
+  ('assignment -> assign_targets TIMES_ASSIGN expr','assignment',3,'p_assignment','parser_statements.py',85),
+  ('assignment -> assign_targets DIVIDE_ASSIGN expr','assignment',3,'p_assignment','parser_statements.py',86),
+  ('assignment -> assign_targets FLOOR_DIVIDE_ASSIGN expr','assignment',3,'p_assignment','parser_statements.py',87),
+  ('assignment -> assign_targets MOD_ASSIGN expr','assignment',3,'p_assignment','parser_statements.py',88),
+  ('assignment -> assign_targets POWER_ASSIGN expr','assignment',3,'p_assignment','parser_statements.py',89),
+  ('generator_body -> expr FOR for_targets IN expr','generator_body',5,'p_generator_body','parser_expressions.py',83),
+  ('generator_body -> expr FOR for_targets IN expr IF expr','generator_body',7,'p_generator_body','parser_expressions.py',84),
+  ('atom -> LBRACKET elements_opt RBRACKET','atom',3,'p_atom_list','parser_expressions.py',96),
+  ('atom -> atom LBRACKET expr RBRACKET','atom',4,'p_atom_subscript','parser_expressions.py',101),
+  ('assign_targets -> assign_targets ASSIGN target','assign_targets',3,'p_assign_targets','parser_statements.py',103),
+  ('assign_targets -> target','assign_targets',1,'p_assign_targets','parser_statements.py',104),
+  ('atom -> LBRACE key_value_list_opt RBRACE','atom',3,'p_atom_dict','parser_expressions.py',107),
+  ('target -> ID','target',1,'p_target','parser_statements.py',111),
+  ('target -> LPAREN elements_opt RPAREN','target',3,'p_target','parser_statements.py',112),
+  ('target -> LBRACKET elements_opt RBRACKET','target',3,'p_target','parser_statements.py',113),
+  ('target -> target LBRACKET expr RBRACKET','target',4,'p_target','parser_statements.py',114),
+  ('target -> target DOT ID','target',3,'p_target','parser_statements.py',115),
+  ('atom -> atom LBRACKET subscript_item RBRACKET','atom',4,'p_atom_subscript_slice','parser_expressions.py',114),
+  ('subscript_item -> expr','subscript_item',1,'p_subscript_item_index','parser_expressions.py',119),
+  ('subscript_item -> opt_expr COLON opt_expr','subscript_item',3,'p_subscript_item_slice_2','parser_expressions.py',123),
+  ('subscript_item -> opt_expr COLON opt_expr COLON opt_expr','subscript_item',5,'p_subscript_item_slice_3','parser_expressions.py',129),
+  ('module -> statement_list','module',1,'p_module','parser.py',131),
+  ('subscript_item -> COLON opt_expr','subscript_item',2,'p_subscript_item_slice_head','parser_expressions.py',135),
+  ('return_stmt -> RETURN expr','return_stmt',2,'p_return_stmt','parser_statements.py',135),
+  ('return_stmt -> RETURN','return_stmt',1,'p_return_stmt','parser_statements.py',136),
+  ('statement_list -> statement','statement_list',1,'p_statement_list','parser.py',138),
+  ('statement_list -> statement_list statement','statement_list',2,'p_statement_list','parser.py',139),
+  ('subscript_item -> opt_expr COLON','subscript_item',2,'p_subscript_item_slice_tail','parser_expressions.py',140),
+  ('yield_stmt -> YIELD expr','yield_stmt',2,'p_yield_stmt','parser_statements.py',143),
+  ('yield_stmt -> YIELD','yield_stmt',1,'p_yield_stmt','parser_statements.py',144),
+  ('subscript_item -> COLON','subscript_item',1,'p_subscript_item_slice_all','parser_expressions.py',145),
+  ('break_stmt -> BREAK','break_stmt',1,'p_break_stmt','parser_statements.py',149),
+  ('subscript_item -> COLON COLON opt_expr','subscript_item',3,'p_subscript_item_slice_step_only','parser_expressions.py',150),
+  ('continue_stmt -> CONTINUE','continue_stmt',1,'p_continue_stmt','parser_statements.py',153),
+  ('opt_expr -> <empty>','opt_expr',0,'p_opt_expr_empty','parser_expressions.py',155),
+  ('pass_stmt -> PASS','pass_stmt',1,'p_pass_stmt','parser_statements.py',157),
+  ('opt_expr -> expr','opt_expr',1,'p_opt_expr_expr','parser_expressions.py',159),
+  ('atom -> LBRACE set_elements RBRACE','atom',3,'p_atom_set','parser_expressions.py',164),
+  ('set_elements -> expr','set_elements',1,'p_set_elements_single','parser_expressions.py',169),
+  ('set_elements -> set_elements COMMA expr','set_elements',3,'p_set_elements_multi','parser_expressions.py',173),
+  ('set_elements -> set_elements COMMA','set_elements',2,'p_set_elements_trailing','parser_expressions.py',178),
+  ('expr -> PLUS expr','expr',2,'p_expr_unary_plus','parser_expressions.py',184),
+  ('expr -> MINUS expr','expr',2,'p_expr_unary_minus','parser_expressions.py',190),
+  ('expr -> NOT expr','expr',2,'p_expr_unary_not','parser_expressions.py',195),
+  ('expr -> expr POWER expr','expr',3,'p_expr_power','parser_expressions.py',201),
+  ('expr -> expr TIMES expr','expr',3,'p_expr_multiplicative','parser_expressions.py',206),
+  ('expr -> expr DIVIDE expr','expr',3,'p_expr_multiplicative','parser_expressions.py',207),
+  ('expr -> expr FLOOR_DIVIDE expr','expr',3,'p_expr_multiplicative','parser_expressions.py',208),
+  ('expr -> expr MOD expr','expr',3,'p_expr_multiplicative','parser_expressions.py',209),
+  ('expr -> expr PLUS expr','expr',3,'p_expr_additive','parser_expressions.py',214),
+  ('expr -> expr MINUS expr','expr',3,'p_expr_additive','parser_expressions.py',215),
+  ('expr -> expr PIPE expr','expr',3,'p_expr_bitwise','parser_expressions.py',220),
+  ('expr -> expr CARET expr','expr',3,'p_expr_bitwise','parser_expressions.py',221),
+  ('expr -> expr AMPERSAND expr','expr',3,'p_expr_bitwise','parser_expressions.py',222),
+  ('expr -> expr EQUALS expr','expr',3,'p_expr_comparison','parser_expressions.py',228),
+  ('expr -> expr NOT_EQUALS expr','expr',3,'p_expr_comparison','parser_expressions.py',229),
+  ('expr -> expr LESS_THAN expr','expr',3,'p_expr_comparison','parser_expressions.py',230),
+  ('expr -> expr LESS_THAN_EQUALS expr','expr',3,'p_expr_comparison','parser_expressions.py',231),
+  ('expr -> expr GREATER_THAN expr','expr',3,'p_expr_comparison','parser_expressions.py',232),
+  ('expr -> expr GREATER_THAN_EQUALS expr','expr',3,'p_expr_comparison','parser_expressions.py',233),
+  ('expr -> expr IN expr','expr',3,'p_expr_comparison','parser_expressions.py',234),
+  ('expr -> expr AND expr','expr',3,'p_expr_logical','parser_expressions.py',240),
+  ('expr -> expr OR expr','expr',3,'p_expr_logical','parser_expressions.py',241),
+  ('expr -> atom LPAREN arg_list_opt RPAREN','expr',4,'p_expr_call','parser_expressions.py',247),
+  ('expr -> atom LPAREN generator_body RPAREN','expr',4,'p_expr_call_generator','parser_expressions.py',253),
+  ('arg_list_opt -> expr COMMA arg_list_opt','arg_list_opt',3,'p_arg_list_opt','parser_expressions.py',259),
+  ('arg_list_opt -> expr','arg_list_opt',1,'p_arg_list_opt','parser_expressions.py',260),
+  ('arg_list_opt -> <empty>','arg_list_opt',0,'p_arg_list_opt_empty','parser_expressions.py',267),
+  ('key_value_list -> key_value','key_value_list',1,'p_key_value_list','parser_expressions.py',271),
+  ('key_value_list -> key_value COMMA key_value_list','key_value_list',3,'p_key_value_list','parser_expressions.py',272),
+  ('key_value_list_opt -> key_value_list','key_value_list_opt',1,'p_key_value_list_opt','parser_expressions.py',279),
+  ('key_value_list_opt -> empty','key_value_list_opt',1,'p_key_value_list_opt','parser_expressions.py',280),
+  ('key_value -> expr COLON expr','key_value',3,'p_key_value','parser_expressions.py',284),
+  ('elements_opt -> elements','elements_opt',1,'p_elements_opt','parser_expressions.py',288),
+  ('elements_opt -> empty','elements_opt',1,'p_elements_opt','parser_expressions.py',289),
+  ('elements -> expr','elements',1,'p_elements','parser_expressions.py',293),
+  ('elements -> elements COMMA expr','elements',3,'p_elements','parser_expressions.py',294),
+  ('empty -> <empty>','empty',0,'p_empty','parser_expressions.py',301),
 ]
@@ -0,0 +1,342 @@
+// Copyright (c) 2025 Andres Quesada, David Obando, Randy Aguero
+#include "BigInt.hpp"
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+  constexpr std::uint64_t LIMB_BASE = 1ULL << 32;
+  // Decimal chunk used by toString()/fromString(): the largest power of ten below 2^32
+  constexpr std::uint32_t DECIMAL_CHUNK = 1000000000U;
+  constexpr int DECIMAL_CHUNK_DIGITS = 9;
+}
+
+BigInt::BigInt(long long value) {
+  negative = value < 0;
+  // Negate as unsigned so that LLONG_MIN does not overflow
+  std::uint64_t magnitude = negative ? 0ULL - static_cast<std::uint64_t>(value) : static_cast<std::uint64_t>(value);
+  while (magnitude != 0) {
+    limbs.push_back(static_cast<std::uint32_t>(magnitude));
+    magnitude >>= 32;
+  }
+}
+
+BigInt BigInt::fromString(const std::string &text) {
+  std::size_t pos = 0;
+  std::size_t end = text.size();
+  while (pos < end && std::isspace(static_cast<unsigned char>(text[pos]))) ++pos;
+  while (end > pos && std::isspace(static_cast<unsigned char>(text[end - 1]))) --end;
+
+  bool negative = false;
+  if (pos < end && (text[pos] == '+' || text[pos] == '-')) {
+    negative = text[pos] == '-';
+    ++pos;
+  }
+  if (pos == end) {
+    throw std::runtime_error("Cannot convert string to int (invalid argument)");
+  }
+
+  BigInt result;
+  while (pos < end) {
+    std::size_t digits = std::min<std::size_t>(DECIMAL_CHUNK_DIGITS, end - pos);
+    std::uint32_t chunk = 0;
+    std::uint32_t scale = 1;
+    for (std::size_t i = 0; i < digits; ++i, ++pos) {
+      if (!std::isdigit(static_cast<unsigned char>(text[pos]))) {
+        throw std::runtime_error("Cannot convert string to int (invalid argument)");
+      }
+      chunk = chunk * 10 + static_cast<std::uint32_t>(text[pos] - '0');
+      scale *= 10;
+    }
+    // result = result * scale + chunk
+    std::uint64_t carry = chunk;
+    for (std::uint32_t &limb : result.limbs) {
+      std::uint64_t value = static_cast<std::uint64_t>(limb) * scale + carry;
+      limb = static_cast<std::uint32_t>(value);
+      carry = value >> 32;
+    }
+    if (carry != 0) result.limbs.push_back(static_cast<std::uint32_t>(carry));
+  }
+  result.negative = negative;
+  result.trim();
+  return result;
+}
+
+bool BigInt::fitsInt64() const {
+  if (limbs.size() <= 1) return true;
+  if (limbs.size() > 2) return false;
+  std::uint64_t magnitude = (static_cast<std::uint64_t>(limbs[1]) << 32) | limbs[0];
+  std::uint64_t limit = 1ULL << 63;
+  return negative ? magnitude <= limit : magnitude < limit;
+}
+
+long long BigInt::toInt64() const {
+  std::uint64_t magnitude = 0;
+  for (std::size_t i = limbs.size(); i-- > 0;) {
+    magnitude = (magnitude << 32) | limbs[i];
+  }
+  return negative ? static_cast<long long>(0ULL - magnitude) : static_cast<long long>(magnitude);
+}
+
+BigInt BigInt::fromDouble(double value) {
+  BigInt result;
+  result.negative = value < 0;
+  // Dividing by the limb base only shifts the exponent, so every step is exact
+  double magnitude = std::trunc(std::fabs(value));
+  while (magnitude >= 1.0) {
+    result.limbs.push_back(static_cast<std::uint32_t>(std::fmod(magnitude, static_cast<double>(LIMB_BASE))));
+    magnitude = std::floor(magnitude / static_cast<double>(LIMB_BASE));
+  }
+  result.trim();
+  return result;
+}
+
+double BigInt::toDouble() const {
+  double result = 0.0;
+  for (std::size_t i = limbs.size(); i-- > 0;) {
+    result = result * static_cast<double>(LIMB_BASE) + limbs[i];
+  }
+  return negative ? -result : result;
+}
+
+std::string BigInt::toString() const {
+  if (isZero()) return "0";
+  Limbs value = limbs;
+  std::vector<std::uint32_t> chunks;
+  while (!value.empty()) {
+    chunks.push_back(divSmall(value, DECIMAL_CHUNK));
+  }
+  std::string result = negative ? "-" : "";
+  result += std::to_string(chunks.back());
+  for (std::size_t i = chunks.size() - 1; i-- > 0;) {
+    std::string digits = std::to_string(chunks[i]);
+    result.append(DECIMAL_CHUNK_DIGITS - digits.size(), '0');
+    result += digits;
+  }
+  return result;
+}
+
+std::size_t BigInt::hash() const {
+  // Python's int hash: the value modulo 2^61 - 1, where multiplying by 2^32
+  // is a rotation of the 61-bit residue
+  constexpr std::uint64_t modulus = (1ULL << 61) - 1;
+  std::uint64_t residue = 0;
+  for (std::size_t i = limbs.size(); i-- > 0;) {
+    residue = ((residue << 32) & modulus) | (residue >> 29);
+    residue += limbs[i];
+    if (residue >= modulus) residue -= modulus;
+  }
+  return static_cast<std::size_t>(negative ? 0ULL - residue : residue);
+}
+
+int BigInt::compare(const BigInt &other) const {
+  if (negative != other.negative) return negative ? -1 : 1;
+  int order = compareMagnitude(limbs, other.limbs);
+  return negative ? -order : order;
+}
+
+BigInt BigInt::operator-() const {
+  BigInt result = *this;
+  if (!result.isZero()) result.negative = !negative;
+  return result;
+}
+
+BigInt operator+(const BigInt &a, const BigInt &b) {
+  BigInt result;
+  if (a.negative == b.negative) {
+    result.limbs = BigInt::addMagnitude(a.limbs, b.limbs);
+    result.negative = a.negative;
+  } else if (BigInt::compareMagnitude(a.limbs, b.limbs) >= 0) {
+    result.limbs = BigInt::subMagnitude(a.limbs, b.limbs);
+    result.negative = a.negative;
+  } else {
+    result.limbs = BigInt::subMagnitude(b.limbs, a.limbs);
+    result.negative = b.negative;
+  }
+  result.trim();
+  return result;
+}
+
+BigInt operator-(const BigInt &a, const BigInt &b) {
+  return a + (-b);
+}
+
+BigInt operator*(const BigInt &a, const BigInt &b) {
+  BigInt result;
+  result.limbs = BigInt::mulMagnitude(a.limbs, b.limbs);
+  result.negative = a.negative != b.negative;
+  result.trim();
+  return result;
+}
+
+void BigInt::divMod(const BigInt &a, const BigInt &b, BigInt &quotient, BigInt &remainder) {
+  if (b.isZero()) {
+    throw std::runtime_error("Floor division by zero");
+  }
+  BigInt q, r;
+  divModMagnitude(a.limbs, b.limbs, q.limbs, r.limbs);
+  q.negative = a.negative != b.negative;
+  r.negative = a.negative;
+  q.trim();
+  r.trim();
+  // Truncating division rounds toward zero; Python rounds toward negative infinity
+  if (!r.isZero() && a.negative != b.negative) {
+    q = q - BigInt(1);
+    r = r + b;
+  }
+  quotient = std::move(q);
+  remainder = std::move(r);
+}
+
+BigInt BigInt::pow(unsigned long long exponent) const {
+  BigInt result(1);
+  BigInt base = *this;
+  while (exponent != 0) {
+    if (exponent & 1) result = result * base;
+    exponent >>= 1;
+    if (exponent != 0) base = base * base;
+  }
+  return result;
+}
+
+// ---------- Magnitude helpers ----------
+void BigInt::trim() {
+  while (!limbs.empty() && limbs.back() == 0) limbs.pop_back();
+  if (limbs.empty()) negative = false;
+}
+
+int BigInt::compareMagnitude(const Limbs &a, const Limbs &b) {
+  if (a.size() != b.size()) return a.size() < b.size() ? -1 : 1;
+  for (std::size_t i = a.size(); i-- > 0;) {
+    if (a[i] != b[i]) return a[i] < b[i] ? -1 : 1;
+  }
+  return 0;
+}
+
+BigInt::Limbs BigInt::addMagnitude(const Limbs &a, const Limbs &b) {
+  const Limbs &longer = a.size() >= b.size() ? a : b;
+  const Limbs &shorter = a.size() >= b.size() ? b : a;
+  Limbs result(longer.size() + 1);
+  std::uint64_t carry = 0;
+  for (std::size_t i = 0; i < longer.size(); ++i) {
+    std::uint64_t sum = static_cast<std::uint64_t>(longer[i]) + (i < shorter.size() ? shorter[i] : 0) + carry;
+    result[i] = static_cast<std::uint32_t>(sum);
+    carry = sum >> 32;
+  }
+  result[longer.size()] = static_cast<std::uint32_t>(carry);
+  return result;
+}
+
+BigInt::Limbs BigInt::subMagnitude(const Limbs &a, const Limbs &b) {
+  Limbs result(a.size());
+  std::int64_t borrow = 0;
+  for (std::size_t i = 0; i < a.size(); ++i) {
+    std::int64_t diff = static_cast<std::int64_t>(a[i]) - (i < b.size() ? b[i] : 0) - borrow;
+    borrow = diff < 0 ? 1 : 0;
+    result[i] = static_cast<std::uint32_t>(diff + (borrow ? static_cast<std::int64_t>(LIMB_BASE) : 0));
+  }
+  return result;
+}
+
+BigInt::Limbs BigInt::mulMagnitude(const Limbs &a, const Limbs &b) {
+  if (a.empty() || b.empty()) return {};
+  Limbs result(a.size() + b.size(), 0);
+  for (std::size_t i = 0; i < a.size(); ++i) {
+    std::uint64_t carry = 0;
+    for (std::size_t j = 0; j < b.size(); ++j) {
+      std::uint64_t value = static_cast<std::uint64_t>(a[i]) * b[j] + result[i + j] + carry;
+      result[i + j] = static_cast<std::uint32_t>(value);
+      carry = value >> 32;
+    }
+    result[i + b.size()] = static_cast<std::uint32_t>(carry);
+  }
+  return result;
+}
+
+std::uint32_t BigInt::divSmall(Limbs &value, std::uint32_t divisor) {
+  std::uint64_t remainder = 0;
+  for (std::size_t i = value.size(); i-- > 0;) {
+    std::uint64_t current = (remainder << 32) | value[i];
+    value[i] = static_cast<std::uint32_t>(current / divisor);
+    remainder = current % divisor;
+  }
+  while (!value.empty() && value.back() == 0) value.pop_back();
+  return static_cast<std::uint32_t>(remainder);
+}
+
+void BigInt::divModMagnitude(const Limbs &a, const Limbs &b, Limbs &quotient, Limbs &remainder) {
+  if (compareMagnitude(a, b) < 0) {
+    quotient.clear();
+    remainder = a;
+    return;
+  }
+  if (b.size() == 1) {
+    quotient = a;
+    remainder = {divSmall(quotient, b[0])};
+    return;
+  }
+
+  // Knuth, TAOCP vol. 2, 4.3.1 Algorithm D: normalize so the divisor's top bit is set
+  std::size_t n = b.size();
+  std::size_t m = a.size() - n;
+  int shift = 0;
+  for (std::uint32_t top = b.back(); !(top & 0x80000000U); top <<= 1) ++shift;
+
+  Limbs divisor(n);
+  for (std::size_t i = n; i-- > 0;) {
+    std::uint64_t lower = (shift && i > 0) ? (static_cast<std::uint64_t>(b[i - 1]) >> (32 - shift)) : 0;
+    divisor[i] = static_cast<std::uint32_t>((static_cast<std::uint64_t>(b[i]) << shift) | lower);
+  }
+  Limbs dividend(a.size() + 1);
+  dividend[a.size()] = shift ? static_cast<std::uint32_t>(static_cast<std::uint64_t>(a.back()) >> (32 - shift)) : 0;
+  for (std::size_t i = a.size(); i-- > 0;) {
+    std::uint64_t lower = (shift && i > 0) ? (static_cast<std::uint64_t>(a[i - 1]) >> (32 - shift)) : 0;
+    dividend[i] = static_cast<std::uint32_t>((static_cast<std::uint64_t>(a[i]) << shift) | lower);
+  }
+
+  quotient.assign(m + 1, 0);
+  for (std::size_t j = m + 1; j-- > 0;) {
+    // Estimate the quotient digit from the top two limbs, then correct it
+    std::uint64_t top = (static_cast<std::uint64_t>(dividend[j + n]) << 32) | dividend[j + n - 1];
+    std::uint64_t qhat = top / divisor[n - 1];
+    std::uint64_t rhat = top % divisor[n - 1];
+    while (qhat >= LIMB_BASE || qhat * divisor[n - 2] > ((rhat << 32) | dividend[j + n - 2])) {
+      --qhat;
+      rhat += divisor[n - 1];
+      if (rhat >= LIMB_BASE) break;
+    }
+
+    // Multiply and subtract qhat * divisor from the current window
+    std::int64_t borrow = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+      std::uint64_t product = qhat * divisor[i];
+      std::int64_t diff = static_cast<std::int64_t>(dividend[i + j]) - borrow -
+                          static_cast<std::int64_t>(product & 0xFFFFFFFFULL);
+      dividend[i + j] = static_cast<std::uint32_t>(diff);
+      borrow = static_cast<std::int64_t>(product >> 32) - (diff >> 32);
+    }
+    std::int64_t diff = static_cast<std::int64_t>(dividend[j + n]) - borrow;
+    dividend[j + n] = static_cast<std::uint32_t>(diff);
+
+    quotient[j] = static_cast<std::uint32_t>(qhat);
+    if (diff < 0) {
+      // qhat was one too large: add the divisor back
+      --quotient[j];
+      std::uint64_t carry = 0;
+      for (std::size_t i = 0; i < n; ++i) {
+        std::uint64_t sum = static_cast<std::uint64_t>(dividend[i + j]) + divisor[i] + carry;
+        dividend[i + j] = static_cast<std::uint32_t>(sum);
+        carry = sum >> 32;
+      }
+      dividend[j + n] = static_cast<std::uint32_t>(dividend[j + n] + carry);
+    }
+  }
+
+  // Undo the normalization on the remainder
+  remainder.assign(n, 0);
+  for (std::size_t i = 0; i < n; ++i) {
+    std::uint64_t upper = shift ? (static_cast<std::uint64_t>(dividend[i + 1]) << (32 - shift)) : 0;
+    remainder[i] = static_cast<std::uint32_t>((dividend[i] >> shift) | upper);
+  }
+}
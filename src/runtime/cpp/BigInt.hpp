@@ -0,0 +1,76 @@
+// Copyright (c) 2025 Andres Quesada, David Obando, Randy Aguero
+#ifndef BIG_INT_HPP
+#define BIG_INT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * BigInt: arbitrary-precision integer backing Python ints that do not fit
+ * in 64 bits.
+ *
+ * DynamicType keeps ints as a native int64 and only switches to a BigInt
+ * when an operation overflows, so ordinary arithmetic never pays for it.
+ * Values are immutable: sign plus magnitude in base 2^32 limbs, least
+ * significant first, with no leading zero limbs (zero has no limbs).
+ */
+class BigInt {
+  public:
+    BigInt() = default;
+    explicit BigInt(long long value);
+
+    /**
+     * Parse a decimal integer with optional sign and surrounding whitespace.
+     * Python example: int("123456789012345678901234567890")
+     * @throws std::runtime_error if text is not a valid integer
+     */
+    static BigInt fromString(const std::string &text);
+    // Integer part of a finite double, exactly. Python example: int(2e19)
+    static BigInt fromDouble(double value);
+
+    bool isZero() const { return limbs.empty(); }
+    bool isNegative() const { return negative; }
+    bool fitsInt64() const;
+    // Only valid when fitsInt64()
+    long long toInt64() const;
+    double toDouble() const;
+    std::string toString() const;
+    // Python's numeric hash, so a BigInt hashes like an equal double
+    std::size_t hash() const;
+
+    // Negative, zero or positive as this is less than, equal to or greater than other
+    int compare(const BigInt &other) const;
+
+    BigInt operator-() const;
+    friend BigInt operator+(const BigInt &a, const BigInt &b);
+    friend BigInt operator-(const BigInt &a, const BigInt &b);
+    friend BigInt operator*(const BigInt &a, const BigInt &b);
+
+    /**
+     * Division rounding toward negative infinity, remainder with the sign of
+     * the divisor (Python // and %).
+     * @throws std::runtime_error on division by zero
+     */
+    static void divMod(const BigInt &a, const BigInt &b, BigInt &quotient, BigInt &remainder);
+    BigInt pow(unsigned long long exponent) const;
+
+  private:
+    using Limbs = std::vector<std::uint32_t>;
+
+    bool negative = false;
+    Limbs limbs;
+
+    void trim();
+    static int compareMagnitude(const Limbs &a, const Limbs &b);
+    static Limbs addMagnitude(const Limbs &a, const Limbs &b);
+    // Requires |a| >= |b|
+    static Limbs subMagnitude(const Limbs &a, const Limbs &b);
+    static Limbs mulMagnitude(const Limbs &a, const Limbs &b);
+    // Truncating magnitude division
+    static void divModMagnitude(const Limbs &a, const Limbs &b, Limbs &quotient, Limbs &remainder);
+    static std::uint32_t divSmall(Limbs &value, std::uint32_t divisor);
+};
+
+#endif // BIG_INT_HPP
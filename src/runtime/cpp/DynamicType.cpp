@@ -1,253 +1,1098 @@
 // Copyright (c) 2025 Andres Quesada, David Obando, Randy Aguero
 #include "DynamicType.hpp"
 #include <algorithm>
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+#include <unordered_map>
+#if __has_include(<sys/mman.h>)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define TRANSPYLER_MMAP 1
+#endif
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#ifdef TRANSPYLER_PARALLEL
+#include <condition_variable>
+#include <cstdlib>
+#include <exception>
+#include <mutex>
+#include <thread>
+#endif
 
 
+void runtime_fail(const char *message) {
+  TRANSPYLER_PROFILE_EXCEPTION();
+  throw std::runtime_error(message);
+}
+
+namespace {
+  // Python's numeric hash: values are reduced modulo the Mersenne prime
+  // 2^61 - 1, which makes an integral double hash like the int it equals
+  constexpr std::uint64_t HASH_MODULUS = (1ULL << 61) - 1;
+  constexpr int HASH_BITS = 61;
+
+  std::size_t hashInt(long long value) {
+    std::uint64_t magnitude = value < 0 ? 0ULL - static_cast<std::uint64_t>(value) : static_cast<std::uint64_t>(value);
+    std::uint64_t reduced = magnitude % HASH_MODULUS;
+    return static_cast<std::size_t>(value < 0 ? 0ULL - reduced : reduced);
+  }
+
+  std::size_t hashDouble(double value) {
+    if (std::isinf(value)) return value > 0 ? 314159 : static_cast<std::size_t>(-314159);
+    if (std::isnan(value)) return 0;
+
+    int exponent;
+    double mantissa = std::frexp(value, &exponent);
+    bool negative = mantissa < 0;
+    if (negative) mantissa = -mantissa;
+
+    // Consume the mantissa 28 bits at a time; multiplying by 2^k mod 2^61 - 1 is a 61-bit rotation
+    std::uint64_t x = 0;
+    while (mantissa != 0.0) {
+      x = ((x << 28) & HASH_MODULUS) | (x >> (HASH_BITS - 28));
+      mantissa *= 268435456.0;
+      exponent -= 28;
+      std::uint64_t digit = static_cast<std::uint64_t>(mantissa);
+      mantissa -= static_cast<double>(digit);
+      x += digit;
+      if (x >= HASH_MODULUS) x -= HASH_MODULUS;
+    }
+    exponent = exponent >= 0 ? exponent % HASH_BITS : HASH_BITS - 1 - ((-1 - exponent) % HASH_BITS);
+    x = ((x << exponent) & HASH_MODULUS) | (x >> (HASH_BITS - exponent));
+    return static_cast<std::size_t>(negative ? 0ULL - x : x);
+  }
+
+  // CPython's tuple hash (xxHash lanes), for ordered sequences
+  constexpr std::uint64_t XXPRIME_1 = 11400714785074694791ULL;
+  constexpr std::uint64_t XXPRIME_2 = 14029467366897019727ULL;
+  constexpr std::uint64_t XXPRIME_5 = 2870177450012600261ULL;
+
+  std::uint64_t sequenceStep(std::uint64_t acc, std::size_t lane) {
+    acc += static_cast<std::uint64_t>(lane) * XXPRIME_2;
+    acc = (acc << 31) | (acc >> 33);
+    return acc * XXPRIME_1;
+  }
+
+  std::size_t sequenceFinish(std::uint64_t acc, std::size_t length) {
+    return static_cast<std::size_t>(acc + (static_cast<std::uint64_t>(length) ^ (XXPRIME_5 ^ 3527539ULL)));
+  }
+
+  // CPython's frozenset bit shuffle: spreads each hash before they are summed,
+  // so the combination does not depend on iteration order
+  std::uint64_t shuffleBits(std::uint64_t h) {
+    return ((h ^ 89869747ULL) ^ (h << 16)) * 3644798167ULL;
+  }
+
+  std::size_t unorderedFinish(std::uint64_t acc, std::size_t length) {
+    acc ^= (static_cast<std::uint64_t>(length) + 1) * 1927868237ULL;
+    acc ^= (acc >> 11) ^ (acc >> 25);
+    return static_cast<std::size_t>(acc * 69069U + 907133923UL);
+  }
+}
+
 namespace std {
   size_t hash<DynamicType>::operator()(const DynamicType& value) const {
-    size_t hashValue = 0;
-    
     switch (value.getType()) {
       case DynamicType::Type::NONE:
-        // None type always hashes to 0
-        hashValue = 0;
-        break;
-          
+        return 0;
+
       case DynamicType::Type::INT:
-        hashValue = std::hash<int>{}(value.toInt());
-        break;
-          
-      case DynamicType::Type::DOUBLE:
-        hashValue = std::hash<double>{}(value.toDouble());
-        break;
-          
-      case DynamicType::Type::STRING:
-        hashValue = std::hash<std::string>{}(value.toString());
-        break;
-          
+        return hashInt(value.payload.i);
+
       case DynamicType::Type::BOOL:
-        hashValue = std::hash<bool>{}(value.toBool());
-        break;
-          
-      default:
-        // For complex types (LIST, DICT, SET), use string representation
-        // Note: This is slower but ensures all types are hashable
-        hashValue = std::hash<std::string>{}(value.toString());
-        break;
+        return hashInt(value.payload.b ? 1 : 0);
+
+      case DynamicType::Type::DOUBLE:
+        return hashDouble(value.payload.d);
+
+      case DynamicType::Type::BIGINT:
+        return value.bigIntValue().hash();
+
+      case DynamicType::Type::STRING: {
+        // Same value as std::hash<std::string>, computed once per string object
+        DynamicType::StringObject *object = static_cast<DynamicType::StringObject *>(value.payload.heap);
+        std::size_t hash = object->hash.load(std::memory_order_relaxed);
+        if (hash == 0) {
+          hash = std::hash<std::string_view>{}(object->value);
+          object->hash.store(hash, std::memory_order_relaxed);
+        }
+        return hash;
+      }
+
+      case DynamicType::Type::LIST:
+      case DynamicType::Type::SLICE: {
+        DynamicType::ListSpan list = value.listSpan();
+        std::uint64_t acc = XXPRIME_5;
+        for (std::size_t i = 0; i < list.size; ++i) {
+          acc = sequenceStep(acc, (*this)(list[i]));
+        }
+        return sequenceFinish(acc, list.size);
+      }
+
+      case DynamicType::Type::SET: {
+        // Slots already carry their element hash
+        const DynamicType::Set &set = value.setValue();
+        std::uint64_t acc = 0;
+        for (DynamicType::Set::const_iterator it = set.begin(); it != set.end(); ++it) {
+          acc += shuffleBits(it.hash());
+        }
+        return unorderedFinish(acc, set.size());
+      }
+
+      case DynamicType::Type::DICT: {
+        // Entries already carry their key hash
+        const DynamicType::Dict &dict = value.dictValue();
+        std::uint64_t acc = 0;
+        for (const DynamicType::Dict::Entry &entry : dict) {
+          acc += shuffleBits(sequenceFinish(sequenceStep(sequenceStep(XXPRIME_5, entry.hash), (*this)(entry.value)), 2));
+        }
+        return unorderedFinish(acc, dict.size());
+      }
+
+      case DynamicType::Type::RANGE: {
+        // Equal ranges produce the same elements: range(0) == range(3, 3), range(1, 2) == range(1, 3, 5)
+        const DynamicType::Range &range = value.rangeValue();
+        std::size_t length = range.size();
+        std::uint64_t acc = sequenceStep(XXPRIME_5, length);
+        if (length == 0) return sequenceFinish(acc, 1);
+        acc = sequenceStep(acc, hashInt(range.start));
+        if (length == 1) return sequenceFinish(acc, 2);
+        return sequenceFinish(sequenceStep(acc, hashInt(range.step)), 3);
+      }
+
+      case DynamicType::Type::VIEW:
+      case DynamicType::Type::GENERATOR:
+        return std::hash<const void *>{}(value.payload.heap);
     }
-    
-    return hashValue;
+    return 0;
   }
 }
 
+#ifndef TRANSPYLER_SYSTEM_ALLOCATOR
+namespace {
 
-int DynamicType::toInt() const {
-  try {
-    if (type == Type::INT) {
-      return std::get<int>(value);
-    } else if (type == Type::DOUBLE) {
-      return static_cast<int>(std::get<double>(value));
-    } else if (type == Type::BOOL) {
-      return std::get<bool>(value) ? 1 : 0;
-    } else if (type == Type::STRING) {
-      return std::stoi(std::get<std::string>(value));
+// Size classes of the heap object pool: 16, 32, ... 128 bytes
+constexpr std::size_t POOL_GRAIN = 16;
+constexpr std::size_t POOL_CLASSES = 8;
+constexpr std::size_t POOL_CHUNK = 64 * 1024;
+
+struct FreeBlock {
+  FreeBlock *next;
+};
+
+thread_local FreeBlock *poolFreeLists[POOL_CLASSES];
+// Unused tail of the chunk new blocks are carved from
+thread_local char *poolCursor = nullptr;
+thread_local char *poolEnd = nullptr;
+
+}  // namespace
+#endif
+
+void *DynamicType::HeapObject::operator new(std::size_t size) {
+  TRANSPYLER_PROFILE_ALLOCATION(size);
+#ifdef TRANSPYLER_SYSTEM_ALLOCATOR
+  return ::operator new(size);
+#else
+  std::size_t index = (size - 1) / POOL_GRAIN;
+  if (index >= POOL_CLASSES) return ::operator new(size);
+  FreeBlock *&head = poolFreeLists[index];
+  if (head != nullptr) {
+    FreeBlock *block = head;
+    head = block->next;
+    return block;
+  }
+  std::size_t bytes = (index + 1) * POOL_GRAIN;
+  if (static_cast<std::size_t>(poolEnd - poolCursor) < bytes) {
+    // operator new aligns for any fundamental type, and blocks are multiples of 16
+    poolCursor = static_cast<char *>(::operator new(POOL_CHUNK));
+    poolEnd = poolCursor + POOL_CHUNK;
+  }
+  void *block = poolCursor;
+  poolCursor += bytes;
+  return block;
+#endif
+}
+
+void DynamicType::HeapObject::operator delete(void *block, [[maybe_unused]] std::size_t size) {
+#ifdef TRANSPYLER_SYSTEM_ALLOCATOR
+  ::operator delete(block);
+#else
+  std::size_t index = (size - 1) / POOL_GRAIN;
+  if (index >= POOL_CLASSES) {
+    ::operator delete(block);
+    return;
+  }
+  FreeBlock *freed = static_cast<FreeBlock *>(block);
+  freed->next = poolFreeLists[index];
+  poolFreeLists[index] = freed;
+#endif
+}
+
+DynamicType::ListObject::ListObject(Items items) {
+  if (!items.empty() && (items.front().type == Type::INT || items.front().type == Type::DOUBLE)) {
+    Type kind = items.front().type;
+    bool homogeneous = std::all_of(items.begin(), items.end(), [kind](const DynamicType &item) { return item.type == kind; });
+    if (homogeneous && kind == Type::INT) {
+      Ints &ints = value.emplace<INTS>();
+      ints.reserve(items.size());
+      for (const DynamicType &item : items) ints.push_back(item.payload.i);
+      return;
+    }
+    if (homogeneous) {
+      Doubles &doubles = value.emplace<DOUBLES>();
+      doubles.reserve(items.size());
+      for (const DynamicType &item : items) doubles.push_back(item.payload.d);
+      return;
     }
-  } catch (const std::bad_variant_access&) {
-    throw std::runtime_error("Stored value has unexpected type");
-  } catch (const std::invalid_argument&) {
-    throw std::runtime_error("Cannot convert string to int (invalid argument)");
-  } catch (const std::out_of_range&) {
-    throw std::runtime_error("Cannot convert string to int (out of range)");
   }
+  value = std::move(items);
+}
 
-  throw std::runtime_error("Cannot convert to int");
+std::size_t DynamicType::ListObject::size() const {
+  return std::visit([](const auto &elements) { return elements.size(); }, value) - head;
 }
 
-double DynamicType::toDouble() const {
-  try {
-    if (type == Type::DOUBLE) {
-      return std::get<double>(value);
-    } else if (type == Type::INT) {
-      return static_cast<double>(std::get<int>(value));
-    } else if (type == Type::BOOL) {
-      return std::get<bool>(value) ? 1.0 : 0.0;
-    } else if (type == Type::STRING) {
-      try {
-        return std::stod(std::get<std::string>(value));
-      } catch (const std::invalid_argument&) {
-        throw std::runtime_error("Cannot convert string to double (invalid argument)");
-      } catch (const std::out_of_range&) {
-        throw std::runtime_error("Cannot convert string to double (out of range)");
+DynamicType DynamicType::ListObject::at(std::size_t index) const {
+  index += head;
+  if (const Ints *ints = std::get_if<INTS>(&value)) return DynamicType((*ints)[index]);
+  if (const Doubles *doubles = std::get_if<DOUBLES>(&value)) return DynamicType((*doubles)[index]);
+  return as<ITEMS>()[index];
+}
+
+DynamicType::ListObject::Items &DynamicType::ListObject::items() {
+  compact();
+  if (value.index() == ITEMS) return as<ITEMS>();
+  // Counted under the element type the list was packed with
+  TRANSPYLER_PROFILE_EVENT(UNPACK, value.index() == INTS ? Type::INT : Type::DOUBLE);
+  Items unpacked;
+  unpacked.reserve(size());
+  std::visit([&unpacked](const auto &elements) {
+    for (const auto &element : elements) unpacked.emplace_back(element);
+  }, value);
+  return value.emplace<ITEMS>(std::move(unpacked));
+}
+
+void DynamicType::ListObject::push(const DynamicType &item) {
+  switch (value.index()) {
+    case INTS:
+      if (item.type == Type::INT) {
+        as<INTS>().push_back(item.payload.i);
+        return;
+      }
+      break;
+    case DOUBLES:
+      if (item.type == Type::DOUBLE) {
+        as<DOUBLES>().push_back(item.payload.d);
+        return;
+      }
+      break;
+    default:
+      // An empty list takes the storage of its first element, keeping a reserve() hint
+      if (as<ITEMS>().empty() && item.type == Type::INT) {
+        std::size_t capacity = as<ITEMS>().capacity();
+        Ints &ints = value.emplace<INTS>();
+        ints.reserve(capacity);
+        ints.push_back(item.payload.i);
+        return;
+      }
+      if (as<ITEMS>().empty() && item.type == Type::DOUBLE) {
+        std::size_t capacity = as<ITEMS>().capacity();
+        Doubles &doubles = value.emplace<DOUBLES>();
+        doubles.reserve(capacity);
+        doubles.push_back(item.payload.d);
+        return;
+      }
+      break;
+  }
+  items().push_back(item);
+}
+
+void DynamicType::ListObject::set(std::size_t index, const DynamicType &item) {
+  if (value.index() == INTS && item.type == Type::INT) {
+    as<INTS>()[head + index] = item.payload.i;
+  } else if (value.index() == DOUBLES && item.type == Type::DOUBLE) {
+    as<DOUBLES>()[head + index] = item.payload.d;
+  } else {
+    element(index) = item;
+  }
+}
+
+DynamicType &DynamicType::ListObject::element(std::size_t index) {
+  if (value.index() != ITEMS) items();
+  return as<ITEMS>()[head + index];
+}
+
+namespace {
+
+// Position of a Python index, which may count from the end, in a sequence of size items
+std::size_t sequenceIndex(const DynamicType &index, std::size_t size, const char *message) {
+  long long position = index.toInt();
+  if (position < 0) position += static_cast<long long>(size);
+  if (position < 0 || static_cast<unsigned long long>(position) >= size) {
+    runtime_fail(message);
+  }
+  return static_cast<std::size_t>(position);
+}
+
+// Open a slot before position `index` of the live elements of a
+// gap-buffered array, moving the elements on the cheaper side
+template <typename Array, typename Element>
+void insertAt(Array &elements, std::size_t &head, std::size_t index, Element element) {
+  std::size_t live = elements.size() - head;
+  if (head == 0 && index < live / 2) {
+    // Out of room at the front: one O(n) move buys the next live / 2 front inserts
+    std::size_t gap = live / 2 + 1;
+    elements.insert(elements.begin(), gap, typename Array::value_type{});
+    head = gap;
+  }
+  auto first = elements.begin() + static_cast<std::ptrdiff_t>(head);
+  if (index < live / 2) {
+    std::move(first, first + static_cast<std::ptrdiff_t>(index), first - 1);
+    --head;
+    elements[head + index] = std::move(element);
+  } else {
+    elements.insert(first + static_cast<std::ptrdiff_t>(index), std::move(element));
+  }
+}
+
+} // namespace
+
+void DynamicType::ListObject::insert(std::size_t index, const DynamicType &item) {
+  if (index == size()) {
+    push(item);
+  } else if (value.index() == INTS && item.type == Type::INT) {
+    insertAt(as<INTS>(), head, index, item.payload.i);
+  } else if (value.index() == DOUBLES && item.type == Type::DOUBLE) {
+    insertAt(as<DOUBLES>(), head, index, item.payload.d);
+  } else {
+    if (value.index() != ITEMS) items();
+    insertAt(as<ITEMS>(), head, index, item);
+  }
+}
+
+void DynamicType::ListObject::erase(std::size_t index) {
+  std::visit([this, index](auto &elements) {
+    auto first = elements.begin() + static_cast<std::ptrdiff_t>(head);
+    if (index + 1 == elements.size() - head) {
+      elements.pop_back();
+    } else if (index < (elements.size() - head) / 2) {
+      // Front half: shift the earlier elements up and widen the gap
+      std::move_backward(first, first + static_cast<std::ptrdiff_t>(index), first + static_cast<std::ptrdiff_t>(index) + 1);
+      // A gap slot must not keep a popped string or collection alive
+      elements[head] = {};
+      ++head;
+    } else {
+      elements.erase(first + static_cast<std::ptrdiff_t>(index));
+    }
+  }, value);
+  // Closing the gap moves fewer elements than were popped to open it
+  if (head > size()) compact();
+}
+
+void DynamicType::ListObject::reserve(std::size_t capacity) {
+  std::visit([this, capacity](auto &elements) { elements.reserve(head + capacity); }, value);
+}
+
+void DynamicType::ListObject::compact() {
+  if (head == 0) return;
+  std::visit([this](auto &elements) { elements.erase(elements.begin(), elements.begin() + static_cast<std::ptrdiff_t>(head)); }, value);
+  head = 0;
+}
+
+DynamicType::ListSpan DynamicType::spanOf(const ListObject &list, long long start, long long step, std::size_t size) {
+  ListSpan span;
+  span.storage = list.value.index();
+  start += static_cast<long long>(list.head);
+  switch (span.storage) {
+    case ListObject::INTS:
+      span.ints = list.as<ListObject::INTS>().data() + start;
+      break;
+    case ListObject::DOUBLES:
+      span.doubles = list.as<ListObject::DOUBLES>().data() + start;
+      break;
+    default:
+      span.items = list.as<ListObject::ITEMS>().data() + start;
+      break;
+  }
+  span.stride = static_cast<std::ptrdiff_t>(step);
+  span.size = size;
+  return span;
+}
+
+void DynamicType::destroy() {
+  switch (type) {
+    case Type::STRING:
+      delete static_cast<StringObject *>(payload.heap);
+      break;
+    case Type::LIST:
+      delete static_cast<ListObject *>(payload.heap);
+      break;
+    case Type::DICT:
+      delete static_cast<DictObject *>(payload.heap);
+      break;
+    case Type::SET:
+      delete static_cast<SetObject *>(payload.heap);
+      break;
+    case Type::RANGE:
+      delete static_cast<RangeObject *>(payload.heap);
+      break;
+    case Type::BIGINT:
+      delete static_cast<BigIntObject *>(payload.heap);
+      break;
+    case Type::SLICE: {
+      SliceObject *slice = static_cast<SliceObject *>(payload.heap);
+      SliceSource *source = slice->source;
+      if (--source->refs == 0) {
+        ListObject *list = source->list;
+        if (list->views == source) list->views = nullptr;
+        if (--list->refs == 0) delete list;
+        delete source;
       }
+      delete slice;
+      break;
+    }
+    case Type::VIEW:
+      delete static_cast<ViewObject *>(payload.heap);
+      break;
+    case Type::GENERATOR: {
+      // Destroys the locals of a generator suspended mid-body
+      GeneratorObject *generator = static_cast<GeneratorObject *>(payload.heap);
+      generator->destroyFrame(generator->frame);
+      delete generator;
+      break;
+    }
+    default:
+      break;
+  }
+}
+
+void DynamicType::detach() {
+  TRANSPYLER_PROFILE_EVENT(DEEP_COPY, type);
+  HeapObject *copy = nullptr;
+  switch (type) {
+    case Type::STRING:
+      copy = new StringObject(strValue());
+      break;
+    case Type::LIST:
+      copy = new ListObject(listObject());
+      break;
+    case Type::DICT:
+      copy = new DictObject(dictValue());
+      break;
+    case Type::SET:
+      copy = new SetObject(setValue());
+      break;
+    default:
+      // Ranges, big ints, views and generators are never written through, so need no private copy
+      return;
+  }
+  release();
+  payload.heap = copy;
+}
+
+void DynamicType::detachViews() {
+  // The views keep the elements as they are now; this list is then written alone
+  TRANSPYLER_PROFILE_EVENT(DEEP_COPY, Type::LIST);
+  ListObject *list = static_cast<ListObject *>(payload.heap);
+  list->views->list = new ListObject(*list);
+  list->views = nullptr;
+  --list->refs;
+}
+
+void DynamicType::materialize() {
+  if (type != Type::SLICE) return;
+  TRANSPYLER_PROFILE_EVENT(DEEP_COPY, Type::SLICE);
+  ListSpan span = listSpan();
+  std::vector<DynamicType> items;
+  items.reserve(span.size);
+  for (std::size_t i = 0; i < span.size; ++i) {
+    items.push_back(span[i]);
+  }
+  *this = DynamicType(std::move(items));
+}
+
+DynamicType DynamicType::sliceOf(long long first, long long step, std::size_t length) const {
+  SliceObject *slice = new SliceObject();
+  if (type == Type::SLICE) {
+    // A slice of a view reads the same elements: compose the strides
+    const SliceObject &outer = sliceValue();
+    slice->source = outer.source;
+    ++slice->source->refs;
+    slice->start = outer.start + first * outer.step;
+    slice->step = outer.step * step;
+  } else {
+    ListObject *list = static_cast<ListObject *>(payload.heap);
+    if (list->views != nullptr) {
+      ++list->views->refs;
+    } else {
+      list->views = new SliceSource();
+      list->views->list = list;
+      ++list->refs;
+    }
+    slice->source = list->views;
+    slice->start = first;
+    slice->step = step;
+  }
+  slice->length = length;
+  // An empty view never reads, and its start may lie outside the elements
+  if (length == 0) slice->start = 0;
+
+  DynamicType result;
+  result.type = Type::SLICE;
+  result.payload.heap = slice;
+  return result;
+}
+
+DynamicType DynamicType::intern(std::string_view text) {
+  // Function-local so it is ready for the static constants of generated code,
+  // whatever the initialization order of translation units. Entries are never
+  // released: the key views point into the strings the table keeps alive.
+  // Those initializers run before main, so no other thread reaches the table.
+  static std::unordered_map<std::string_view, StringObject *> table;
+  auto found = table.find(text);
+  StringObject *object;
+  if (found != table.end()) {
+    object = found->second;
+  } else {
+    object = new StringObject(text);
+    object->hash.store(std::hash<std::string_view>{}(object->value), std::memory_order_relaxed);
+    table.emplace(object->value, object);
+  }
+  DynamicType result;
+  result.type = Type::STRING;
+  result.payload.heap = object;
+  ++object->refs;
+  return result;
+}
+
+DynamicType::DynamicType(Dict val) : type(Type::DICT) {
+  payload.heap = new DictObject(std::move(val));
+}
+
+DynamicType::DynamicType(Set val) : type(Type::SET) {
+  payload.heap = new SetObject(std::move(val));
+}
+
+DynamicType::DynamicType(BigInt val) {
+  if (val.fitsInt64()) {
+    type = Type::INT;
+    payload.i = val.toInt64();
+  } else {
+    type = Type::BIGINT;
+    payload.heap = new BigIntObject(std::move(val));
+  }
+}
+
+BigInt DynamicType::toBigInt() const {
+  if (type == Type::BIGINT) {
+    return bigIntValue();
+  }
+  return BigInt(toInt());
+}
+
+namespace {
+  // String conversions are rare: out of line, so the numeric cases stay small
+  TRANSPYLER_COLD long long parseInt(const std::string &text) {
+    try {
+      return std::stoll(text);
+    } catch (const std::invalid_argument&) {
+      runtime_fail("Cannot convert string to int (invalid argument)");
+    } catch (const std::out_of_range&) {
+      runtime_fail("Cannot convert string to int (out of range)");
+    }
+  }
+
+  TRANSPYLER_COLD double parseDouble(const std::string &text) {
+    try {
+      return std::stod(text);
+    } catch (const std::invalid_argument&) {
+      runtime_fail("Cannot convert string to double (invalid argument)");
+    } catch (const std::out_of_range&) {
+      runtime_fail("Cannot convert string to double (out of range)");
+    }
+  }
+}  // namespace
+
+long long DynamicType::toInt() const {
+  if (type == Type::INT) {
+    return payload.i;
+  } else if (type == Type::DOUBLE) {
+    // The cast is undefined for NaN and for doubles outside [-2**63, 2**63)
+    if (!(payload.d < 9223372036854775808.0 && payload.d >= -9223372036854775808.0)) {
+      runtime_fail("cannot convert float to C long long");
     }
-  } catch (const std::bad_variant_access&) {
-    throw std::runtime_error("Internal error: stored value type differs from enum Type (toDouble)");
+    return static_cast<long long>(payload.d);
+  } else if (type == Type::BOOL) {
+    return payload.b ? 1 : 0;
+  } else if (type == Type::BIGINT) {
+    runtime_fail("Python int too large to convert to C long long");
+  } else if (type == Type::STRING) {
+    return parseInt(strValue());
+  }
+
+  runtime_fail("Cannot convert to int");
+}
+
+double DynamicType::toDouble() const {
+  if (type == Type::DOUBLE) {
+    return payload.d;
+  } else if (type == Type::INT) {
+    return static_cast<double>(payload.i);
+  } else if (type == Type::BIGINT) {
+    return bigIntValue().toDouble();
+  } else if (type == Type::BOOL) {
+    return payload.b ? 1.0 : 0.0;
+  } else if (type == Type::STRING) {
+    return parseDouble(strValue());
+  }
+  runtime_fail("Cannot convert to double");
+}
+
+namespace {
+
+void formatInt(std::string &out, long long value) {
+  char digits[24];
+  char *last = std::to_chars(digits, digits + sizeof(digits), value).ptr;
+  out.append(digits, last);
+}
+
+// Python's float repr: shortest round-trip digits, positional for decimal
+// exponents in [-4, 16) (with a ".0" for whole numbers), scientific otherwise
+void formatDouble(std::string &out, double value) {
+  if (std::isnan(value)) {
+    out += "nan";
+    return;
+  }
+  if (std::isinf(value)) {
+    out += value < 0 ? "-inf" : "inf";
+    return;
+  }
+  char text[32];
+  char *last = std::to_chars(text, text + sizeof(text), value, std::chars_format::scientific).ptr;
+  // text is [-]d[.ddd]e(+|-)XX
+  char *mark = std::find(text, last, 'e');
+  int exponent = 0;
+  std::from_chars(mark + (mark[1] == '+' ? 2 : 1), last, exponent);
+  if (exponent < -4 || exponent >= 16) {
+    out.append(text, last);
+    return;
+  }
+  const char *digits = text;
+  if (*digits == '-') {
+    out += '-';
+    ++digits;
+  }
+  std::string_view significant(digits, static_cast<std::size_t>(mark - digits));
+  std::string packed;
+  packed += significant[0];
+  if (significant.size() > 2) packed.append(significant.substr(2));
+  if (exponent < 0) {
+    out += "0.";
+    out.append(static_cast<std::size_t>(-exponent - 1), '0');
+    out += packed;
+  } else if (packed.size() > static_cast<std::size_t>(exponent) + 1) {
+    out.append(packed, 0, static_cast<std::size_t>(exponent) + 1);
+    out += '.';
+    out.append(packed, static_cast<std::size_t>(exponent) + 1, std::string::npos);
+  } else {
+    out += packed;
+    out.append(static_cast<std::size_t>(exponent) + 1 - packed.size(), '0');
+    out += ".0";
   }
-  throw std::runtime_error("Cannot convert to double");
 }
 
+}  // namespace
+
 std::string DynamicType::toString() const {
-  try {
-    if (type == Type::STRING) {
-      return std::get<std::string>(value);
-    } else if (type == Type::INT) {
-      return std::to_string(std::get<int>(value));
-    } else if (type == Type::DOUBLE) {
-      return std::to_string(std::get<double>(value));
-    } else if (type == Type::BOOL) {
-      return std::get<bool>(value) ? "True" : "False";
-    } else if (type == Type::NONE) {
-      return "None";
-    } else if (type == Type::LIST) {
-      const std::vector<DynamicType> &list = std::get<std::vector<DynamicType>>(value);
-      std::string result = "[";
-      for (size_t i = 0; i < list.size(); ++i) {
-        if (i > 0) result += ", ";
-        result += list[i].toString();
-      }
-      result += "]";
-      return result;
-    } else if (type == Type::DICT) {
-      const std::map<std::string, DynamicType> &dict = std::get<std::map<std::string, DynamicType>>(value);
-      std::string result = "{";
+  if (type == Type::STRING) {
+    TRANSPYLER_PROFILE_EVENT(TO_STRING, type);
+    return strValue();
+  }
+  std::string result;
+  formatTo(result);
+  return result;
+}
+
+void DynamicType::formatTo(std::string &out) const {
+  TRANSPYLER_PROFILE_EVENT(TO_STRING, type);
+  switch (type) {
+    case Type::STRING:
+      out += strValue();
+      break;
+    case Type::INT:
+      formatInt(out, payload.i);
+      break;
+    case Type::BIGINT:
+      out += bigIntValue().toString();
+      break;
+    case Type::DOUBLE:
+      formatDouble(out, payload.d);
+      break;
+    case Type::BOOL:
+      out += payload.b ? "True" : "False";
+      break;
+    case Type::NONE:
+      out += "None";
+      break;
+    case Type::LIST:
+    case Type::SLICE: {
+      ListSpan list = listSpan();
+      out += '[';
+      for (size_t i = 0; i < list.size; ++i) {
+        if (i > 0) out += ", ";
+        list[i].formatTo(out);
+      }
+      out += ']';
+      break;
+    }
+    case Type::DICT: {
+      out += '{';
       bool first = true;
-      for (const std::pair<const std::string, DynamicType> &kv : dict) {
-        if (!first) result += ", ";
-        result += "'" + kv.first + "': " + kv.second.toString();
+      for (const Dict::Entry &entry : dictValue()) {
+        if (!first) out += ", ";
+        if (entry.key.type == Type::STRING) {
+          out += '\'';
+          out += entry.key.strValue();
+          out += '\'';
+        } else {
+          entry.key.formatTo(out);
+        }
+        out += ": ";
+        entry.value.formatTo(out);
         first = false;
       }
-      result += "}";
-      return result;
-    } else if(type == Type::SET) {
-      const std::unordered_set<DynamicType> &set = std::get<std::unordered_set<DynamicType>>(value);
-      std::string result = "{";
+      out += '}';
+      break;
+    }
+    case Type::SET: {
+      out += '{';
       bool first = true;
-      for (const DynamicType &item : set) {
-        if (!first) result += ", ";
-        result += item.toString();
+      for (const DynamicType &item : setValue()) {
+        if (!first) out += ", ";
+        item.formatTo(out);
         first = false;
       }
-      result += "}";
-      return result;
+      out += '}';
+      break;
     }
-
-  } catch (const std::bad_variant_access&) {
-    throw std::runtime_error("Internal error: stored value type differs from enum Type (toString)");
+    case Type::RANGE: {
+      const Range &range = rangeValue();
+      out += "range(";
+      formatInt(out, range.start);
+      out += ", ";
+      formatInt(out, range.stop);
+      if (range.step != 1) {
+        out += ", ";
+        formatInt(out, range.step);
+      }
+      out += ')';
+      break;
+    }
+    case Type::VIEW: {
+      // Keys and values as inside the dict's own repr, pairs as tuples
+      const ViewObject &view = viewValue();
+      out += viewName();
+      out += "([";
+      bool first = true;
+      for (const Dict::Entry &entry : view.dict.dictValue()) {
+        if (!first) out += ", ";
+        if (view.kind == ViewKind::ITEMS) out += '(';
+        if (view.kind != ViewKind::VALUES) {
+          if (entry.key.type == Type::STRING) {
+            out += '\'';
+            out += entry.key.strValue();
+            out += '\'';
+          } else {
+            entry.key.formatTo(out);
+          }
+        }
+        if (view.kind == ViewKind::ITEMS) out += ", ";
+        if (view.kind != ViewKind::KEYS) entry.value.formatTo(out);
+        if (view.kind == ViewKind::ITEMS) out += ')';
+        first = false;
+      }
+      out += "])";
+      break;
+    }
+    case Type::GENERATOR:
+      out += "<generator object>";
+      break;
   }
-  return "Unknown";
 }
 
 bool DynamicType::toBool() const {
-  try {
-    if (type == Type::BOOL) {
-      return std::get<bool>(value);
-    } else if (type == Type::NONE) {
-      return false;
-    } else if (type == Type::INT) {
-      return std::get<int>(value) != 0;
-    } else if (type == Type::DOUBLE) {
-      return std::get<double>(value) != 0.0;
-    } else if (type == Type::STRING) {
-      return !std::get<std::string>(value).empty();
-    } else if (type == Type::LIST) {
-      return !std::get<std::vector<DynamicType>>(value).empty();
-    } else if (type == Type::DICT) {
-      return !std::get<std::map<std::string, DynamicType>>(value).empty();
-    } else if (type == Type::SET) {
-      return !std::get<std::unordered_set<DynamicType>>(value).empty();
-    }
-  } catch (const std::bad_variant_access&) {
-    throw std::runtime_error("Internal error: stored value type differs from enum Type (toBool)");
+  if (type == Type::BOOL) {
+    return payload.b;
+  } else if (type == Type::NONE) {
+    return false;
+  } else if (type == Type::INT) {
+    return payload.i != 0;
+  } else if (type == Type::BIGINT) {
+    return !bigIntValue().isZero();
+  } else if (type == Type::DOUBLE) {
+    return payload.d != 0.0;
+  } else if (type == Type::STRING) {
+    return !strValue().empty();
+  } else if (type == Type::LIST || type == Type::SLICE) {
+    return listSpan().size > 0;
+  } else if (type == Type::DICT) {
+    return !dictValue().empty();
+  } else if (type == Type::SET) {
+    return !setValue().empty();
+  } else if (type == Type::RANGE) {
+    return rangeValue().size() > 0;
+  } else if (type == Type::VIEW) {
+    return !viewValue().dict.dictValue().empty();
+  } else if (type == Type::GENERATOR) {
+    return true;
   }
   return false;
 }
 
-DynamicType DynamicType::operator+(const DynamicType &other) const {
+DynamicType DynamicType::addSlow(const DynamicType &other) const {
   // Concats
-  if (type == Type::LIST && other.type == Type::LIST) {
-    std::vector<DynamicType> left = std::get<std::vector<DynamicType>>(value);
-    std::vector<DynamicType> right = std::get<std::vector<DynamicType>>(other.value);
-    
-    std::vector<DynamicType> result = left;
-    result.insert(result.end(), right.begin(), right.end());
-    
-    return DynamicType(result);
+  if (isList() && other.isList()) {
+    ListSpan left = listSpan();
+    ListSpan right = other.listSpan();
+
+    DynamicType result(std::vector<DynamicType>{});
+    ListObject &list = result.listObject();
+    for (std::size_t i = 0; i < left.size; ++i) list.push(left[i]);
+    for (std::size_t i = 0; i < right.size; ++i) list.push(right[i]);
+    return result;
   }
 
   if (type == Type::STRING || other.type == Type::STRING) {
-    return DynamicType(toString() + other.toString());
+    // One buffer of the final size, filled without temporary strings
+    std::string result;
+    if (type == Type::STRING && other.type == Type::STRING) result.reserve(strValue().size() + other.strValue().size());
+    formatTo(result);
+    other.formatTo(result);
+    return DynamicType(std::move(result));
   }
   // Numeric addition
   if (type == Type::DOUBLE || other.type == Type::DOUBLE) {
     return DynamicType(toDouble() + other.toDouble());
   }
-  if (type == Type::INT && other.type == Type::INT) {
-    return DynamicType(toInt() + other.toInt());
+  if (isIntegral() && other.isIntegral()) {
+    return DynamicType(toBigInt() + other.toBigInt());
+  }
+  runtime_fail("Unsupported operand types for +");
+}
+
+DynamicType DynamicType::operator+(const DynamicType &other) && {
+  // Reusing the buffer is only invisible when this handle is its sole owner
+  bool unique = isHeap() && payload.heap->refs == 1 && !(other.isHeap() && other.payload.heap == payload.heap);
+  // The fallback below is counted by operator+ itself
+  if (unique) TRANSPYLER_PROFILE_OP(ADD, type, other.type);
+  if (unique && type == Type::LIST && other.isList()) {
+    extend(other);
+    return std::move(*this);
+  }
+  if (unique && type == Type::STRING) {
+    other.formatTo(mutableString());
+    return std::move(*this);
+  }
+  return static_cast<const DynamicType &>(*this) + other;
+}
+
+DynamicType &DynamicType::operator+=(const DynamicType &other) {
+  TRANSPYLER_PROFILE_OP(INPLACE_ADD, type, other.type);
+  materialize();
+  if (type == Type::LIST) {
+    extend(other);
+    return *this;
+  }
+  if (type == Type::STRING && payload.heap->refs == 1) {
+    other.formatTo(mutableString());
+    return *this;
   }
-  throw std::runtime_error("Unsupported operand types for +");
+  *this = *this + other;
+  return *this;
 }
 
-DynamicType DynamicType::operator-(const DynamicType &other) const {
+DynamicType DynamicType::subSlow(const DynamicType &other) const {
+  if (type == Type::SET && other.type == Type::SET) {
+    return DynamicType(setValue().difference(other.setValue()));
+  }
   if (type == Type::DOUBLE || other.type == Type::DOUBLE) {
     return DynamicType(toDouble() - other.toDouble());
   }
-  if (type == Type::INT && other.type == Type::INT) {
-    return DynamicType(toInt() - other.toInt());
+  if (isIntegral() && other.isIntegral()) {
+    return DynamicType(toBigInt() - other.toBigInt());
   }
-  throw std::runtime_error("Unsupported operand types for -");
+  runtime_fail("Unsupported operand types for -");
 }
 
 
-DynamicType DynamicType::operator*(const DynamicType &other) const {
-  // String repetition
-  if (type == Type::STRING && other.isNumeric()) {
+namespace {
+  // text repeated count times, in one allocation: the copies double in place
+  std::string repeatString(const std::string &text, long long count) {
     std::string result;
-    int count = other.toInt();
-    for (int i = 0; i < count; ++i)
-    {
-      result += std::get<std::string>(value);
+    if (count <= 0 || text.empty()) return result;
+    if (static_cast<unsigned long long>(count) > result.max_size() / text.size()) {
+      runtime_fail("Repeated string is too long");
     }
-    return DynamicType(result);
+    std::size_t total = text.size() * static_cast<std::size_t>(count);
+    result.reserve(total);
+    result += text;
+    while (result.size() * 2 <= total) result.append(result.data(), result.size());
+    result.append(result.data(), total - result.size());
+    return result;
+  }
+}
+
+DynamicType DynamicType::mulSlow(const DynamicType &other) const {
+  // String repetition, either way round: "-" * 20, 3 * "ab"
+  if (type == Type::STRING && other.isNumeric()) {
+    return DynamicType(repeatString(strValue(), other.toInt()));
+  }
+  if (other.type == Type::STRING && isNumeric()) {
+    return DynamicType(repeatString(other.strValue(), toInt()));
   }
 
   // Numeric multiplication
   if (type == Type::DOUBLE || other.type == Type::DOUBLE) {
     return DynamicType(toDouble() * other.toDouble());
   }
+  if (isIntegral() || other.isIntegral()) {
+    return DynamicType(toBigInt() * other.toBigInt());
+  }
   return DynamicType(toInt() * other.toInt());
 }
 
-DynamicType DynamicType::operator/(const DynamicType &other) const {
+DynamicType DynamicType::divSlow(const DynamicType &other) const {
   double divisor = other.toDouble();
   if (divisor == 0.0) {
-    throw std::runtime_error("Division by zero");
+    runtime_fail("Division by zero");
   }
   return DynamicType(toDouble() / divisor);
 }
 
-DynamicType DynamicType::operator%(const DynamicType &other) const {
-  int divisor = other.toInt();
-  if (divisor == 0) {
-    throw std::runtime_error("Modulo by zero");
+DynamicType DynamicType::modSlow(const DynamicType &other) const {
+  if (type == Type::DOUBLE || other.type == Type::DOUBLE) {
+    return DynamicType(py_mod(toDouble(), other.toDouble()));
+  }
+  if (type == Type::BIGINT || other.type == Type::BIGINT) {
+    if (!other.toBool()) {
+      runtime_fail("Modulo by zero");
+    }
+    BigInt quotient, remainder;
+    BigInt::divMod(toBigInt(), other.toBigInt(), quotient, remainder);
+    return DynamicType(std::move(remainder));
   }
-  return DynamicType(toInt() % divisor);
+  return DynamicType(py_mod(toInt(), other.toInt()));
 }
 
 DynamicType DynamicType::pow(const DynamicType &exponent) const {
-  return DynamicType(std::pow(toDouble(), exponent.toDouble()));
+  TRANSPYLER_PROFILE_OP(POW, type, exponent.type);
+  // Python example: 2 ** 100 is an exact int; a negative exponent gives a float
+  bool integralBase = isIntegral() || type == Type::BOOL;
+  bool integralExponent = exponent.type == Type::INT || exponent.type == Type::BOOL;
+  if (!integralBase || !integralExponent || exponent.toInt() < 0) {
+    return DynamicType(std::pow(toDouble(), exponent.toDouble()));
+  }
+
+  unsigned long long power = static_cast<unsigned long long>(exponent.toInt());
+  if (type != Type::BIGINT) {
+    // Square-and-multiply on native ints until a step overflows
+    long long base = toInt();
+    long long result = 1;
+    unsigned long long remaining = power;
+    bool overflow = false;
+    while (remaining != 0 && !overflow) {
+      if (remaining & 1) overflow = mul_overflow(result, base, result);
+      remaining >>= 1;
+      if (remaining != 0 && !overflow) overflow = mul_overflow(base, base, base);
+    }
+    if (!overflow) {
+      return DynamicType(result);
+    }
+  }
+  return DynamicType(toBigInt().pow(power));
+}
+
+DynamicType DynamicType::floorDivSlow(const DynamicType &other) const {
+  if (type == Type::DOUBLE || other.type == Type::DOUBLE) {
+    return DynamicType(py_floordiv(toDouble(), other.toDouble()));
+  }
+  if (isIntegral() || other.isIntegral()) {
+    // Big ints, and LLONG_MIN // -1 from the inline path
+    BigInt quotient, remainder;
+    BigInt::divMod(toBigInt(), other.toBigInt(), quotient, remainder);
+    return DynamicType(std::move(quotient));
+  }
+  return DynamicType(py_floordiv(toInt(), other.toInt()));
+}
+
+namespace {
+  // Bitwise int operators: bool with bool stays a bool, as in Python
+  template <typename Op>
+  DynamicType bitwise(const DynamicType &lhs, const DynamicType &rhs, Op op, const char *error) {
+    if (!(lhs.isInt() || lhs.isBool()) || !(rhs.isInt() || rhs.isBool())) runtime_fail(error);
+    long long result = op(lhs.toInt(), rhs.toInt());
+    if (lhs.isBool() && rhs.isBool()) return DynamicType(result != 0);
+    return DynamicType(result);
+  }
+}
+
+DynamicType DynamicType::operator|(const DynamicType &other) const {
+  if (type == Type::SET && other.type == Type::SET) {
+    return DynamicType(setValue().unionWith(other.setValue()));
+  }
+  return bitwise(*this, other, std::bit_or<long long>(), "Unsupported operand types for |");
+}
+
+DynamicType DynamicType::operator&(const DynamicType &other) const {
+  if (type == Type::SET && other.type == Type::SET) {
+    return DynamicType(setValue().intersection(other.setValue()));
+  }
+  return bitwise(*this, other, std::bit_and<long long>(), "Unsupported operand types for &");
 }
 
-DynamicType DynamicType::floor_div(const DynamicType &other) const {
-  int divisor = other.toInt();
-  if (divisor == 0) {
-    throw std::runtime_error("Floor division by zero");
+DynamicType DynamicType::operator^(const DynamicType &other) const {
+  if (type == Type::SET && other.type == Type::SET) {
+    return DynamicType(setValue().symmetricDifference(other.setValue()));
   }
-  return DynamicType(toInt() / divisor);
+  return bitwise(*this, other, std::bit_xor<long long>(), "Unsupported operand types for ^");
+}
+
+int DynamicType::compareWithDouble(double d) const {
+  if (type != Type::BIGINT) return compare_int_double(toInt(), d);
+  if (std::isinf(d)) return d > 0 ? -1 : 1;
+  int order = bigIntValue().compare(BigInt::fromDouble(d));
+  if (order != 0) return (order > 0) - (order < 0);
+  double fraction = d - std::trunc(d);
+  return (fraction < 0) - (fraction > 0);
 }
 
-bool DynamicType::operator==(const DynamicType &other) const {
+bool DynamicType::equalsSlow(const DynamicType &other) const {
+    if (isList() && other.isList()) {
+      ListSpan list1 = listSpan();
+      ListSpan list2 = other.listSpan();
+      if (list1.size != list2.size) return false;
+      for (std::size_t i = 0; i < list1.size; ++i) {
+        if (list1[i] != list2[i]) return false;
+      }
+      return true;
+    }
     if (type != other.type) {
-      return false;
+      // Across numeric kinds values compare, as in Python: True == 1 == 1.0
+      if (!isNumberLike() || !other.isNumberLike()) {
+        return false;
+      }
+      if (type == Type::DOUBLE || other.type == Type::DOUBLE) {
+        const DynamicType &number = type == Type::DOUBLE ? other : *this;
+        double d = type == Type::DOUBLE ? payload.d : other.payload.d;
+        return !std::isnan(d) && number.compareWithDouble(d) == 0;
+      }
+      // A BIGINT never fits in 64 bits, so it cannot equal an int or a bool
+      return type != Type::BIGINT && other.type != Type::BIGINT && toInt() == other.toInt();
     }
     switch (type) {
       case Type::NONE:
@@ -257,67 +1102,88 @@ bool DynamicType::operator==(const DynamicType &other) const {
       case Type::DOUBLE:
         return toDouble() == other.toDouble();
       case Type::STRING:
-        return toString() == other.toString();
+        return strValue() == other.strValue();
       case Type::BOOL:
         return toBool() == other.toBool();
-      case Type::LIST: {
-        const std::vector<DynamicType> &list1 = std::get<std::vector<DynamicType>>(value);
-        const std::vector<DynamicType> &list2 = std::get<std::vector<DynamicType>>(other.value);
-        return list1 == list2;
-      }
+      case Type::BIGINT:
+        return bigIntValue().compare(other.bigIntValue()) == 0;
       case Type::DICT: {
-        const std::map<std::string, DynamicType> &dict1 = std::get<std::map<std::string, DynamicType>>(value);
-        const std::map<std::string, DynamicType> &dict2 = std::get<std::map<std::string, DynamicType>>(other.value);
-        return dict1 == dict2;
+        return dictValue() == other.dictValue();
       }
       case Type::SET: {
-        const std::unordered_set<DynamicType> &set1 = std::get<std::unordered_set<DynamicType>>(value);
-        const std::unordered_set<DynamicType> &set2 = std::get<std::unordered_set<DynamicType>>(other.value);
-        return set1 == set2;
+        return setValue() == other.setValue();
+      }
+      case Type::RANGE: {
+        // Ranges compare as the sequences they produce: range(0) == range(3, 3)
+        const Range &range1 = rangeValue();
+        const Range &range2 = other.rangeValue();
+        std::size_t length = range1.size();
+        if (length != range2.size()) return false;
+        if (length == 0) return true;
+        if (range1.start != range2.start) return false;
+        return length == 1 || range1.step == range2.step;
       }
+      case Type::VIEW:
+      case Type::GENERATOR:
+        return payload.heap == other.payload.heap;
       default:
         return false;
     }
 }
 
-bool DynamicType::operator!=(const DynamicType &other) const {
-  return !(*this == other);
-}
-
-bool DynamicType::operator<(const DynamicType &other) const {
-  // First compare by type (for mixed type sets)
-  if (type != other.type) {
-    return static_cast<int>(type) < static_cast<int>(other.type);
-  }
-  
-  // Same types - compare values
-  if (isNumeric() && other.isNumeric()) {
-    return toDouble() < other.toDouble();
-  }
-  if (type == Type::STRING && other.type == Type::STRING) {
-    return toString() < other.toString();
-  }
-  if (type == Type::BOOL && other.type == Type::BOOL) {
-    return toBool() < other.toBool();
-  }
-  if (type == Type::NONE && other.type == Type::NONE) {
-    return false;  // None == None
+int DynamicType::compareSlow(const DynamicType &other) const {
+  // Numbers compare by value across kinds (bools and big ints included)
+  if (isNumberLike() && other.isNumberLike() && !(type == Type::BOOL && other.type == Type::BOOL)) {
+    if (type == Type::DOUBLE && other.type == Type::DOUBLE) {
+      return (payload.d > other.payload.d) - (payload.d < other.payload.d);
+    }
+    if (type == Type::DOUBLE || other.type == Type::DOUBLE) {
+      // NaN is unordered; compare() reports it as equivalent
+      if (type == Type::DOUBLE) return std::isnan(payload.d) ? 0 : -other.compareWithDouble(payload.d);
+      return std::isnan(other.payload.d) ? 0 : compareWithDouble(other.payload.d);
+    }
+    if (type == Type::BIGINT || other.type == Type::BIGINT) {
+      int order = toBigInt().compare(other.toBigInt());
+      return (order > 0) - (order < 0);
+    }
+    long long lhs = toInt();
+    long long rhs = other.toInt();
+    return (lhs > rhs) - (lhs < rhs);
   }
-  
-  // For complex types, compare string representations as fallback
-  return toString() < other.toString();
-}
 
-bool DynamicType::operator<=(const DynamicType &other) const {
-  return *this < other || *this == other;
-}
+  if (isList() && other.isList()) {
+    // Lexicographic, like Python: [1, 2] < [1, 3] < [2]
+    ListSpan list1 = listSpan();
+    ListSpan list2 = other.listSpan();
+    std::size_t common = std::min(list1.size, list2.size);
+    for (std::size_t i = 0; i < common; ++i) {
+      int order = list1[i].compare(list2[i]);
+      if (order != 0) return order;
+    }
+    return (list1.size > list2.size) - (list1.size < list2.size);
+  }
 
-bool DynamicType::operator>(const DynamicType &other) const {
-  return !(*this <= other);
-}
+  // Int/double pairs are handled inline; other mixed types are ordered by type (for mixed type sets)
+  if (type != other.type) {
+    return static_cast<int>(type) < static_cast<int>(other.type) ? -1 : 1;
+  }
 
-bool DynamicType::operator>=(const DynamicType &other) const {
-  return !(*this < other);
+  switch (type) {
+    case Type::NONE:
+      return 0;
+    case Type::BOOL:
+      return static_cast<int>(payload.b) - static_cast<int>(other.payload.b);
+    case Type::STRING: {
+      int order = strValue().compare(other.strValue());
+      return (order > 0) - (order < 0);
+    }
+    default: {
+      // For other complex types, compare string representations as fallback
+      if (*this == other) return 0;
+      int order = toString().compare(other.toString());
+      return (order > 0) - (order < 0);
+    }
+  }
 }
 
 DynamicType DynamicType::operator&&(const DynamicType &other) const {
@@ -333,306 +1199,2157 @@ DynamicType DynamicType::operator!() const {
 }
 
 DynamicType DynamicType::operator-() const {
+  TRANSPYLER_PROFILE_OP(NEG, type, Type::NONE);
   if (type == Type::INT){
-    return DynamicType(-toInt());
+    // -LLONG_MIN does not fit in 64 bits
+    if (payload.i == LLONG_MIN) return DynamicType(-BigInt(payload.i));
+    return DynamicType(-payload.i);
+  }
+  if (type == Type::BIGINT){
+    return DynamicType(-bigIntValue());
   }
   if (type == Type::DOUBLE){
     return DynamicType(-toDouble());
   }
-  throw std::runtime_error("Unsupported operand type for unary -");
+  runtime_fail("Unsupported operand type for unary -");
 }
 
 DynamicType DynamicType::operator+() const {
   if (isNumeric()) {
     return *this;
   }
-  throw std::runtime_error("Unsupported operand type for unary +");
+  runtime_fail("Unsupported operand type for unary +");
 }
 
 DynamicType &DynamicType::operator[](const size_t index) {
-  if(type != Type::LIST){
-    throw std::runtime_error("Type is not a list");
-  }
-  try{
-    std::vector<DynamicType> &list = std::get<std::vector<DynamicType>>(value);
-    return list.at(index);
-  } catch (const std::bad_variant_access&) {
-    throw std::runtime_error("Stored value is not an enum Type (operator[])");
-  }
+  materialize();
+  TRANSPYLER_EXPECT_TYPE(type == Type::LIST, "Type is not a list");
+  prepareWrite();
+  ListObject &list = listObject();
+  if (index >= list.size()) {
+    runtime_fail("List index out of range");
+  }
+  return list.element(index);
 }
 
 DynamicType &DynamicType::operator[](const std::string &key) {
-  if(type != Type::DICT){
-    throw std::runtime_error("Type is not a dict");
-  }
-  try {
-    std::map<std::string, DynamicType> &dict = std::get<std::map<std::string, DynamicType>>(value);
-    return dict[key];
-  } catch (const std::bad_variant_access&) {
-    throw std::runtime_error("Stored value is not an enum Type (operator[])");
-  }
+  TRANSPYLER_EXPECT_TYPE(type == Type::DICT, "Type is not a dict");
+  prepareWrite();
+  return dictValue()[std::string_view(key)];
 }
 
 DynamicType &DynamicType::operator[](const DynamicType &key) {
+  if (type == Type::DICT) {
+    prepareWrite();
+    return dictValue()[key];
+  }
   // If the key is numeric, treat as list index
   if (key.type == Type::INT) {
-    return (*this)[static_cast<size_t>(key.toInt())];
+    // A negative index counts from the end; materialize first so size() is the list's
+    materialize();
+    TRANSPYLER_EXPECT_TYPE(type == Type::LIST, "Type is not a list");
+    return (*this)[sequenceIndex(key, listObject().size(), "List index out of range")];
   }
-  // If the key is string or can be converted to string, treat as dict key
+  // Otherwise report the error of the string-key overload
   else {
     return (*this)[key.toString()];
   }
 }
 
-
-std::vector<DynamicType>& DynamicType::getList() {
-  if(type != Type::LIST){
-    throw std::runtime_error("Type is not a list");
+DynamicType DynamicType::getItem(const DynamicType &key) const {
+  if (type == Type::DICT) {
+    const DynamicType *value = dictValue().find(key);
+    if (value == nullptr) {
+      runtime_fail("Key not found in dictionary");
+    }
+    return *value;
   }
-  try{
-    return std::get<std::vector<DynamicType>>(value);
-  } catch (const std::bad_variant_access&) {
-    throw std::runtime_error("Stored value is not an enum Type (getList)");
+  if (type == Type::LIST) {
+    const ListObject &list = listObject();
+    return list.at(sequenceIndex(key, list.size(), "Index out of range"));
   }
+  TRANSPYLER_EXPECT_TYPE(isList() || type == Type::RANGE || type == Type::STRING, "Type is not subscriptable");
+  return itemAt(sequenceIndex(key, size(), "Index out of range"));
 }
 
-const std::vector<DynamicType>& DynamicType::getList() const {
-  if(type != Type::LIST){
-    throw std::runtime_error("Type is not a list");
-  }
-  try{
-    return std::get<std::vector<DynamicType>>(value);
-  } catch (const std::bad_variant_access&) {
-    throw std::runtime_error("Stored value is not an enum Type (getList const)");
-  }
+void DynamicType::setItem(const DynamicType &key, const DynamicType &value) {
+  if (type == Type::DICT) {
+    prepareWrite();
+    dictValue()[key] = value;
+    return;
+  }
+  materialize();
+  TRANSPYLER_EXPECT_TYPE(type == Type::LIST, "Type does not support item assignment");
+  std::size_t index = sequenceIndex(key, listObject().size(), "List index out of range");
+  prepareWrite();
+  listObject().set(index, value);
 }
 
-std::map<std::string, DynamicType>& DynamicType::getDict() {
-  if(type != Type::DICT){
-    throw std::runtime_error("Type is not a dict");
-  }
-  try{
-    return std::get<std::map<std::string, DynamicType>>(value);
-  } catch (const std::bad_variant_access&) {
-    throw std::runtime_error("Stored value is not an enum Type (getDict)");
+void DynamicType::addToItem(const DynamicType &key, const DynamicType &value) {
+  materialize();
+  if (type == Type::LIST && listObject().value.index() != ListObject::ITEMS) {
+    setItem(key, getItem(key) + value);
+    return;
   }
+  (*this)[key] += value;
 }
 
-const std::map<std::string, DynamicType>& DynamicType::getDict() const {
-  if(type != Type::DICT) {
-    throw std::runtime_error("Type is not a dict");
-  }
-  try{
-    return std::get<std::map<std::string, DynamicType>>(value);
-  } catch (const std::bad_variant_access&) {
-    throw std::runtime_error("Stored value is not an enum Type (getDict const)");
-  }
-}
+#ifdef TRANSPYLER_PARALLEL
+namespace {
+  /**
+   * Work-stealing pool behind DynamicType::parallelFor(). Its workers start
+   * with the first parallel loop and wait for the next one between loops, so
+   * a loop costs one wake-up instead of a thread per chunk. A loop deals
+   * [0, count) out as one contiguous share per thread; each thread takes
+   * grain-sized pieces off the front of its own share and, once that runs
+   * dry, steals the back half of another thread's, which keeps every core
+   * busy until the last piece even when pieces cost very different times.
+   *
+   * Heap objects keep coming from each thread's own pool free lists; an
+   * object freed by another thread than the one that allocated it moves to
+   * the free lists of the thread that freed it.
+   */
+  class WorkPool {
+    public:
+      using Body = void (*)(void *context, std::size_t begin, std::size_t end);
 
-std::unordered_set<DynamicType>& DynamicType::getSet() {
-  if(type != Type::SET) {
-    throw std::runtime_error("Type is not a set");
-  }
-  try{
-    return std::get<std::unordered_set<DynamicType>>(value);
-  } catch (const std::bad_variant_access&) {
-    throw std::runtime_error("Stored value is not a set (getSet)");
-  }
-}
+      static WorkPool &instance() {
+        static WorkPool pool;
+        return pool;
+      }
 
-const std::unordered_set<DynamicType>& DynamicType::getSet() const {
-  if(type != Type::SET) {
-    throw std::runtime_error("Type is not a set");
-  }
-  try{
-    return std::get<std::unordered_set<DynamicType>>(value);
-  } catch (const std::bad_variant_access&) {
-    throw std::runtime_error("Stored value is not a set (getSet const)");
-  }
-}
+      std::size_t threads() const { return shares; }
 
-DynamicType DynamicType::sublist(size_t start, size_t end) {
-  if(type != Type::LIST) {
-    throw std::runtime_error("Type is not a list");
-  }
-  
-  std::vector<DynamicType>& list = getList();
-  if(start > list.size() || end > list.size() || start > end) {
-    throw std::runtime_error("Sublist indices out of range");
-  }
-  
-  std::vector<DynamicType> newList;
-  for(size_t i = start; i < end; ++i) {
-    newList.push_back(list[i]);
-  }
-  
-  return DynamicType(newList);
-}
+      // active is raised for the duration of a loop on the workers (see DynamicType::RefCount)
+      void run(std::size_t count, std::size_t grain, void *context, Body body, std::atomic<bool> &active) {
+        // One loop at a time: a nested loop, or one started while another
+        // thread's loop runs, runs on its own thread
+        std::unique_lock<std::mutex> exclusive(submit, std::try_to_lock);
+        if (insideLoop || shares == 1 || !exclusive.owns_lock()) {
+          body(context, 0, count);
+          return;
+        }
+        for (std::size_t share = 0; share < shares; ++share) {
+          std::lock_guard<std::mutex> guard(ranges[share].lock);
+          ranges[share].begin = count * share / shares;
+          ranges[share].end = count * (share + 1) / shares;
+        }
+        active.store(true, std::memory_order_relaxed);
+        {
+          std::lock_guard<std::mutex> guard(mutex);
+          loop = Loop{body, context, grain};
+          failure = nullptr;
+          failed.store(false, std::memory_order_relaxed);
+          pending = shares - 1;
+          ++generation;
+        }
+        if (workers.empty()) start();
+        wake.notify_all();
 
-DynamicType DynamicType::sublist(size_t start, size_t end, size_t step) {
-  if(type != Type::LIST) {
-    throw std::runtime_error("Type is not a list");
-  }
-  
-  if(step == 0) {
-    throw std::runtime_error("Step cannot be zero");
+        insideLoop = true;
+        work(0);
+        insideLoop = false;
+
+        std::unique_lock<std::mutex> lock(mutex);
+        finished.wait(lock, [this] { return pending == 0; });
+        active.store(false, std::memory_order_relaxed);
+        if (failure) std::rethrow_exception(failure);
+      }
+
+      ~WorkPool() {
+        {
+          std::lock_guard<std::mutex> guard(mutex);
+          stopping = true;
+        }
+        wake.notify_all();
+        for (std::thread &worker : workers) worker.join();
+      }
+
+    private:
+      // What is left of one thread's share, on its own cache line
+      struct alignas(64) Range {
+        std::mutex lock;
+        std::size_t begin = 0;
+        std::size_t end = 0;
+      };
+      struct Loop {
+        Body body = nullptr;
+        void *context = nullptr;
+        std::size_t grain = 1;
+      };
+
+      WorkPool() : shares(configuredThreads()), ranges(new Range[shares]) {}
+
+      static std::size_t configuredThreads() {
+        if (const char *setting = std::getenv("TRANSPYLER_THREADS")) {
+          long threads = std::strtol(setting, nullptr, 10);
+          if (threads > 0) return static_cast<std::size_t>(threads);
+        }
+        return std::max<unsigned>(1, std::thread::hardware_concurrency());
+      }
+
+      void start() {
+        for (std::size_t share = 1; share < shares; ++share) {
+          workers.emplace_back([this, share] { serve(share); });
+        }
+      }
+
+      // Worker loop: run a share of every loop until the pool is destroyed
+      void serve(std::size_t self) {
+        insideLoop = true;
+        std::size_t seen = 0;
+        while (true) {
+          {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [&] { return stopping || generation != seen; });
+            if (stopping) return;
+            seen = generation;
+          }
+          work(self);
+          std::lock_guard<std::mutex> guard(mutex);
+          if (--pending == 0) finished.notify_one();
+        }
+      }
+
+      // Run pieces until none is left anywhere or one has thrown
+      void work(std::size_t self) {
+        std::size_t begin, end;
+        while (!failed.load(std::memory_order_relaxed) && take(self, begin, end)) {
+          try {
+            loop.body(loop.context, begin, end);
+          } catch (...) {
+            std::lock_guard<std::mutex> guard(mutex);
+            if (!failure) failure = std::current_exception();
+            failed.store(true, std::memory_order_relaxed);
+          }
+        }
+      }
+
+      // Next piece for thread self: the front of its own share, else stolen
+      bool take(std::size_t self, std::size_t &begin, std::size_t &end) {
+        Range &own = ranges[self];
+        {
+          std::lock_guard<std::mutex> guard(own.lock);
+          if (own.begin < own.end) {
+            begin = own.begin;
+            end = std::min(own.end, begin + loop.grain);
+            own.begin = end;
+            return true;
+          }
+        }
+        for (std::size_t step = 1; step < shares; ++step) {
+          Range &victim = ranges[(self + step) % shares];
+          std::size_t stolenEnd;
+          {
+            std::lock_guard<std::mutex> guard(victim.lock);
+            std::size_t left = victim.end - victim.begin;
+            if (left == 0) continue;
+            std::size_t taken = left > loop.grain ? left / 2 : left;
+            stolenEnd = victim.end;
+            victim.end -= taken;
+            begin = victim.end;
+          }
+          end = std::min(stolenEnd, begin + loop.grain);
+          std::lock_guard<std::mutex> guard(own.lock);
+          own.begin = end;
+          own.end = stolenEnd;
+          return true;
+        }
+        return false;
+      }
+
+      const std::size_t shares;
+      std::unique_ptr<Range[]> ranges;
+      std::vector<std::thread> workers;
+      std::mutex submit;
+
+      // Guards the fields below; wake starts a loop, finished ends it
+      std::mutex mutex;
+      std::condition_variable wake;
+      std::condition_variable finished;
+      Loop loop;
+      std::size_t generation = 0;
+      std::size_t pending = 0;
+      bool stopping = false;
+      std::exception_ptr failure;
+      std::atomic<bool> failed{false};
+
+      // Loops started from a pool thread, or from inside a piece, run inline
+      inline static thread_local bool insideLoop = false;
+  };
+}  // namespace
+
+void DynamicType::parallelRun(std::size_t count, std::size_t grain, void *context,
+                              void (*body)(void *context, std::size_t begin, std::size_t end)) {
+  grain = std::max<std::size_t>(1, grain);
+  // Small loops, like the one-chunk loops of short lists, never reach the pool
+  if (count <= grain) {
+    if (count != 0) body(context, 0, count);
+    return;
+  }
+  WorkPool::instance().run(count, grain, context, body, parallelActive);
+}
+
+std::size_t DynamicType::parallelThreads() {
+  return WorkPool::instance().threads();
+}
+#else
+void DynamicType::parallelRun(std::size_t count, std::size_t grain, void *context,
+                              void (*body)(void *context, std::size_t begin, std::size_t end)) {
+  (void)grain;
+  if (count != 0) body(context, 0, count);
+}
+
+std::size_t DynamicType::parallelThreads() {
+  return 1;
+}
+#endif
+
+/*
+ * Bulk kernels over the contiguous arrays of packed lists. Where 64-bit lane
+ * compares are native (AVX2, enabled by -mavx2 or -march=native, and AArch64
+ * NEON) they run on four lanes through GCC/Clang vector extensions; other
+ * targets, where the compiler would emulate those compares, get the scalar
+ * loops. Built with TRANSPYLER_PARALLEL, reductions and sorts of at least
+ * PARALLEL_THRESHOLD elements are also split across hardware threads.
+ *
+ * Float sums and float min/max stay sequential scalar loops: reordering them
+ * would change rounding, NaN and signed zero results from Python's.
+ */
+namespace {
+  constexpr std::size_t LANES = 4;
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__AVX2__) || defined(__aarch64__))
+#define TRANSPYLER_VECTOR_KERNELS
+  typedef long long IntLanes __attribute__((vector_size(LANES * sizeof(long long))));
+  typedef unsigned long long WordLanes __attribute__((vector_size(LANES * sizeof(long long))));
+  typedef double DoubleLanes __attribute__((vector_size(LANES * sizeof(double))));
+
+  template <typename T> struct LanesOf;
+  template <> struct LanesOf<long long> { using type = IntLanes; };
+  template <> struct LanesOf<double> { using type = DoubleLanes; };
+
+  // Lanes are passed by reference: vector arguments change the ABI between AVX and non-AVX builds
+  template <typename T>
+  void loadLanes(typename LanesOf<T>::type &lanes, const T *data) {
+    std::memcpy(&lanes, data, sizeof(lanes));
+  }
+
+  // target = value in the lanes where mask is set
+  void selectLanes(IntLanes &target, const IntLanes &mask, const IntLanes &value) {
+    target = (value & mask) | (target & ~mask);
+  }
+#endif
+
+#ifdef TRANSPYLER_PARALLEL
+  constexpr std::size_t PARALLEL_THRESHOLD = std::size_t(1) << 20;
+#endif
+
+  // Number of chunks an array of size elements is split into, one per thread
+  std::size_t chunkCount(std::size_t size) {
+#ifdef TRANSPYLER_PARALLEL
+    if (size >= PARALLEL_THRESHOLD) {
+      std::size_t threads = DynamicType::parallelThreads();
+      return std::max<std::size_t>(1, std::min(threads, size / (PARALLEL_THRESHOLD / 4)));
+    }
+#endif
+    (void)size;
+    return 1;
+  }
+
+  // job(chunk, begin, end) for every chunk of [0, size), on the worker pool
+  template <typename Job>
+  void runChunks(std::size_t chunks, std::size_t size, Job job) {
+    DynamicType::parallelFor(chunks, 1, [&](std::size_t first, std::size_t last) {
+      for (std::size_t chunk = first; chunk < last; ++chunk) {
+        job(chunk, size * chunk / chunks, size * (chunk + 1) / chunks);
+      }
+    });
+  }
+
+  // Wrapping sum and bounds of a non-empty int array
+  struct IntBlock {
+    unsigned long long sum;
+    long long low;
+    long long high;
+  };
+
+  IntBlock reduceInts(const long long *data, std::size_t size) {
+    IntBlock block{0, data[0], data[0]};
+    std::size_t i = 0;
+#ifdef TRANSPYLER_VECTOR_KERNELS
+    if (size >= LANES) {
+      WordLanes sum = {};
+      IntLanes low;
+      loadLanes(low, data);
+      IntLanes high = low;
+      for (; i + LANES <= size; i += LANES) {
+        IntLanes lanes;
+        loadLanes(lanes, data + i);
+        sum += reinterpret_cast<WordLanes>(lanes);
+        selectLanes(low, lanes < low, lanes);
+        selectLanes(high, lanes > high, lanes);
+      }
+      for (std::size_t lane = 0; lane < LANES; ++lane) {
+        block.sum += sum[lane];
+        block.low = std::min(block.low, low[lane]);
+        block.high = std::max(block.high, high[lane]);
+      }
+    }
+#endif
+    for (; i < size; ++i) {
+      block.sum += static_cast<unsigned long long>(data[i]);
+      block.low = std::min(block.low, data[i]);
+      block.high = std::max(block.high, data[i]);
+    }
+    return block;
+  }
+
+  IntBlock boundsOfInts(const long long *data, std::size_t size) {
+    std::size_t chunks = chunkCount(size);
+    std::vector<IntBlock> partial(chunks);
+    runChunks(chunks, size, [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+      partial[chunk] = reduceInts(data + begin, end - begin);
+    });
+    IntBlock bounds = partial[0];
+    for (const IntBlock &block : partial) {
+      bounds.low = std::min(bounds.low, block.low);
+      bounds.high = std::max(bounds.high, block.high);
+    }
+    return bounds;
+  }
+
+  /**
+   * Add the ints of data to total and return how many were added: fewer than
+   * size if the next one would take total past 64 bits. The vector version
+   * adds blocks whose elements are small enough that their wrapping sum is
+   * exact, and checks other blocks element by element.
+   */
+  std::size_t sumIntRange(const long long *data, std::size_t size, long long &total) {
+#ifndef TRANSPYLER_VECTOR_KERNELS
+    for (std::size_t i = 0; i < size; ++i) {
+      long long next;
+      if (add_overflow(total, data[i], next)) return i;
+      total = next;
+    }
+    return size;
+#else
+    constexpr std::size_t BLOCK = 1024;
+    constexpr long long SMALL = 1LL << 52;  // BLOCK * SMALL < 2^63
+    for (std::size_t i = 0; i < size; i += BLOCK) {
+      std::size_t length = std::min(BLOCK, size - i);
+      IntBlock block = reduceInts(data + i, length);
+      long long next;
+      if (block.low >= -SMALL && block.high <= SMALL && !add_overflow(total, static_cast<long long>(block.sum), next)) {
+        total = next;
+        continue;
+      }
+      for (std::size_t j = i; j < i + length; ++j) {
+        if (add_overflow(total, data[j], next)) return j;
+        total = next;
+      }
+    }
+    return size;
+#endif
+  }
+
+  std::size_t sumInts(const long long *data, std::size_t size, long long &total) {
+    std::size_t chunks = chunkCount(size);
+    if (chunks > 1) {
+      std::vector<long long> partial(chunks, 0);
+      std::vector<char> complete(chunks, 0);
+      runChunks(chunks, size, [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+        complete[chunk] = sumIntRange(data + begin, end - begin, partial[chunk]) == end - begin;
+      });
+      long long combined = total;
+      bool exact = std::all_of(complete.begin(), complete.end(), [](char done) { return done != 0; });
+      for (std::size_t chunk = 0; exact && chunk < chunks; ++chunk) {
+        exact = !add_overflow(combined, partial[chunk], combined);
+      }
+      if (exact) {
+        total = combined;
+        return size;
+      }
+      // Some partial sum leaves 64 bits: redo it in order to find where
+    }
+    return sumIntRange(data, size, total);
+  }
+
+  template <typename T>
+  std::size_t countRange(const T *data, std::size_t size, T key) {
+    std::size_t i = 0;
+    std::size_t count = 0;
+#ifdef TRANSPYLER_VECTOR_KERNELS
+    using Lanes = typename LanesOf<T>::type;
+    Lanes keys = Lanes{} + key;
+    IntLanes hits = {};
+    for (; i + LANES <= size; i += LANES) {
+      Lanes lanes;
+      loadLanes(lanes, data + i);
+      // A true lane compares as -1
+      hits -= reinterpret_cast<IntLanes>(lanes == keys);
+    }
+    for (std::size_t lane = 0; lane < LANES; ++lane) count += static_cast<std::size_t>(hits[lane]);
+#endif
+    for (; i < size; ++i) count += data[i] == key;
+    return count;
+  }
+
+  template <typename T>
+  std::size_t countEqual(const T *data, std::size_t size, T key) {
+    std::size_t chunks = chunkCount(size);
+    std::vector<std::size_t> partial(chunks, 0);
+    runChunks(chunks, size, [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+      partial[chunk] = countRange(data + begin, end - begin, key);
+    });
+    std::size_t count = 0;
+    for (std::size_t hits : partial) count += hits;
+    return count;
+  }
+
+  // Position of the first element equal to key, or size
+  template <typename T>
+  std::size_t findEqual(const T *data, std::size_t size, T key) {
+    std::size_t i = 0;
+#ifdef TRANSPYLER_VECTOR_KERNELS
+    // Test four vectors at a time and rescan only the block with a match
+    constexpr std::size_t BLOCK = 4 * LANES;
+    using Lanes = typename LanesOf<T>::type;
+    Lanes keys = Lanes{} + key;
+    for (; i + BLOCK <= size; i += BLOCK) {
+      IntLanes hits = {};
+      for (std::size_t j = 0; j < BLOCK; j += LANES) {
+        Lanes lanes;
+        loadLanes(lanes, data + i + j);
+        hits |= reinterpret_cast<IntLanes>(lanes == keys);
+      }
+      if ((hits[0] | hits[1] | hits[2] | hits[3]) != 0) break;
+    }
+#endif
+    for (; i < size; ++i) {
+      if (data[i] == key) return i;
+    }
+    return size;
+  }
+
+  // Sort in chunks on separate threads, then merge the sorted runs pairwise
+  template <typename Array, typename Sort>
+  void sortArray(Array &values, Sort sortRange) {
+    std::size_t chunks = chunkCount(values.size());
+    std::vector<std::size_t> bounds(chunks + 1);
+    for (std::size_t chunk = 0; chunk <= chunks; ++chunk) bounds[chunk] = values.size() * chunk / chunks;
+    runChunks(chunks, values.size(), [&](std::size_t chunk, std::size_t, std::size_t) {
+      sortRange(values.begin() + static_cast<std::ptrdiff_t>(bounds[chunk]), values.begin() + static_cast<std::ptrdiff_t>(bounds[chunk + 1]));
+    });
+    for (std::size_t width = 1; width < chunks; width *= 2) {
+      for (std::size_t chunk = 0; chunk + width < chunks; chunk += 2 * width) {
+        std::inplace_merge(values.begin() + static_cast<std::ptrdiff_t>(bounds[chunk]),
+                           values.begin() + static_cast<std::ptrdiff_t>(bounds[chunk + width]),
+                           values.begin() + static_cast<std::ptrdiff_t>(bounds[std::min(chunk + 2 * width, chunks)]));
+      }
+    }
+  }
+
+  // Index of the smallest (less) or largest element, the first one on ties
+  template <typename T, typename Less>
+  std::size_t extremeIndex(const T *first, std::ptrdiff_t stride, std::size_t size, Less less) {
+    std::size_t best = 0;
+    for (std::size_t i = 1; i < size; ++i) {
+      if (less(first[static_cast<std::ptrdiff_t>(i) * stride], first[static_cast<std::ptrdiff_t>(best) * stride])) best = i;
+    }
+    return best;
+  }
+} // namespace
+
+template <typename Less>
+DynamicType DynamicType::extremeItem(const char *empty, Less less) const {
+  if (isList()) {
+    ListSpan list = listSpan();
+    if (list.size == 0) runtime_fail(empty);
+    if (list.storage == ListObject::INTS && list.stride == 1) {
+      // Equal ints are indistinguishable, so the bounds give the answer: less picks low for min, high for max
+      IntBlock bounds = boundsOfInts(list.ints, list.size);
+      return DynamicType(less(bounds.low, bounds.high) ? bounds.low : bounds.high);
+    }
+    if (list.storage == ListObject::INTS) {
+      return DynamicType(list.ints[static_cast<std::ptrdiff_t>(extremeIndex(list.ints, list.stride, list.size, less)) * list.stride]);
+    }
+    if (list.storage == ListObject::DOUBLES) {
+      return DynamicType(list.doubles[static_cast<std::ptrdiff_t>(extremeIndex(list.doubles, list.stride, list.size, less)) * list.stride]);
+    }
+  }
+  bool found = false;
+  DynamicType best;
+  for (DynamicType item : *this) {
+    if (!found || less(item, best)) best = std::move(item);
+    found = true;
+  }
+  if (!found) runtime_fail(empty);
+  return best;
+}
+
+DynamicType DynamicType::sumItems() const {
+  DynamicType result(0);
+  if (isList()) {
+    ListSpan list = listSpan();
+    std::size_t i = 0;
+    if (list.storage == ListObject::INTS) {
+      // Native running total until it would overflow, then big int arithmetic for the rest
+      long long total = 0;
+      if (list.stride == 1) {
+        i = sumInts(list.ints, list.size, total);
+      } else {
+        for (long long next; i < list.size && !add_overflow(total, list.ints[static_cast<std::ptrdiff_t>(i) * list.stride], next); ++i) {
+          total = next;
+        }
+      }
+      result = DynamicType(total);
+    } else if (list.storage == ListObject::DOUBLES) {
+      double total = 0.0;
+      for (; i < list.size; ++i) total += list.doubles[static_cast<std::ptrdiff_t>(i) * list.stride];
+      return DynamicType(total);
+    }
+    for (; i < list.size; ++i) result = result + list[i];
+    return result;
+  }
+  for (DynamicType item : *this) {
+    result = result + item;
+  }
+  return result;
+}
+
+DynamicType DynamicType::minItem() const {
+  return extremeItem("min() arg is an empty sequence", [](const auto &a, const auto &b) { return a < b; });
+}
+
+DynamicType DynamicType::maxItem() const {
+  return extremeItem("max() arg is an empty sequence", [](const auto &a, const auto &b) { return a > b; });
+}
+
+DynamicType DynamicType::itemAt(std::size_t index) const {
+  switch (type) {
+    case Type::LIST:
+      return listObject().at(index);
+    case Type::SLICE:
+      return listSpan()[index];
+    case Type::RANGE:
+      return DynamicType(rangeValue().at(index));
+    case Type::STRING:
+      return DynamicType(std::string(1, strValue()[index]));
+    default:
+      runtime_fail("Type is not a sequence");
+  }
+}
+
+std::size_t DynamicType::size() const {
+  switch (type) {
+    case Type::STRING:
+      return strValue().size();
+    case Type::LIST:
+      return listObject().size();
+    case Type::SLICE:
+      return sliceValue().length;
+    case Type::DICT:
+      return dictValue().size();
+    case Type::SET:
+      return setValue().size();
+    case Type::RANGE:
+      return rangeValue().size();
+    case Type::VIEW:
+      return viewValue().dict.dictValue().size();
+    default:
+      runtime_fail("Object has no len()");
+  }
+}
+
+std::size_t DynamicType::lengthHint() const {
+  return isIterable() && type != Type::GENERATOR ? size() : 0;
+}
+
+void DynamicType::Iterator::start() {
+  if (mode == Mode::TABLE) {
+    expected = source.type == Type::SET ? source.setValue().size()
+                                        : (source.type == Type::DICT ? source : source.viewValue().dict).dictValue().size();
+  }
+  advance();
+}
+
+void DynamicType::Iterator::advance() {
+  if (mode == Mode::GENERATOR) {
+    done = !source.nextItem(value);
+    return;
+  }
+  if (source.type == Type::SET) {
+    const Set &set = source.setValue();
+    if (set.size() != expected) runtime_fail("Set changed size during iteration");
+    index = set.liveFrom(index);
+    done = index >= set.positions();
+    return;
+  }
+  const Dict &dict = (source.type == Type::DICT ? source : source.viewValue().dict).dictValue();
+  if (dict.size() != expected) runtime_fail("dictionary changed size during iteration");
+  index = dict.liveFrom(index);
+  done = index >= dict.positions();
+}
+
+DynamicType DynamicType::Iterator::current() const {
+  if (mode == Mode::GENERATOR) return value;
+  if (source.type == Type::SET) return source.setValue().itemAt(index);
+  if (source.type == Type::DICT) return source.dictValue().entryAt(index).key;
+  const ViewObject &view = source.viewValue();
+  const Dict::Entry &entry = view.dict.dictValue().entryAt(index);
+  if (view.kind == ViewKind::KEYS) return entry.key;
+  if (view.kind == ViewKind::VALUES) return entry.value;
+  return DynamicType(std::vector<DynamicType>{entry.key, entry.value});
+}
+
+DynamicType DynamicType::Iterator::unpack(std::size_t position, std::size_t count) const {
+  if (source.type == Type::VIEW && source.viewValue().kind == ViewKind::ITEMS) {
+    if (count != 2) runtime_fail(count < 2 ? "too many values to unpack" : "not enough values to unpack");
+    const Dict::Entry &entry = source.viewValue().dict.dictValue().entryAt(index);
+    return position == 0 ? entry.key : entry.value;
+  }
+  DynamicType item = **this;
+  if (!(item.isList() || item.type == Type::STRING || item.type == Type::RANGE)) {
+    runtime_fail("cannot unpack a non-sequence");
+  }
+  std::size_t size = item.size();
+  if (size != count) runtime_fail(size > count ? "too many values to unpack" : "not enough values to unpack");
+  return item.itemAt(position);
+}
+
+DynamicType DynamicType::generator(void *frame, bool (*resume)(void *frame, DynamicType &out),
+                                   void (*destroyFrame)(void *frame)) {
+  GeneratorObject *object = new GeneratorObject();
+  object->frame = frame;
+  object->resume = resume;
+  object->destroyFrame = destroyFrame;
+  DynamicType result;
+  result.type = Type::GENERATOR;
+  result.payload.heap = object;
+  return result;
+}
+
+bool DynamicType::nextItem(DynamicType &out) const {
+  if (type != Type::GENERATOR) runtime_fail("Object is not an iterator");
+  GeneratorObject &generator = generatorObject();
+  if (generator.finished) return false;
+  // Stays set if the body raises; a generator resuming itself sees it exhausted
+  generator.finished = true;
+  generator.finished = !generator.resume(generator.frame, out);
+  return !generator.finished;
+}
+
+bool DynamicType::Range::contains(long long value) const {
+  if (step > 0 ? (value < start || value >= stop) : (value > start || value <= stop)) {
+    return false;
+  }
+  // In range, so the distance from start fits in an unsigned long long
+  unsigned long long distance = step > 0 ? static_cast<unsigned long long>(value) - static_cast<unsigned long long>(start)
+                                         : static_cast<unsigned long long>(start) - static_cast<unsigned long long>(value);
+  unsigned long long stride = step > 0 ? static_cast<unsigned long long>(step) : 0ULL - static_cast<unsigned long long>(step);
+  return distance % stride == 0;
+}
+
+std::vector<DynamicType>& DynamicType::getList() {
+  materialize();
+  TRANSPYLER_EXPECT_TYPE(type == Type::LIST, "Type is not a list");
+  prepareWrite();
+  return listObject().items();
+}
+
+const std::vector<DynamicType>& DynamicType::getList() const {
+  TRANSPYLER_EXPECT_TYPE(type == Type::LIST, "Type is not a list");
+  // Unpacking keeps the elements, so it is not a write
+  return listObject().items();
+}
+
+DynamicType::Dict& DynamicType::getDict() {
+  TRANSPYLER_EXPECT_TYPE(type == Type::DICT, "Type is not a dict");
+  prepareWrite();
+  return dictValue();
+}
+
+const DynamicType::Dict& DynamicType::getDict() const {
+  TRANSPYLER_EXPECT_TYPE(type == Type::DICT, "Type is not a dict");
+  return dictValue();
+}
+
+DynamicType::Set& DynamicType::getSet() {
+  TRANSPYLER_EXPECT_TYPE(type == Type::SET, "Type is not a set");
+  prepareWrite();
+  return setValue();
+}
+
+const DynamicType::Set& DynamicType::getSet() const {
+  TRANSPYLER_EXPECT_TYPE(type == Type::SET, "Type is not a set");
+  return setValue();
+}
+
+namespace {
+
+// Python's slice.indices(): first index and item count of seq[start:stop:step]
+// for a sequence of `size` items; NONE bounds are omitted ones
+void sliceIndices(std::size_t size, const DynamicType &start, const DynamicType &stop, long long step,
+                  long long &first, std::size_t &length) {
+  long long count = static_cast<long long>(size);
+  auto clamp = [&](const DynamicType &bound, long long omitted) {
+    if (bound.isNone()) return omitted;
+    long long index = bound.toInt();
+    if (index < 0) {
+      index += count;
+      if (index < 0) return step < 0 ? -1LL : 0LL;
+    } else if (index >= count) {
+      return step < 0 ? count - 1 : count;
+    }
+    return index;
+  };
+  first = clamp(start, step < 0 ? count - 1 : 0);
+  long long last = clamp(stop, step < 0 ? -1 : count);
+  if (step > 0) {
+    length = last > first ? static_cast<std::size_t>((last - first - 1) / step + 1) : 0;
+  } else {
+    length = first > last ? static_cast<std::size_t>((first - last - 1) / -step + 1) : 0;
+  }
+}
+
+}  // namespace
+
+DynamicType DynamicType::slice(const DynamicType &start, const DynamicType &stop, const DynamicType &step) const {
+  if (!isList() && type != Type::STRING) {
+    runtime_fail("Type does not support slicing");
+  }
+  long long stride = step.isNone() ? 1 : step.toInt();
+  if (stride == 0) {
+    runtime_fail("Slice step cannot be zero");
+  }
+  long long first;
+  std::size_t length;
+  sliceIndices(size(), start, stop, stride, first, length);
+
+  if (type == Type::STRING) {
+    const std::string &text = strValue();
+    if (stride == 1) return DynamicType(text.substr(static_cast<std::size_t>(first), length));
+    std::string result;
+    result.reserve(length);
+    for (std::size_t i = 0; i < length; ++i) {
+      result += text[static_cast<std::size_t>(first + static_cast<long long>(i) * stride)];
+    }
+    return DynamicType(std::move(result));
+  }
+  return sliceOf(first, stride, length);
+}
+
+DynamicType DynamicType::sublist(size_t start, size_t end) const {
+  if(!isList()) {
+    runtime_fail("Type is not a list");
+  }
+  
+  if(start > size() || end > size() || start > end) {
+    runtime_fail("Sublist indices out of range");
+  }
+  
+  return sliceOf(static_cast<long long>(start), 1, end - start);
+}
+
+DynamicType DynamicType::sublist(size_t start, size_t end, size_t step) const {
+  if(!isList()) {
+    runtime_fail("Type is not a list");
   }
   
-  std::vector<DynamicType>& list = getList();
-  if(start > list.size() || end > list.size()) {
-    throw std::runtime_error("Sublist indices out of range");
+  if(step == 0) {
+    runtime_fail("Step cannot be zero");
   }
   
-  std::vector<DynamicType> newList;
-  for(size_t i = start; i < end; i += step) {
-    newList.push_back(list[i]);
+  if(start > size() || end > size()) {
+    runtime_fail("Sublist indices out of range");
   }
   
-  return DynamicType(newList);
+  return sliceOf(static_cast<long long>(start), static_cast<long long>(step), end > start ? (end - start + step - 1) / step : 0);
 }
 
 void DynamicType::add(const DynamicType &item) {
-  if(type != Type::SET) {
-    throw std::runtime_error("add() can only be called on sets");
-  }
+  TRANSPYLER_EXPECT_TYPE(type == Type::SET, "add() can only be called on sets");
   
-  std::unordered_set<DynamicType>& set = getSet();
-  set.insert(item);
+  getSet().insert(item);
 }
 
 void DynamicType::append(const DynamicType &item) {
-  if(type != Type::LIST) {
-    throw std::runtime_error("append() can only be called on lists");
-  }
+  materialize();
+  TRANSPYLER_EXPECT_TYPE(type == Type::LIST, "append() can only be called on lists");
   
-  std::vector<DynamicType>& list = getList();
-  list.push_back(item);
+  prepareWrite();
+  listObject().push(item);
 }
 
-void DynamicType::remove(size_t index) {
-  if(type != Type::LIST) {
-    throw std::runtime_error("remove() by index can only be called on lists");
+void DynamicType::append(DynamicType &&item) {
+  materialize();
+  TRANSPYLER_EXPECT_TYPE(type == Type::LIST, "append() can only be called on lists");
+
+  prepareWrite();
+  ListObject &list = listObject();
+  if (list.value.index() == ListObject::ITEMS && !list.as<ListObject::ITEMS>().empty()) {
+    list.as<ListObject::ITEMS>().push_back(std::move(item));
+  } else {
+    list.push(item);
   }
+}
+
+void DynamicType::extend(const DynamicType &items) {
+  materialize();
+  TRANSPYLER_EXPECT_TYPE(type == Type::LIST, "extend() can only be called on lists");
+
+  if(items.isList() && items.payload.heap != payload.heap) {
+    // prepareWrite() first: if items is a view of this list, the write gives it its own elements
+    prepareWrite();
+    ListObject &list = listObject();
+    ListSpan tail = items.listSpan();
+    if(tail.stride == 1 && tail.storage != ListObject::ITEMS && (tail.storage == list.value.index() || list.size() == 0)) {
+      // Same packed storage, or an empty list taking it: copy the primitive array
+      if(tail.storage == ListObject::INTS) {
+        if(list.value.index() != ListObject::INTS) list.value.emplace<ListObject::INTS>();
+        ListObject::Ints &ints = list.as<ListObject::INTS>();
+        ints.insert(ints.end(), tail.ints, tail.ints + tail.size);
+      } else {
+        if(list.value.index() != ListObject::DOUBLES) list.value.emplace<ListObject::DOUBLES>();
+        ListObject::Doubles &doubles = list.as<ListObject::DOUBLES>();
+        doubles.insert(doubles.end(), tail.doubles, tail.doubles + tail.size);
+      }
+      return;
+    }
+    for(std::size_t i = 0; i < tail.size; ++i) {
+      list.push(tail[i]);
+    }
+    return;
+  }
+
+  // Any other iterable, or the list itself (lst.extend(lst)): collect the items first
+  std::vector<DynamicType> tail;
+  tail.reserve(items.lengthHint());
+  for(DynamicType item : items) {
+    tail.push_back(std::move(item));
+  }
+  prepareWrite();
+  ListObject &list = listObject();
+  for(const DynamicType &item : tail) {
+    list.push(item);
+  }
+}
+
+void DynamicType::remove(size_t index) {
+  materialize();
+  TRANSPYLER_EXPECT_TYPE(type == Type::LIST, "remove() by index can only be called on lists");
   
-  std::vector<DynamicType>& list = getList();
+  prepareWrite();
+  ListObject &list = listObject();
   if(index >= list.size()) {
-    throw std::runtime_error("List index out of range");
+    runtime_fail("List index out of range");
   }
-  
-  list.erase(list.begin() + index);
+
+  list.erase(index);
 }
 
-void DynamicType::remove(const std::string &key) {
-  if(type != Type::DICT) {
-    throw std::runtime_error("remove() by key can only be called on dictionaries");
+DynamicType DynamicType::pop() {
+  materialize();
+  TRANSPYLER_EXPECT_TYPE(type == Type::LIST, "pop() without an index can only be called on lists");
+
+  prepareWrite();
+  ListObject &list = listObject();
+  if(list.size() == 0) {
+    runtime_fail("pop from empty list");
+  }
+  DynamicType last = list.at(list.size() - 1);
+  list.erase(list.size() - 1);
+  return last;
+}
+
+DynamicType DynamicType::pop(const DynamicType &key) {
+  if(type == Type::DICT) {
+    DynamicType *value = getDict().find(key);
+    if(value == nullptr) {
+      runtime_fail("Key not found in dictionary");
+    }
+    DynamicType result = std::move(*value);
+    dictValue().erase(key);
+    return result;
   }
+  materialize();
+  TRANSPYLER_EXPECT_TYPE(type == Type::LIST, "pop() can only be called on lists and dictionaries");
+
+  prepareWrite();
+  ListObject &list = listObject();
+  if(list.size() == 0) {
+    runtime_fail("pop from empty list");
+  }
+  std::size_t index = sequenceIndex(key, list.size(), "pop index out of range");
+  DynamicType result = list.at(index);
+  list.erase(index);
+  return result;
+}
+
+DynamicType DynamicType::pop(const DynamicType &key, const DynamicType &fallback) {
+  TRANSPYLER_EXPECT_TYPE(type == Type::DICT, "pop() with a default can only be called on dictionaries");
+
+  DynamicType *value = getDict().find(key);
+  if(value == nullptr) {
+    return fallback;
+  }
+  DynamicType result = std::move(*value);
+  dictValue().erase(key);
+  return result;
+}
+
+void DynamicType::insert(const DynamicType &index, const DynamicType &item) {
+  materialize();
+  TRANSPYLER_EXPECT_TYPE(type == Type::LIST, "insert() can only be called on lists");
+
+  prepareWrite();
+  ListObject &list = listObject();
+  long long size = static_cast<long long>(list.size());
+  long long position = index.toInt();
+  if(position < 0) position = std::max(0LL, position + size);
+  list.insert(static_cast<std::size_t>(std::min(position, size)), item);
+}
+
+void DynamicType::reserve(long long additional) {
+  // Only a hint: a slice view would have to become a list first, so it is left alone
+  if(type != Type::LIST || additional <= 0) return;
+  ListObject &list = listObject();
+  list.reserve(list.size() + static_cast<std::size_t>(additional));
+}
+
+void DynamicType::reserve(const DynamicType &low, const DynamicType &high, bool inclusive) {
+  long long additional;
+  if(low.type != Type::INT || high.type != Type::INT || sub_overflow(high.payload.i, low.payload.i, additional)) return;
+  reserve(inclusive && additional < LLONG_MAX ? additional + 1 : additional);
+}
+
+void DynamicType::remove(const std::string &key) {
+  TRANSPYLER_EXPECT_TYPE(type == Type::DICT, "remove() by key can only be called on dictionaries");
   
-  std::map<std::string, DynamicType>& dict = getDict();
-  dict.erase(key);
+  getDict().erase(DynamicType(key));
+}
+
+void DynamicType::removeKey(const DynamicType &key) {
+  TRANSPYLER_EXPECT_TYPE(type == Type::DICT, "remove() by key can only be called on dictionaries");
+
+  getDict().erase(key);
 }
 
 void DynamicType::remove(const DynamicType &item) {
-  if(type != Type::SET) {
-    throw std::runtime_error("remove() by item can only be called on sets");
-  }
+  TRANSPYLER_EXPECT_TYPE(type == Type::SET, "remove() by item can only be called on sets");
   
-  std::unordered_set<DynamicType>& set = getSet();
-  set.erase(item);
+  getSet().erase(item);
+}
+
+namespace {
+  // The set an argument of the set methods denotes: itself, or its elements hashed into scratch
+  const DynamicType::Set &setOperand(const DynamicType &other, DynamicType::Set &scratch) {
+    if (other.isSet()) return other.getSet();
+    if (!other.isIterable()) {
+      runtime_fail("Set operation argument is not iterable");
+    }
+    scratch.reserve(other.lengthHint());
+    for (DynamicType item : other) scratch.insert(item);
+    return scratch;
+  }
+}
+
+DynamicType DynamicType::union_(const DynamicType &other) const {
+  TRANSPYLER_EXPECT_TYPE(type == Type::SET, "union() can only be called on sets");
+  Set scratch;
+  return DynamicType(setValue().unionWith(setOperand(other, scratch)));
+}
+
+DynamicType DynamicType::intersection(const DynamicType &other) const {
+  TRANSPYLER_EXPECT_TYPE(type == Type::SET, "intersection() can only be called on sets");
+  Set scratch;
+  return DynamicType(setValue().intersection(setOperand(other, scratch)));
+}
+
+DynamicType DynamicType::difference(const DynamicType &other) const {
+  TRANSPYLER_EXPECT_TYPE(type == Type::SET, "difference() can only be called on sets");
+  Set scratch;
+  return DynamicType(setValue().difference(setOperand(other, scratch)));
+}
+
+DynamicType DynamicType::symmetric_difference(const DynamicType &other) const {
+  TRANSPYLER_EXPECT_TYPE(type == Type::SET, "symmetric_difference() can only be called on sets");
+  Set scratch;
+  return DynamicType(setValue().symmetricDifference(setOperand(other, scratch)));
+}
+
+void DynamicType::update(const DynamicType &other) {
+  TRANSPYLER_EXPECT_TYPE(type == Type::SET, "update() can only be called on sets");
+  Set scratch;
+  const Set &elements = setOperand(other, scratch);
+  getSet().update(elements);
+}
+
+void DynamicType::intersection_update(const DynamicType &other) {
+  TRANSPYLER_EXPECT_TYPE(type == Type::SET, "intersection_update() can only be called on sets");
+  Set scratch;
+  const Set &elements = setOperand(other, scratch);
+  getSet().intersectionUpdate(elements);
+}
+
+void DynamicType::difference_update(const DynamicType &other) {
+  TRANSPYLER_EXPECT_TYPE(type == Type::SET, "difference_update() can only be called on sets");
+  Set scratch;
+  const Set &elements = setOperand(other, scratch);
+  getSet().differenceUpdate(elements);
+}
+
+void DynamicType::symmetric_difference_update(const DynamicType &other) {
+  TRANSPYLER_EXPECT_TYPE(type == Type::SET, "symmetric_difference_update() can only be called on sets");
+  Set scratch;
+  const Set &elements = setOperand(other, scratch);
+  getSet().symmetricDifferenceUpdate(elements);
 }
 
 // Contains method (for dict, list, set)
 bool DynamicType::contains(const DynamicType& key) const {
   if(type == Type::DICT) {
-    if(!key.isString()) {
-      return false; // Dict keys must be strings
-    }
-    const std::map<std::string, DynamicType>& dict = getDict();
-    return dict.find(key.toString()) != dict.end();
+    return getDict().contains(key);
   }
   else if(type == Type::SET) {
-    const std::unordered_set<DynamicType>& set = getSet();
-    return set.find(key) != set.end();
+    return getSet().contains(key);
   }
-  else if(type == Type::LIST) {
-    const std::vector<DynamicType>& list = getList();
-    return std::find(list.begin(), list.end(), key) != list.end();
+  else if(isList()) {
+    return findItem(key) < listSpan().size;
+  }
+  else if(type == Type::RANGE) {
+    // Only integral values can be members, checked arithmetically in O(1)
+    if(key.isDouble()) {
+      double whole = std::floor(key.toDouble());
+      // Range bounds are 64-bit, so larger magnitudes are never members
+      return whole == key.toDouble() && std::fabs(whole) < 9.2e18 && rangeValue().contains(static_cast<long long>(whole));
+    }
+    return (key.isInt() || key.isBool()) && rangeValue().contains(key.toInt());
+  }
+  else if(type == Type::STRING) {
+    return strValue().find(key.toString()) != std::string::npos;
+  }
+  else if(type == Type::VIEW) {
+    const ViewObject &view = viewValue();
+    const Dict &dict = view.dict.dictValue();
+    if(view.kind == ViewKind::KEYS) return dict.contains(key);
+    if(view.kind == ViewKind::ITEMS) {
+      // A (key, value) pair: one lookup, then the value compares
+      if(!key.isList() || key.size() != 2) return false;
+      const DynamicType *value = dict.find(key.itemAt(0));
+      return value != nullptr && *value == key.itemAt(1);
+    }
+    for(const Dict::Entry &entry : dict) {
+      if(entry.value == key) return true;
+    }
+    return false;
+  }
+  else if(type == Type::GENERATOR) {
+    // Consumes the generator up to the first match, as in Python
+    for(DynamicType item : *this) {
+      if(item == key) return true;
+    }
+    return false;
   }
   else {
-    throw std::runtime_error("contains() can only be called on dict, set, or list");
+    runtime_fail("contains() can only be called on dict, set, list, range or string");
   }
 }
 
-void DynamicType::set(const std::string &key, const DynamicType &value) {
-  if(type != Type::DICT) {
-    throw std::runtime_error("set() can only be called on dictionaries");
+std::size_t DynamicType::findItem(const DynamicType &item) const {
+  ListSpan list = listSpan();
+  if(list.stride == 1 && list.storage == ListObject::INTS && item.type == Type::INT) {
+    return findEqual(list.ints, list.size, item.payload.i);
+  }
+  if(list.stride == 1 && list.storage == ListObject::DOUBLES && item.type == Type::DOUBLE) {
+    return findEqual(list.doubles, list.size, item.payload.d);
+  }
+  for(std::size_t i = 0; i < list.size; ++i) {
+    if(list[i] == item) return i;
+  }
+  return list.size;
+}
+
+DynamicType DynamicType::index(const DynamicType &item) const {
+  if(type == Type::STRING) {
+    if(item.type != Type::STRING) {
+      runtime_fail("index() needs a string argument");
+    }
+    std::size_t position = strValue().find(item.strValue());
+    if(position == std::string::npos) {
+      runtime_fail("substring not found");
+    }
+    return DynamicType(static_cast<long long>(position));
+  }
+  if(!isList()) {
+    runtime_fail("index() can only be called on lists and strings");
+  }
+  std::size_t position = findItem(item);
+  if(position == listSpan().size) {
+    runtime_fail((item.toString() + " is not in list").c_str());
+  }
+  return DynamicType(static_cast<long long>(position));
+}
+
+DynamicType DynamicType::count(const DynamicType &item) const {
+  if(type == Type::STRING) {
+    if(item.type != Type::STRING) {
+      runtime_fail("count() needs a string argument");
+    }
+    const std::string &text = strValue();
+    const std::string &part = item.strValue();
+    if(part.empty()) return DynamicType(static_cast<long long>(text.size() + 1));
+    long long found = 0;
+    for(std::size_t position = text.find(part); position != std::string::npos; position = text.find(part, position + part.size())) {
+      ++found;
+    }
+    return DynamicType(found);
+  }
+  if(!isList()) {
+    runtime_fail("count() can only be called on lists and strings");
+  }
+  ListSpan list = listSpan();
+  if(list.stride == 1 && list.storage == ListObject::INTS && item.type == Type::INT) {
+    return DynamicType(static_cast<long long>(countEqual(list.ints, list.size, item.payload.i)));
+  }
+  if(list.stride == 1 && list.storage == ListObject::DOUBLES && item.type == Type::DOUBLE) {
+    return DynamicType(static_cast<long long>(countEqual(list.doubles, list.size, item.payload.d)));
+  }
+  long long found = 0;
+  for(std::size_t i = 0; i < list.size; ++i) {
+    if(list[i] == item) ++found;
+  }
+  return DynamicType(found);
+}
+
+DynamicType DynamicType::join(const DynamicType &items) const {
+  TRANSPYLER_EXPECT_TYPE(type == Type::STRING, "join() can only be called on strings");
+  const std::string &separator = strValue();
+  std::string result;
+  if(items.type == Type::STRING) {
+    // Every character is a piece
+    const std::string &text = items.strValue();
+    if(text.empty()) return DynamicType(std::move(result));
+    result.reserve(text.size() + separator.size() * (text.size() - 1));
+    for(std::size_t i = 0; i < text.size(); ++i) {
+      if(i > 0) result += separator;
+      result += text[i];
+    }
+    return DynamicType(std::move(result));
+  }
+
+  // Two passes over the pieces: check them and add up the length, then copy
+  // into a buffer of exactly that size
+  auto build = [&](auto &&forEach) {
+    std::size_t pieces = 0;
+    std::size_t total = 0;
+    forEach([&](const DynamicType &piece) {
+      if(piece.type != Type::STRING) runtime_fail("join() expects an iterable of strings");
+      total += piece.strValue().size();
+      ++pieces;
+    });
+    if(pieces > 1) total += separator.size() * (pieces - 1);
+    result.reserve(total);
+    bool first = true;
+    forEach([&](const DynamicType &piece) {
+      if(!first) result += separator;
+      result += piece.strValue();
+      first = false;
+    });
+    return DynamicType(std::move(result));
+  };
+  if(items.isList()) {
+    ListSpan list = items.listSpan();
+    // A packed int or float list holds no strings
+    if(list.size > 0 && list.storage != ListObject::ITEMS) runtime_fail("join() expects an iterable of strings");
+    return build([&](auto &&visit) {
+      for(std::size_t i = 0; i < list.size; ++i) visit(list.items[static_cast<std::ptrdiff_t>(i) * list.stride]);
+    });
+  }
+  if(items.type == Type::SET) {
+    return build([&](auto &&visit) {
+      for(const DynamicType &piece : items.setValue()) visit(piece);
+    });
+  }
+  if(items.type == Type::DICT) {
+    return build([&](auto &&visit) {
+      for(const Dict::Entry &entry : items.dictValue()) visit(entry.key);
+    });
+  }
+  if(items.type == Type::RANGE) {
+    if(items.rangeValue().size() > 0) runtime_fail("join() expects an iterable of strings");
+    return DynamicType(std::move(result));
+  }
+  if(items.type == Type::VIEW) {
+    return build([&](auto &&visit) {
+      for(DynamicType piece : items) visit(piece);
+    });
+  }
+  if(items.type == Type::GENERATOR) {
+    // It can only be walked once: collect the pieces first
+    DynamicType pieces(std::vector<DynamicType>{});
+    pieces.extend(items);
+    return join(pieces);
+  }
+  runtime_fail("join() argument is not iterable");
+}
+
+void DynamicType::sort() {
+  materialize();
+  if(type != Type::LIST) {
+    runtime_fail("sort() can only be called on lists");
+  }
+  prepareWrite();
+  ListObject &list = listObject();
+  list.compact();
+  switch(list.value.index()) {
+    case ListObject::INTS:
+      // Equal ints are indistinguishable, so stability does not matter
+      sortArray(list.as<ListObject::INTS>(), [](auto first, auto last) { std::sort(first, last); });
+      break;
+    case ListObject::DOUBLES:
+      // Stable and safe with NaN, which breaks the strict ordering std::sort needs
+      sortArray(list.as<ListObject::DOUBLES>(), [](auto first, auto last) { std::stable_sort(first, last); });
+      break;
+    default: {
+      ListObject::Items &items = list.as<ListObject::ITEMS>();
+      std::stable_sort(items.begin(), items.end(), [](const DynamicType &a, const DynamicType &b) { return a < b; });
+      break;
+    }
   }
+}
+
+void DynamicType::set(const std::string &key, const DynamicType &value) {
+  TRANSPYLER_EXPECT_TYPE(type == Type::DICT, "set() can only be called on dictionaries");
   
-  std::map<std::string, DynamicType>& dict = getDict();
-  dict[key] = value;
+  getDict()[std::string_view(key)] = value;
+}
+
+void DynamicType::set(const DynamicType &key, const DynamicType &value) {
+  TRANSPYLER_EXPECT_TYPE(type == Type::DICT, "set() can only be called on dictionaries");
+
+  getDict()[key] = value;
 }
 
 DynamicType DynamicType::get(const std::string &key) const {
-  if(type != Type::DICT) {
-    throw std::runtime_error("get() can only be called on dictionaries");
-  }
+  TRANSPYLER_EXPECT_TYPE(type == Type::DICT, "get() can only be called on dictionaries");
   
-  const std::map<std::string, DynamicType>& dict = getDict();
-  std::map<std::string, DynamicType>::const_iterator it = dict.find(key);
-  if(it != dict.end()) {
-    return it->second;
+  const DynamicType *value = getDict().find(std::string_view(key));
+  if(value != nullptr) {
+    return *value;
   }
   else {
-    throw std::runtime_error("Key not found in dictionary");
+    runtime_fail("Key not found in dictionary");
   }
 }
 
+DynamicType DynamicType::get(const DynamicType &key) const {
+  TRANSPYLER_EXPECT_TYPE(type == Type::DICT, "get() can only be called on dictionaries");
+
+  const DynamicType *value = getDict().find(key);
+  if(value != nullptr) {
+    return *value;
+  }
+  else {
+    runtime_fail("Key not found in dictionary");
+  }
+}
+
+DynamicType DynamicType::viewOf(ViewKind kind) const {
+  ViewObject *view = new ViewObject();
+  view->dict = *this;
+  view->kind = kind;
+  DynamicType result;
+  result.type = Type::VIEW;
+  result.payload.heap = view;
+  return result;
+}
+
+const char *DynamicType::viewName() const {
+  static const char *const NAMES[] = {"dict_keys", "dict_values", "dict_items"};
+  return NAMES[static_cast<int>(viewValue().kind)];
+}
+
 DynamicType DynamicType::keys() const {
   if (!isDict()) {
-    throw std::runtime_error("keys() can only be called on dictionaries");
+    runtime_fail("keys() can only be called on dictionaries");
   }
-  
-  const std::map<std::string, DynamicType>& dict = getDict();
-  std::vector<DynamicType> result;
-  result.reserve(dict.size());
-  
-  for (const std::pair<const std::string, DynamicType>& pair : dict) {
-    result.push_back(DynamicType(pair.first));
-  }
-  
-  return DynamicType(result);
+  return viewOf(ViewKind::KEYS);
 }
 
 DynamicType DynamicType::values() const {
   if (!isDict()) {
-    throw std::runtime_error("values() can only be called on dictionaries");
+    runtime_fail("values() can only be called on dictionaries");
   }
-  
-  const std::map<std::string, DynamicType>& dict = getDict();
-  std::vector<DynamicType> result;
-  result.reserve(dict.size());
-  for (const std::pair<const std::string, DynamicType>& pair : dict) {
-    result.push_back(pair.second);
-  }
-  
-  return DynamicType(result);
+  return viewOf(ViewKind::VALUES);
 }
 
 DynamicType DynamicType::items() const {
-    if (!isDict()) {
-        throw std::runtime_error("items() can only be called on dictionaries");
-    }
-    
-    const std::map<std::string, DynamicType>& dict = getDict();
-    std::vector<DynamicType> result;
-    result.reserve(dict.size());
-    
-    for (const std::pair<const std::string, DynamicType>& pair : dict) {
-        // Create a 2-element vector [key, value]
-        std::vector<DynamicType> item;
-        item.push_back(DynamicType(pair.first));
-        item.push_back(pair.second);
-        result.push_back(DynamicType(item));
-    }
-    
-    return DynamicType(result);
+  if (!isDict()) {
+    runtime_fail("items() can only be called on dictionaries");
+  }
+  return viewOf(ViewKind::ITEMS);
+}
+
+// ---------- Dict ----------
+namespace {
+  std::size_t keyHash(const DynamicType &key) { return std::hash<DynamicType>{}(key); }
+  // Equal to the hash of the corresponding string DynamicType
+  std::size_t keyHash(std::string_view key) { return std::hash<std::string_view>{}(key); }
+}
+
+DynamicType::Dict::Dict(std::initializer_list<std::pair<DynamicType, DynamicType>> items) {
+  for (const std::pair<DynamicType, DynamicType> &item : items) {
+    (*this)[item.first] = item.second;
+  }
+}
+
+bool DynamicType::Dict::keyEquals(const DynamicType &stored, const DynamicType &key) {
+  return stored == key;
+}
+
+bool DynamicType::Dict::keyEquals(const DynamicType &stored, std::string_view key) {
+  return stored.type == Type::STRING && stored.strValue() == key;
+}
+
+template <typename Key>
+std::ptrdiff_t DynamicType::Dict::lookup(const Key &key, std::size_t hash) const {
+  if (slots.empty()) return -1;
+  // CPython's probe sequence: every slot is eventually visited, and the
+  // perturbation mixes in the high bits of the hash
+  std::size_t mask = slots.size() - 1;
+  std::size_t perturb = hash;
+  std::size_t slot = hash & mask;
+  while (true) {
+    std::int32_t index = slots[slot];
+    if (index == EMPTY) return -1;
+    if (index >= 0) {
+      const Entry &entry = entries[static_cast<std::size_t>(index)];
+      if (entry.hash == hash && keyEquals(entry.key, key)) return static_cast<std::ptrdiff_t>(slot);
+    }
+    perturb >>= 5;
+    slot = (slot * 5 + perturb + 1) & mask;
+  }
+}
+
+std::size_t DynamicType::Dict::emptySlot(std::size_t hash) const {
+  std::size_t mask = slots.size() - 1;
+  std::size_t perturb = hash;
+  std::size_t slot = hash & mask;
+  while (slots[slot] != EMPTY) {
+    perturb >>= 5;
+    slot = (slot * 5 + perturb + 1) & mask;
+  }
+  return slot;
+}
+
+DynamicType *DynamicType::Dict::find(const DynamicType &key) {
+  std::ptrdiff_t slot = lookup(key, keyHash(key));
+  return slot < 0 ? nullptr : &entries[static_cast<std::size_t>(slots[slot])].value;
+}
+
+const DynamicType *DynamicType::Dict::find(const DynamicType &key) const {
+  return const_cast<Dict *>(this)->find(key);
+}
+
+DynamicType *DynamicType::Dict::find(std::string_view key) {
+  std::ptrdiff_t slot = lookup(key, keyHash(key));
+  return slot < 0 ? nullptr : &entries[static_cast<std::size_t>(slots[slot])].value;
+}
+
+const DynamicType *DynamicType::Dict::find(std::string_view key) const {
+  return const_cast<Dict *>(this)->find(key);
+}
+
+DynamicType &DynamicType::Dict::operator[](const DynamicType &key) {
+  std::size_t hash = keyHash(key);
+  std::ptrdiff_t slot = lookup(key, hash);
+  if (slot >= 0) return entries[static_cast<std::size_t>(slots[slot])].value;
+  return insert(key, hash);
+}
+
+DynamicType &DynamicType::Dict::operator[](std::string_view key) {
+  std::size_t hash = keyHash(key);
+  std::ptrdiff_t slot = lookup(key, hash);
+  if (slot >= 0) return entries[static_cast<std::size_t>(slots[slot])].value;
+  // Only a new key pays for building its string
+  return insert(DynamicType(std::string(key)), hash);
+}
+
+bool DynamicType::Dict::erase(const DynamicType &key) {
+  std::ptrdiff_t slot = lookup(key, keyHash(key));
+  if (slot < 0) return false;
+  Entry &entry = entries[static_cast<std::size_t>(slots[slot])];
+  slots[slot] = DUMMY;
+  entry.live = false;
+  entry.key = DynamicType();
+  entry.value = DynamicType();
+  if (--live == 0) {
+    entries.clear();
+    slots.assign(slots.size(), EMPTY);
+  }
+  return true;
+}
+
+DynamicType &DynamicType::Dict::insert(DynamicType key, std::size_t hash) {
+  // Dead entries keep their DUMMY slot, so they count towards the load
+  if ((entries.size() + 1) * 3 > slots.size() * 2) resize();
+  slots[emptySlot(hash)] = static_cast<std::int32_t>(entries.size());
+  entries.push_back(Entry{std::move(key), DynamicType(), hash, true});
+  ++live;
+  return entries.back().value;
+}
+
+void DynamicType::Dict::resize() {
+  // Drop dead entries and leave the table at most one third full
+  std::vector<Entry> compact;
+  compact.reserve(live + 1);
+  for (Entry &entry : entries) {
+    if (entry.live) compact.push_back(std::move(entry));
+  }
+  entries.swap(compact);
+
+  std::size_t capacity = 8;
+  while (capacity < (live + 1) * 3) capacity <<= 1;
+  slots.assign(capacity, EMPTY);
+  for (std::size_t index = 0; index < entries.size(); ++index) {
+    slots[emptySlot(entries[index].hash)] = static_cast<std::int32_t>(index);
+  }
+}
+
+void DynamicType::Dict::reserve(std::size_t count) {
+  std::size_t capacity = 8;
+  while (capacity * 2 < (count + 1) * 3) capacity <<= 1;
+  if (capacity <= slots.size()) return;
+  entries.reserve(count);
+  slots.assign(capacity, EMPTY);
+  for (std::size_t index = 0; index < entries.size(); ++index) {
+    if (entries[index].live) slots[emptySlot(entries[index].hash)] = static_cast<std::int32_t>(index);
+  }
+}
+
+bool DynamicType::Dict::operator==(const Dict &other) const {
+  if (live != other.live) return false;
+  for (const Entry &entry : *this) {
+    const DynamicType *value = other.find(entry.key);
+    if (value == nullptr || !(*value == entry.value)) return false;
+  }
+  return true;
+}
+
+namespace {
+  /**
+   * Finalizer of MurmurHash3 applied on top of the Python hash: ints hash
+   * to themselves, so without it consecutive ids would share their group
+   * bits and pile up in one probe sequence.
+   */
+  std::uint64_t mixHash(std::size_t hash) {
+    std::uint64_t mixed = hash;
+    mixed ^= mixed >> 33;
+    mixed *= 0xff51afd7ed558ccdULL;
+    mixed ^= mixed >> 33;
+    return mixed;
+  }
+
+  // Control byte of a full slot: 7 bits of the mixed hash, so never negative
+  std::int8_t controlTag(std::uint64_t mixed) { return static_cast<std::int8_t>(mixed & 0x7F); }
+
+  // Bit i is set where the i-th control byte of a 16-byte group equals tag
+  std::uint32_t matchGroup(const std::int8_t *group, std::int8_t tag) {
+#ifdef __SSE2__
+    __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(group));
+    return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(tag))));
+#else
+    std::uint32_t mask = 0;
+    for (std::uint32_t i = 0; i < 16; ++i) mask |= static_cast<std::uint32_t>(group[i] == tag) << i;
+    return mask;
+#endif
+  }
+
+  // Bit i is set where the i-th control byte is EMPTY or DELETED, i.e. negative
+  std::uint32_t matchFree(const std::int8_t *group) {
+#ifdef __SSE2__
+    return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(group))));
+#else
+    std::uint32_t mask = 0;
+    for (std::uint32_t i = 0; i < 16; ++i) mask |= static_cast<std::uint32_t>(group[i] < 0) << i;
+    return mask;
+#endif
+  }
+
+  std::size_t lowestBit(std::uint32_t mask) {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<std::size_t>(__builtin_ctz(mask));
+#else
+    std::size_t bit = 0;
+    while ((mask & 1) == 0) {
+      mask >>= 1;
+      ++bit;
+    }
+    return bit;
+#endif
+  }
+
+  // Smallest power-of-two table of at least one group holding count elements at 7/8 load
+  std::size_t setCapacityFor(std::size_t count, std::size_t group) {
+    std::size_t capacity = group;
+    while (capacity / 8 * 7 < count) capacity <<= 1;
+    return capacity;
+  }
+}
+
+DynamicType::Set::Set(std::initializer_list<DynamicType> items) {
+  reserve(items.size());
+  for (const DynamicType &item : items) insert(item);
+}
+
+std::size_t DynamicType::Set::find(const DynamicType &item, std::size_t hash) const {
+  if (control.empty()) return NOT_FOUND;
+  std::uint64_t mixed = mixHash(hash);
+  std::int8_t tag = controlTag(mixed);
+  // Triangular probing over whole groups visits every group of a power-of-two table
+  std::size_t groupMask = control.size() / GROUP - 1;
+  std::size_t group = static_cast<std::size_t>(mixed >> 7) & groupMask;
+  for (std::size_t step = 1;; ++step) {
+    const std::int8_t *bytes = control.data() + group * GROUP;
+    for (std::uint32_t match = matchGroup(bytes, tag); match != 0; match &= match - 1) {
+      std::size_t slot = group * GROUP + lowestBit(match);
+      const Slot &candidate = slots[slot];
+      if (candidate.hash != hash) continue;
+      // Identity first, as CPython does: equal ints and shared strings skip the type dispatch of ==
+      if (candidate.item.type == item.type && candidate.item.payload.i == item.payload.i) return slot;
+      if (candidate.item == item) return slot;
+    }
+    // A group with an EMPTY byte was never full, so nothing probed past it
+    if (matchGroup(bytes, EMPTY) != 0) return NOT_FOUND;
+    group = (group + step) & groupMask;
+  }
+}
+
+std::size_t DynamicType::Set::freeSlot(std::size_t hash) const {
+  std::uint64_t mixed = mixHash(hash);
+  std::size_t groupMask = control.size() / GROUP - 1;
+  std::size_t group = static_cast<std::size_t>(mixed >> 7) & groupMask;
+  for (std::size_t step = 1;; ++step) {
+    std::uint32_t free = matchFree(control.data() + group * GROUP);
+    if (free != 0) return group * GROUP + lowestBit(free);
+    group = (group + step) & groupMask;
+  }
+}
+
+void DynamicType::Set::place(std::size_t slot, DynamicType item, std::size_t hash) {
+  if (control[slot] == EMPTY) ++used;
+  control[slot] = controlTag(mixHash(hash));
+  slots[slot].item = std::move(item);
+  slots[slot].hash = hash;
+  ++live;
+}
+
+void DynamicType::Set::insertUnique(const DynamicType &item, std::size_t hash) {
+  if (control.empty()) rehash(GROUP);
+  std::size_t slot = freeSlot(hash);
+  if (control[slot] == EMPTY && used + 1 > control.size() / 8 * 7) {
+    // Out of EMPTY slots: grow, or only drop the DELETED ones when at most
+    // half of the table is live, so either way the rehash is amortized
+    rehash(live + 1 > control.size() / 16 * 7 ? control.size() * 2 : control.size());
+    slot = freeSlot(hash);
+  }
+  place(slot, item, hash);
+}
+
+bool DynamicType::Set::insert(const DynamicType &item, std::size_t hash) {
+  if (find(item, hash) != NOT_FOUND) return false;
+  insertUnique(item, hash);
+  return true;
+}
+
+void DynamicType::Set::eraseSlot(std::size_t slot) {
+  const std::int8_t *group = control.data() + slot / GROUP * GROUP;
+  if (matchGroup(group, EMPTY) != 0) {
+    control[slot] = EMPTY;
+    --used;
+  } else {
+    control[slot] = DELETED;
+  }
+  slots[slot].item = DynamicType();
+  if (--live == 0) {
+    control.assign(control.size(), EMPTY);
+    used = 0;
+  }
+}
+
+bool DynamicType::Set::erase(const DynamicType &item, std::size_t hash) {
+  std::size_t slot = find(item, hash);
+  if (slot == NOT_FOUND) return false;
+  eraseSlot(slot);
+  return true;
+}
+
+void DynamicType::Set::reserve(std::size_t count) {
+  std::size_t capacity = setCapacityFor(count, GROUP);
+  if (capacity > control.size()) rehash(capacity);
+}
+
+void DynamicType::Set::rehash(std::size_t capacity) {
+  std::vector<std::int8_t> oldControl(capacity, EMPTY);
+  std::vector<Slot> oldSlots(capacity);
+  control.swap(oldControl);
+  slots.swap(oldSlots);
+  live = 0;
+  used = 0;
+  for (std::size_t slot = 0; slot < oldControl.size(); ++slot) {
+    if (oldControl[slot] >= 0) place(freeSlot(oldSlots[slot].hash), std::move(oldSlots[slot].item), oldSlots[slot].hash);
+  }
+}
+
+DynamicType::Set DynamicType::Set::unionWith(const Set &other) const {
+  const Set &large = live >= other.live ? *this : other;
+  const Set &small = live >= other.live ? other : *this;
+  Set result = large;
+  result.reserve(large.live + small.live);
+  for (const_iterator it = small.begin(); it != small.end(); ++it) result.insert(*it, it.hash());
+  return result;
+}
+
+DynamicType::Set DynamicType::Set::intersection(const Set &other) const {
+  const Set &large = live >= other.live ? *this : other;
+  const Set &small = live >= other.live ? other : *this;
+  Set result;
+  result.reserve(small.live);
+  for (const_iterator it = small.begin(); it != small.end(); ++it) {
+    if (large.find(*it, it.hash()) != NOT_FOUND) result.insertUnique(*it, it.hash());
+  }
+  return result;
+}
+
+DynamicType::Set DynamicType::Set::difference(const Set &other) const {
+  if (other.live < live) {
+    // Copy this table as is and take out the few elements of other
+    Set result = *this;
+    for (const_iterator it = other.begin(); it != other.end(); ++it) result.erase(*it, it.hash());
+    return result;
+  }
+  Set result;
+  result.reserve(live);
+  for (const_iterator it = begin(); it != end(); ++it) {
+    if (other.find(*it, it.hash()) == NOT_FOUND) result.insertUnique(*it, it.hash());
+  }
+  return result;
+}
+
+DynamicType::Set DynamicType::Set::symmetricDifference(const Set &other) const {
+  const Set &large = live >= other.live ? *this : other;
+  const Set &small = live >= other.live ? other : *this;
+  Set result = large;
+  result.reserve(large.live + small.live);
+  for (const_iterator it = small.begin(); it != small.end(); ++it) {
+    if (!result.erase(*it, it.hash())) result.insertUnique(*it, it.hash());
+  }
+  return result;
+}
+
+void DynamicType::Set::update(const Set &other) {
+  if (&other == this) return;
+  reserve(live + other.live);
+  for (const_iterator it = other.begin(); it != other.end(); ++it) insert(*it, it.hash());
+}
+
+void DynamicType::Set::intersectionUpdate(const Set &other) {
+  if (&other == this) return;
+  if (other.live < live) {
+    *this = intersection(other);
+    return;
+  }
+  for (std::size_t slot = 0; slot < slots.size() && live > 0; ++slot) {
+    if (control[slot] >= 0 && other.find(slots[slot].item, slots[slot].hash) == NOT_FOUND) eraseSlot(slot);
+  }
+}
+
+void DynamicType::Set::differenceUpdate(const Set &other) {
+  if (&other == this) {
+    *this = Set();
+    return;
+  }
+  if (other.live <= live) {
+    for (const_iterator it = other.begin(); it != other.end() && live > 0; ++it) erase(*it, it.hash());
+    return;
+  }
+  for (std::size_t slot = 0; slot < slots.size() && live > 0; ++slot) {
+    if (control[slot] >= 0 && other.find(slots[slot].item, slots[slot].hash) != NOT_FOUND) eraseSlot(slot);
+  }
+}
+
+void DynamicType::Set::symmetricDifferenceUpdate(const Set &other) {
+  if (&other == this) {
+    *this = Set();
+    return;
+  }
+  reserve(live + other.live);
+  for (const_iterator it = other.begin(); it != other.end(); ++it) {
+    if (!erase(*it, it.hash())) insertUnique(*it, it.hash());
+  }
+}
+
+bool DynamicType::Set::operator==(const Set &other) const {
+  if (live != other.live) return false;
+  for (const_iterator it = begin(); it != end(); ++it) {
+    if (other.find(*it, it.hash()) == NOT_FOUND) return false;
+  }
+  return true;
+}
+
+/*
+ * save() and load() files. The first 8 bytes are "TPYB", the format version,
+ * the byte order of the numbers that follow ('L' or 'B') and two zero bytes;
+ * then comes one value: a tag byte and its payload. Ints and floats are 8
+ * bytes, strings and big ints (in decimal) a byte length and the bytes,
+ * lists, dicts and sets an element count and their elements (keys and
+ * values alternating), ranges their start, stop and step. A packed int or
+ * float list is a count, zero padding to an 8-byte file offset and the
+ * elements as one array, which load() leaves in the file mapping.
+ */
+namespace {
+  enum class Tag : std::uint8_t { NONE, FALSE, TRUE, INT, FLOAT, BIGINT, STRING, LIST, INT_ARRAY, FLOAT_ARRAY, DICT, SET, RANGE };
+
+  constexpr char FILE_MAGIC[4] = {'T', 'P', 'Y', 'B'};
+  constexpr std::uint8_t FILE_VERSION = 1;
+  constexpr std::size_t HEADER_SIZE = 8;
+
+  char hostByteOrder() {
+    const std::uint16_t probe = 1;
+    char low;
+    std::memcpy(&low, &probe, 1);
+    return low == 1 ? 'L' : 'B';
+  }
+
+  [[noreturn]] TRANSPYLER_COLD void corruptFile() {
+    runtime_fail("load(): not a file written by save(), or truncated");
+  }
+}  // namespace
+
+struct DynamicType::BinaryFormat {
+  // Block-buffered file output that tracks its offset, for aligning arrays
+  class Writer {
+    public:
+      explicit Writer(std::FILE *file) : file(file) { buffer.reserve(BUFFER_SIZE); }
+
+      void bytes(const void *data, std::size_t size) {
+        offset += size;
+        if (buffer.size() + size > BUFFER_SIZE) flush();
+        if (size >= BUFFER_SIZE) {
+          // Large arrays go straight to the file
+          if (std::fwrite(data, 1, size, file) != size) failed = true;
+          return;
+        }
+        buffer.append(static_cast<const char *>(data), size);
+      }
+      void byte(Tag tag) { byte(static_cast<std::uint8_t>(tag)); }
+      void byte(std::uint8_t value) { bytes(&value, 1); }
+      void word(std::uint64_t value) { bytes(&value, 8); }
+      // Zero bytes up to the next 8-byte offset
+      void align() {
+        static const char zeros[8] = {};
+        bytes(zeros, (8 - offset % 8) % 8);
+      }
+      // Write what is buffered; false if any write failed
+      bool finish() {
+        flush();
+        return !failed;
+      }
+
+    private:
+      static constexpr std::size_t BUFFER_SIZE = 1 << 16;
+
+      void flush() {
+        if (!buffer.empty() && std::fwrite(buffer.data(), 1, buffer.size(), file) != buffer.size()) failed = true;
+        buffer.clear();
+      }
+
+      std::FILE *file;
+      std::string buffer;
+      std::uint64_t offset = 0;
+      bool failed = false;
+  };
+
+  // Bounds-checked cursor over a mapped file
+  class Reader {
+    public:
+      explicit Reader(MappedFile *file) : file(file), start(file->data), pos(file->data), end(file->data + file->size) {}
+
+      const char *take(std::size_t size) {
+        if (size > static_cast<std::size_t>(end - pos)) corruptFile();
+        const char *at = pos;
+        pos += size;
+        return at;
+      }
+      std::uint8_t byte() { return static_cast<std::uint8_t>(*take(1)); }
+      std::uint64_t word() {
+        std::uint64_t value;
+        std::memcpy(&value, take(8), 8);
+        return value;
+      }
+      // An element count, checked against the bytes left at `unit` bytes per element
+      std::size_t count(std::size_t unit) {
+        std::uint64_t value = word();
+        if (value > static_cast<std::uint64_t>(end - pos) / unit) corruptFile();
+        return static_cast<std::size_t>(value);
+      }
+      void align() { take((8 - static_cast<std::size_t>(pos - start) % 8) % 8); }
+      bool atEnd() const { return pos == end; }
+
+      MappedFile *file;
+
+    private:
+      const char *start;
+      const char *pos;
+      const char *end;
+  };
+
+  static void write(Writer &out, const DynamicType &value) {
+    switch (value.type) {
+      case Type::NONE:
+        out.byte(Tag::NONE);
+        return;
+      case Type::BOOL:
+        out.byte(value.payload.b ? Tag::TRUE : Tag::FALSE);
+        return;
+      case Type::INT:
+        out.byte(Tag::INT);
+        out.word(static_cast<std::uint64_t>(value.payload.i));
+        return;
+      case Type::DOUBLE: {
+        std::uint64_t bits;
+        std::memcpy(&bits, &value.payload.d, 8);
+        out.byte(Tag::FLOAT);
+        out.word(bits);
+        return;
+      }
+      case Type::BIGINT: {
+        std::string digits = value.bigIntValue().toString();
+        out.byte(Tag::BIGINT);
+        out.word(digits.size());
+        out.bytes(digits.data(), digits.size());
+        return;
+      }
+      case Type::STRING: {
+        const std::string &text = value.strValue();
+        out.byte(Tag::STRING);
+        out.word(text.size());
+        out.bytes(text.data(), text.size());
+        return;
+      }
+      case Type::LIST:
+      case Type::SLICE: {
+        ListSpan span = value.listSpan();
+        if (span.storage == ListObject::ITEMS) {
+          out.byte(Tag::LIST);
+          out.word(span.size);
+          for (std::size_t i = 0; i < span.size; ++i) write(out, span.items[static_cast<std::ptrdiff_t>(i) * span.stride]);
+          return;
+        }
+        const char *elements = span.storage == ListObject::INTS ? reinterpret_cast<const char *>(span.ints)
+                                                                : reinterpret_cast<const char *>(span.doubles);
+        out.byte(span.storage == ListObject::INTS ? Tag::INT_ARRAY : Tag::FLOAT_ARRAY);
+        out.word(span.size);
+        out.align();
+        if (span.stride == 1) {
+          out.bytes(elements, span.size * 8);
+        } else {
+          for (std::size_t i = 0; i < span.size; ++i) out.bytes(elements + static_cast<std::ptrdiff_t>(i) * span.stride * 8, 8);
+        }
+        return;
+      }
+      case Type::DICT:
+        out.byte(Tag::DICT);
+        out.word(value.dictValue().size());
+        for (const Dict::Entry &entry : value.dictValue()) {
+          write(out, entry.key);
+          write(out, entry.value);
+        }
+        return;
+      case Type::SET:
+        out.byte(Tag::SET);
+        out.word(value.setValue().size());
+        for (const DynamicType &item : value.setValue()) write(out, item);
+        return;
+      case Type::RANGE: {
+        const Range &range = value.rangeValue();
+        out.byte(Tag::RANGE);
+        out.word(static_cast<std::uint64_t>(range.start));
+        out.word(static_cast<std::uint64_t>(range.stop));
+        out.word(static_cast<std::uint64_t>(range.step));
+        return;
+      }
+      default:
+        runtime_fail("save() cannot store dict views or generators");
+    }
+  }
+
+  static DynamicType read(Reader &in) {
+    switch (static_cast<Tag>(in.byte())) {
+      case Tag::NONE:
+        return DynamicType();
+      case Tag::FALSE:
+        return DynamicType(false);
+      case Tag::TRUE:
+        return DynamicType(true);
+      case Tag::INT:
+        return DynamicType(static_cast<long long>(in.word()));
+      case Tag::FLOAT: {
+        std::uint64_t bits = in.word();
+        double number;
+        std::memcpy(&number, &bits, 8);
+        return DynamicType(number);
+      }
+      case Tag::BIGINT: {
+        std::size_t size = in.count(1);
+        const char *digits = in.take(size);
+        return DynamicType(BigInt::fromString(std::string(digits, size)));
+      }
+      case Tag::STRING: {
+        std::size_t size = in.count(1);
+        const char *text = in.take(size);
+        return DynamicType(std::string(text, size));
+      }
+      case Tag::LIST: {
+        std::size_t size = in.count(1);
+        ListObject::Items items;
+        items.reserve(size);
+        for (std::size_t i = 0; i < size; ++i) items.push_back(read(in));
+        return DynamicType(std::move(items));
+      }
+      case Tag::INT_ARRAY:
+        return readArray<ListObject::INTS, ListObject::Ints>(in);
+      case Tag::FLOAT_ARRAY:
+        return readArray<ListObject::DOUBLES, ListObject::Doubles>(in);
+      case Tag::DICT: {
+        std::size_t size = in.count(2);
+        Dict dict;
+        dict.reserve(size);
+        for (std::size_t i = 0; i < size; ++i) {
+          DynamicType key = read(in);
+          dict[key] = read(in);
+        }
+        return DynamicType(std::move(dict));
+      }
+      case Tag::SET: {
+        std::size_t size = in.count(1);
+        Set set;
+        set.reserve(size);
+        for (std::size_t i = 0; i < size; ++i) set.insert(read(in));
+        return DynamicType(std::move(set));
+      }
+      case Tag::RANGE: {
+        long long start = static_cast<long long>(in.word());
+        long long stop = static_cast<long long>(in.word());
+        long long step = static_cast<long long>(in.word());
+        if (step == 0) corruptFile();
+        return DynamicType(Range{start, stop, step});
+      }
+    }
+    corruptFile();
+  }
+
+  // A packed list whose storage is adopted in place from the mapping
+  template <std::size_t Kind, typename Array>
+  static DynamicType readArray(Reader &in) {
+    std::size_t size = in.count(8);
+    in.align();
+    char *elements = const_cast<char *>(in.take(size * 8));
+    DynamicType result;
+    ListObject *list = new ListObject();
+    result.type = Type::LIST;
+    result.payload.heap = list;
+    if (size == 0) {
+      list->value.emplace<Kind>();
+    } else {
+      in.file->pending = elements;
+      list->value.emplace<Kind>(size, typename Array::allocator_type(in.file));
+    }
+    return result;
+  }
+};
+
+void DynamicType::MappedFile::unmap() {
+#ifdef TRANSPYLER_MMAP
+  munmap(data, size);
+#else
+  ::operator delete(data);
+#endif
+  delete this;
+}
+
+void DynamicType::save(const std::string &path) const {
+  std::FILE *file = std::fopen(path.c_str(), "wb");
+  if (file == nullptr) runtime_fail(("save(): cannot open '" + path + "' for writing").c_str());
+  BinaryFormat::Writer out(file);
+  bool written;
+  try {
+    const char header[HEADER_SIZE] = {FILE_MAGIC[0], FILE_MAGIC[1], FILE_MAGIC[2], FILE_MAGIC[3],
+                                      static_cast<char>(FILE_VERSION), hostByteOrder(), 0, 0};
+    out.bytes(header, HEADER_SIZE);
+    BinaryFormat::write(out, *this);
+    written = out.finish();
+  } catch (...) {
+    std::fclose(file);
+    throw;
+  }
+  if (std::fclose(file) != 0) written = false;
+  if (!written) runtime_fail(("save(): cannot write '" + path + "'").c_str());
+}
+
+DynamicType DynamicType::load(const std::string &path) {
+  std::string cannotRead = "load(): cannot read '" + path + "'";
+  MappedFile *file = new MappedFile();
+#ifdef TRANSPYLER_MMAP
+  int descriptor = open(path.c_str(), O_RDONLY);
+  struct stat info;
+  if (descriptor < 0 || fstat(descriptor, &info) != 0) {
+    if (descriptor >= 0) close(descriptor);
+    delete file;
+    runtime_fail(cannotRead.c_str());
+  }
+  file->size = static_cast<std::size_t>(info.st_size);
+  // An empty file cannot be mapped; it fails the header check below
+  void *mapped = file->size == 0 ? nullptr : mmap(nullptr, file->size, PROT_READ | PROT_WRITE, MAP_PRIVATE, descriptor, 0);
+  close(descriptor);
+  if (mapped == MAP_FAILED) {
+    delete file;
+    runtime_fail(cannotRead.c_str());
+  }
+  file->data = static_cast<char *>(mapped);
+  if (file->data == nullptr) file->size = 0;
+#else
+  // No mmap(): read the file into one buffer that the packed lists share instead
+  std::FILE *input = std::fopen(path.c_str(), "rb");
+  if (input == nullptr || std::fseek(input, 0, SEEK_END) != 0) {
+    if (input != nullptr) std::fclose(input);
+    delete file;
+    runtime_fail(cannotRead.c_str());
+  }
+  file->size = static_cast<std::size_t>(std::ftell(input));
+  file->data = static_cast<char *>(::operator new(file->size + 1));
+  std::rewind(input);
+  bool complete = std::fread(file->data, 1, file->size, input) == file->size;
+  std::fclose(input);
+  if (!complete) {
+    file->unmap();
+    runtime_fail(cannotRead.c_str());
+  }
+#endif
+  // Lists that adopted part of the file keep it mapped after this reference goes
+  struct Release {
+    MappedFile *file;
+    ~Release() { file->release(); }
+  } release{file};
+
+  BinaryFormat::Reader in(file);
+  const char *header = in.take(HEADER_SIZE);
+  if (std::memcmp(header, FILE_MAGIC, 4) != 0) corruptFile();
+  if (static_cast<std::uint8_t>(header[4]) != FILE_VERSION) runtime_fail("load(): file written by another version of save()");
+  if (header[5] != hostByteOrder()) runtime_fail("load(): file written on a machine with another byte order");
+  DynamicType value = BinaryFormat::read(in);
+  if (!in.atEnd()) corruptFile();
+  return value;
 }
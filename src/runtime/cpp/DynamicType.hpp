@@ -2,39 +2,93 @@
 #ifndef DYNAMIC_TYPE_HPP
 #define DYNAMIC_TYPE_HPP
 
-#include <variant>
+#include "BigInt.hpp"
+#include "Profile.hpp"
+#include <atomic>
+#include <climits>
 #include <cmath>
+#include <cstdint>
 #include <functional>
+#include <initializer_list>
 #include <iostream>
-#include <map>
 #include <set>
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <sstream>
+#include <type_traits>
 #include <unordered_set>
+#include <utility>
+#include <variant>
 #include <vector>
 
 /**
  * DynamicType: Emulates Python's dynamic typing in C++
  * Supports: int, double, string, bool, None (nullptr)
- * and collections: list, dict, set
+ * and collections: list, dict, set, range, plus dict views and generators
+ *
+ * Ints are 64-bit and inline; an int that overflows 64 bits becomes a
+ * heap-allocated BigInt, so Python's unbounded ints stay exact while the
+ * common case never leaves the native fast path.
+ *
+ * Collections are reference-counted and shared between copies, like Python
+ * objects: passing a list to a function or assigning it to another variable
+ * is O(1) and mutations are visible through every alias. Building with
+ * -DTRANSPYLER_COPY_ON_WRITE keeps the O(1) copies but gives each copy value
+ * semantics by cloning a shared collection on its first write.
+ *
+ * -DTRANSPYLER_PARALLEL makes the reference counts atomic, so parallel_map()
+ * workers can share the values they read (see DynamicType::parallelFor()).
+ * Concurrent writes to one collection still race unless copy-on-write gives
+ * every writer its own copy.
  */
 class DynamicType;
 
+#if defined(__GNUC__) || defined(__clang__)
+#define TRANSPYLER_COLD __attribute__((cold, noinline))
+#define TRANSPYLER_LIKELY(condition) __builtin_expect(static_cast<bool>(condition), 1)
+#else
+#define TRANSPYLER_COLD
+#define TRANSPYLER_LIKELY(condition) static_cast<bool>(condition)
+#endif
+
+/**
+ * Throw std::runtime_error(message). Out of line and marked cold, so a
+ * check in an inlined hot path costs a compare and a predicted branch, with
+ * no exception construction code at the call site.
+ */
+[[noreturn]] TRANSPYLER_COLD void runtime_fail(const char *message);
+
+/**
+ * Type check of a hot accessor, e.g. that getList() is called on a list.
+ * Building with -DTRANSPYLER_UNCHECKED removes these checks, for trusted
+ * scripts that already run cleanly in the default build: calling into the
+ * wrong type is then undefined behaviour. Index, key, conversion and
+ * arithmetic errors are reported in every mode.
+ */
+#ifdef TRANSPYLER_UNCHECKED
+#define TRANSPYLER_EXPECT_TYPE(condition, message) static_cast<void>(0)
+#else
+#define TRANSPYLER_EXPECT_TYPE(condition, message) (TRANSPYLER_LIKELY(condition) ? static_cast<void>(0) : runtime_fail(message))
+#endif
+
 /**
  * Hash function specialization for DynamicType
  * 
  * This allows DynamicType objects to be used in hash-based containers
  * like std::unordered_set<DynamicType> and std::unordered_map<DynamicType, T>
  * 
- * The hash is computed based on the underlying value type:
- * - INT: uses std::hash<int>
- * - DOUBLE: uses std::hash<double>
- * - STRING: uses std::hash<std::string>
- * - BOOL: uses std::hash<bool>
+ * The hash follows Python's, so values that compare equal hash equal:
+ * - INT, BIGINT, BOOL, DOUBLE: Python's numeric hash (modulo 2^61 - 1), so
+ *   hash(1) == hash(1.0) == hash(True)
+ * - STRING: std::hash<std::string>, cached in the string object
  * - NONE: returns 0
- * - Complex types (LIST, DICT, SET): uses hash of their string representation
+ * - LIST: element hashes combined in order (CPython's tuple hash)
+ * - SET, DICT: order-independent combination of the element (key, value) hashes
+ * - RANGE: length, start and step, matching range equality
+ * - VIEW, GENERATOR: identity
+ * Containers are walked structurally; nothing is formatted or allocated.
  */
 namespace std {
     template<>
@@ -46,7 +100,7 @@ namespace std {
 
 class DynamicType{
   public:
-    enum class Type {
+    enum class Type : std::uint8_t {
       NONE,
       INT,
       DOUBLE,
@@ -54,47 +108,739 @@ class DynamicType{
       BOOL,
       LIST,
       DICT,
-      SET
+      SET,
+      RANGE,
+      // An int outside the 64-bit range; always normalized back to INT when it fits
+      BIGINT,
+      // lst[a:b:c] sharing the list's elements; a list to Python code, and a
+      // list of its own after its first write
+      SLICE,
+      // d.keys(), d.values() or d.items(): a live view of the dict, nothing copied
+      VIEW,
+      // Suspended generator function or generator expression (see Generator.hpp)
+      GENERATOR
+    };
+
+    /**
+     * Arithmetic progression produced by range(): only the bounds are stored,
+     * elements are computed on demand.
+     */
+    struct Range {
+      long long start;
+      long long stop;
+      long long step;
+
+      std::size_t size() const {
+        // Unsigned span: stop - start can exceed LLONG_MAX
+        unsigned long long span = step > 0 ? static_cast<unsigned long long>(stop) - static_cast<unsigned long long>(start)
+                                           : static_cast<unsigned long long>(start) - static_cast<unsigned long long>(stop);
+        if (step > 0 ? stop <= start : stop >= start) return 0;
+        unsigned long long stride = step > 0 ? static_cast<unsigned long long>(step) : 0ULL - static_cast<unsigned long long>(step);
+        return static_cast<std::size_t>((span - 1) / stride + 1);
+      }
+      long long at(std::size_t index) const { return start + static_cast<long long>(index) * step; }
+      bool contains(long long value) const;
+    };
+
+    /**
+     * Insertion-ordered hash table behind dict, laid out like CPython's:
+     * entries are appended to a dense array in insertion order, and a
+     * power-of-two open-addressing table of slots holds their indices.
+     * Keys of any hashable type keep their type; string keys can also be
+     * looked up by std::string_view without building a DynamicType.
+     * Python example: {"a": 1, 2: "b"}
+     */
+    class Dict {
+      public:
+        struct Entry;
+        class const_iterator;
+
+        Dict() = default;
+        Dict(std::initializer_list<std::pair<DynamicType, DynamicType>> items);
+
+        std::size_t size() const { return live; }
+        bool empty() const { return live == 0; }
+
+        // Value stored under key, or nullptr when it is missing
+        DynamicType *find(const DynamicType &key);
+        const DynamicType *find(const DynamicType &key) const;
+        DynamicType *find(std::string_view key);
+        const DynamicType *find(std::string_view key) const;
+        bool contains(const DynamicType &key) const { return find(key) != nullptr; }
+
+        /**
+         * Value stored under key, inserting None first when it is missing.
+         * Python example: d[key] = value
+         * The reference is invalidated by the next insertion, as with std::vector.
+         */
+        DynamicType &operator[](const DynamicType &key);
+        DynamicType &operator[](std::string_view key);
+        // Remove a key; false if it was not present. Python example: del d[key]
+        bool erase(const DynamicType &key);
+        // Room for count entries without growing the table
+        void reserve(std::size_t count);
+
+        // Live entries in insertion order
+        const_iterator begin() const;
+        const_iterator end() const;
+        // Walk by position, for cursors that must survive insertions: the
+        // first live position at or after `position`, or positions() past the end
+        std::size_t liveFrom(std::size_t position) const;
+        std::size_t positions() const { return entries.size(); }
+        const Entry &entryAt(std::size_t position) const { return entries[position]; }
+
+        // Same keys mapped to equal values, in any order
+        bool operator==(const Dict &other) const;
+        bool operator!=(const Dict &other) const { return !(*this == other); }
+
+      private:
+        static constexpr std::int32_t EMPTY = -1;
+        // Slot of an erased entry: probing continues past it
+        static constexpr std::int32_t DUMMY = -2;
+
+        // Insertion order; erased entries stay dead until the next resize
+        std::vector<Entry> entries;
+        // Index into entries, EMPTY or DUMMY; at most two thirds are non-empty
+        std::vector<std::int32_t> slots;
+        std::size_t live = 0;
+
+        static bool keyEquals(const DynamicType &stored, const DynamicType &key);
+        static bool keyEquals(const DynamicType &stored, std::string_view key);
+        // Slot holding key, or -1
+        template <typename Key>
+        std::ptrdiff_t lookup(const Key &key, std::size_t hash) const;
+        std::size_t emptySlot(std::size_t hash) const;
+        DynamicType &insert(DynamicType key, std::size_t hash);
+        void resize();
+    };
+
+    /**
+     * Hash table behind set: flat open addressing in the style of Abseil's
+     * SwissTable. Elements live inline in one array of slots with their
+     * hash, and a parallel array holds one control byte per slot: EMPTY,
+     * DELETED, or 7 bits of the element's hash. Lookups probe 16-slot groups,
+     * comparing all 16 control bytes at once (one SSE2 compare where
+     * available), so an element is only compared on a 7-bit hash match.
+     * Python example: {1, "a"}
+     */
+    class Set {
+      public:
+        struct Slot;
+        class const_iterator;
+
+        Set() = default;
+        Set(std::initializer_list<DynamicType> items);
+        template <typename InputIt>
+        Set(InputIt first, InputIt last) {
+          for (; first != last; ++first) insert(*first);
+        }
+
+        std::size_t size() const { return live; }
+        bool empty() const { return live == 0; }
+
+        bool contains(const DynamicType &item) const { return find(item, itemHash(item)) != NOT_FOUND; }
+        // Add an element; false if it was already present
+        bool insert(const DynamicType &item) { return insert(item, itemHash(item)); }
+        bool insert(const DynamicType &item, std::size_t hash);
+        // Remove an element; false if it was not present
+        bool erase(const DynamicType &item) { return erase(item, itemHash(item)); }
+        bool erase(const DynamicType &item, std::size_t hash);
+        // Room for `count` elements in total without rehashing
+        void reserve(std::size_t count);
+
+        // Live elements, in table order
+        const_iterator begin() const;
+        const_iterator end() const;
+        // Walk by slot position, as for Dict::liveFrom()
+        std::size_t liveFrom(std::size_t position) const;
+        std::size_t positions() const { return slots.size(); }
+        const DynamicType &itemAt(std::size_t position) const;
+
+        /**
+         * Set algebra. Each walks the smaller operand where the result allows
+         * it, reuses the stored hashes and sizes the result once up front.
+         * Python example: a | b, a & b, a - b, a ^ b
+         */
+        Set unionWith(const Set &other) const;
+        Set intersection(const Set &other) const;
+        Set difference(const Set &other) const;
+        Set symmetricDifference(const Set &other) const;
+        /**
+         * In-place forms. Python example: a.update(b), a.intersection_update(b),
+         * a.difference_update(b), a.symmetric_difference_update(b)
+         */
+        void update(const Set &other);
+        void intersectionUpdate(const Set &other);
+        void differenceUpdate(const Set &other);
+        void symmetricDifferenceUpdate(const Set &other);
+
+        bool operator==(const Set &other) const;
+        bool operator!=(const Set &other) const { return !(*this == other); }
+
+      private:
+        static constexpr std::int8_t EMPTY = -128;
+        // Erased slot in a group that was full: probing continues past it
+        static constexpr std::int8_t DELETED = -2;
+        static constexpr std::size_t GROUP = 16;
+        static constexpr std::size_t NOT_FOUND = static_cast<std::size_t>(-1);
+
+        // One byte per slot: EMPTY, DELETED, or the low 7 bits of the mixed hash
+        std::vector<std::int8_t> control;
+        std::vector<Slot> slots;
+        std::size_t live = 0;
+        // Slots not EMPTY; kept at most 7/8 of the capacity
+        std::size_t used = 0;
+
+        static std::size_t itemHash(const DynamicType &item) { return std::hash<DynamicType>{}(item); }
+        // Slot holding item, or NOT_FOUND
+        std::size_t find(const DynamicType &item, std::size_t hash) const;
+        // Slot for a new element: the first EMPTY or DELETED one of its probe sequence
+        std::size_t freeSlot(std::size_t hash) const;
+        void place(std::size_t slot, DynamicType item, std::size_t hash);
+        // Add an element known to be absent, growing the table if needed
+        void insertUnique(const DynamicType &item, std::size_t hash);
+        void eraseSlot(std::size_t slot);
+        void rehash(std::size_t capacity);
     };
 
+    class Iterator;
+    struct IterationEnd {};
+
   private:
-    std::variant<
-      std::monostate,
-      int,
-      double,
-      std::string,
-      bool,
-      std::vector<DynamicType>,
-      std::map<std::string, DynamicType>,
-      std::unordered_set<DynamicType>
-    > value;
+    friend struct std::hash<DynamicType>;
+    // Writer and reader of save() and load() files
+    struct BinaryFormat;
+
+    /**
+     * Header shared by every heap-allocated payload. Copies of a DynamicType
+     * share the same object and only bump the reference count, matching
+     * Python's aliasing semantics for lists, dicts and sets.
+     */
+#ifdef TRANSPYLER_PARALLEL
+    // True while worker threads run a parallel loop; set and cleared by the pool under its lock
+    inline static std::atomic<bool> parallelActive{false};
+
+    /**
+     * Reference count that parallel loops update from several threads. Only
+     * then are the updates atomic read-modify-writes: taking a reference is
+     * relaxed, since the handle copied from keeps the object alive, and
+     * dropping one is acquire-release, so the thread that frees the object
+     * sees every write made through the other handles. Between loops the
+     * program's own thread is the only one running and the count is updated
+     * like a plain integer.
+     */
+    class RefCount {
+      public:
+        explicit RefCount(std::size_t initial) : count(initial) {}
+        RefCount &operator++() {
+          if (parallelActive.load(std::memory_order_relaxed)) {
+            count.fetch_add(1, std::memory_order_relaxed);
+          } else {
+            count.store(count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+          }
+          return *this;
+        }
+        std::size_t operator--() {
+          if (parallelActive.load(std::memory_order_relaxed)) return count.fetch_sub(1, std::memory_order_acq_rel) - 1;
+          std::size_t left = count.load(std::memory_order_relaxed) - 1;
+          count.store(left, std::memory_order_relaxed);
+          return left;
+        }
+        operator std::size_t() const { return count.load(std::memory_order_acquire); }
+
+      private:
+        std::atomic<std::size_t> count;
+    };
+#else
+    using RefCount = std::size_t;
+#endif
+
+    struct HeapObject {
+      RefCount refs{1};
+
+      /**
+       * Heap objects are small and short-lived (every string or list
+       * temporary allocates one), so they come from per-thread free lists of
+       * 16-byte size classes carved out of 64 KiB chunks instead of the
+       * global heap. Freed blocks are reused for the next object of their
+       * class; chunks are never returned. -DTRANSPYLER_SYSTEM_ALLOCATOR uses
+       * plain operator new, e.g. for sanitizer builds.
+       */
+      static void *operator new(std::size_t size);
+      static void operator delete(void *block, std::size_t size);
+    };
+
+    template <typename T>
+    struct Shared : HeapObject {
+      T value;
+      template <typename... Args>
+      explicit Shared(Args &&...args) : value(std::forward<Args>(args)...) {}
+    };
+
+    // Strings cache their hash (0 = not computed yet); mutations go through mutableString().
+    // Relaxed atomic: threads hashing one shared string store the same value
+    struct StringObject : Shared<std::string> {
+      using Shared<std::string>::Shared;
+      std::atomic<std::size_t> hash{0};
+    };
+    /**
+     * Slice views share the elements of the list they were taken from through
+     * a SliceSource, which owns a reference to that list. The list points back
+     * without owning it, so its next in-place write first hands the views a
+     * private copy of the elements (see prepareWrite()).
+     */
+    struct SliceSource;
+    /**
+     * A file mapped into memory by load(), shared by the packed lists whose
+     * elements live in it and unmapped with the last of them. The mapping is
+     * private and writable: writing to such a list copies only the pages it
+     * touches and never changes the file.
+     */
+    struct MappedFile {
+      char *data = nullptr;
+      std::size_t size = 0;
+      // Block the next PackedAllocator::allocate() hands out instead of allocating
+      void *pending = nullptr;
+      std::atomic<std::size_t> refs{1};
+
+      bool contains(const void *block) const {
+        const char *byte = static_cast<const char *>(block);
+        return byte >= data && byte < data + size;
+      }
+      void retain() { refs.fetch_add(1, std::memory_order_relaxed); }
+      // Unmaps the file and deletes this with the last reference
+      void release() {
+        if (refs.fetch_sub(1, std::memory_order_acq_rel) == 1) unmap();
+      }
+      void unmap();
+    };
+    /**
+     * Allocator of packed list storage: plain operator new, except that a
+     * list built by load() adopts its elements where they lie in a
+     * MappedFile, holding a reference to it until the list reallocates or
+     * dies. Copies of a list always get heap storage. Elements are
+     * default-initialized, which leaves adopted ones untouched; packed
+     * storage only grows through push_back() and insert(), which write them.
+     */
+    template <typename T>
+    struct PackedAllocator {
+      using value_type = T;
+      using propagate_on_container_move_assignment = std::true_type;
+      using propagate_on_container_swap = std::true_type;
+
+      MappedFile *mapping = nullptr;
+
+      PackedAllocator() = default;
+      explicit PackedAllocator(MappedFile *mapping) : mapping(mapping) {
+        if (mapping != nullptr) mapping->retain();
+      }
+      PackedAllocator(const PackedAllocator &other) : PackedAllocator(other.mapping) {}
+      template <typename U>
+      PackedAllocator(const PackedAllocator<U> &other) : PackedAllocator(other.mapping) {}
+      PackedAllocator(PackedAllocator &&other) noexcept : mapping(other.mapping) { other.mapping = nullptr; }
+      PackedAllocator &operator=(PackedAllocator other) noexcept {
+        std::swap(mapping, other.mapping);
+        return *this;
+      }
+      ~PackedAllocator() {
+        if (mapping != nullptr) mapping->release();
+      }
+
+      PackedAllocator select_on_container_copy_construction() const { return PackedAllocator(); }
+
+      T *allocate(std::size_t count) {
+        if (mapping != nullptr && mapping->pending != nullptr) {
+          void *adopted = mapping->pending;
+          mapping->pending = nullptr;
+          return static_cast<T *>(adopted);
+        }
+        return static_cast<T *>(::operator new(count * sizeof(T)));
+      }
+      void deallocate(T *block, std::size_t) {
+        if (mapping != nullptr && mapping->contains(block)) {
+          mapping->release();
+          mapping = nullptr;
+          return;
+        }
+        ::operator delete(block);
+      }
+
+      template <typename U>
+      void construct(U *where) noexcept {
+        ::new (static_cast<void *>(where)) U;
+      }
+      template <typename U, typename... Args>
+      void construct(U *where, Args &&...args) {
+        ::new (static_cast<void *>(where)) U(std::forward<Args>(args)...);
+      }
+
+      friend bool operator==(const PackedAllocator &a, const PackedAllocator &b) { return a.mapping == b.mapping; }
+      friend bool operator!=(const PackedAllocator &a, const PackedAllocator &b) { return a.mapping != b.mapping; }
+    };
+    /**
+     * Storage strategies: a list holding only ints or only floats keeps them
+     * packed, 8 contiguous bytes per element, so bulk operations run over
+     * primitive arrays. It switches to DynamicType items when another element
+     * is stored, or when a mutable element reference is handed out
+     * (getList(), operator[]); an empty list picks its storage on the next
+     * append. Copying a ListObject copies only the elements. A packed list
+     * returned by load() starts out with its elements in the file mapping.
+     *
+     * The first `head` slots of the storage are a gap left by removals at the
+     * front: erasing or inserting moves the elements on the nearer side of the
+     * position, so a list used as a queue or a deque pops and pushes at
+     * either end in O(1) amortized. The gap is reclaimed once it outgrows
+     * the elements.
+     */
+    struct ListObject : HeapObject {
+      using Items = std::vector<DynamicType>;
+      using Ints = std::vector<long long, PackedAllocator<long long>>;
+      using Doubles = std::vector<double, PackedAllocator<double>>;
+      // Indices of the alternatives of value
+      static constexpr std::size_t ITEMS = 0;
+      static constexpr std::size_t INTS = 1;
+      static constexpr std::size_t DOUBLES = 2;
+
+      std::variant<Items, Ints, Doubles> value;
+      SliceSource *views = nullptr;
+      // Unused slots before the first element; compacted once they outnumber the elements
+      std::size_t head = 0;
+
+      // The storage alternative Kind, which value must hold: unlike
+      // std::get there is no second index check and no bad_variant_access path
+      template <std::size_t Kind>
+      std::variant_alternative_t<Kind, decltype(value)> &as() { return *std::get_if<Kind>(&value); }
+      template <std::size_t Kind>
+      const std::variant_alternative_t<Kind, decltype(value)> &as() const { return *std::get_if<Kind>(&value); }
+
+      ListObject() = default;
+      // Packs items that are all ints or all floats
+      explicit ListObject(Items items);
+      ListObject(const ListObject &other) : HeapObject(), value(other.value), head(other.head) { compact(); }
+
+      std::size_t size() const;
+      DynamicType at(std::size_t index) const;
+      // The elements as DynamicType items, unpacking a packed list; closes the gap first
+      Items &items();
+      void push(const DynamicType &item);
+      void set(std::size_t index, const DynamicType &item);
+      // Mutable reference to an element, unpacking a packed list
+      DynamicType &element(std::size_t index);
+      // index <= size()
+      void insert(std::size_t index, const DynamicType &item);
+      void erase(std::size_t index);
+      // Room for `capacity` elements in the current storage
+      void reserve(std::size_t capacity);
+      // Drop the gap before the first element
+      void compact();
+    };
+    struct SliceSource : HeapObject {
+      ListObject *list = nullptr;
+    };
+    // `length` elements of source->list, at start, start + step, ...
+    struct SliceObject : HeapObject {
+      SliceSource *source = nullptr;
+      long long start = 0;
+      long long step = 1;
+      std::size_t length = 0;
+    };
+    enum class ViewKind : std::uint8_t { KEYS, VALUES, ITEMS };
+    // d.keys(), d.values() or d.items(): holds a reference to the dict and
+    // reads it on every access, so it always shows the current contents
+    struct ViewObject;
+    /**
+     * A generator: the frame of a coroutine started suspended, driven through
+     * plain function pointers that Generator.hpp fills in. The runtime itself
+     * never names a coroutine type, so it still builds as C++17 and only
+     * programs that use generators need C++20.
+     */
+    struct GeneratorObject : HeapObject {
+      void *frame = nullptr;
+      // Run the body to its next yield, storing the value in out; false once it has finished
+      bool (*resume)(void *frame, DynamicType &out) = nullptr;
+      void (*destroyFrame)(void *frame) = nullptr;
+      bool finished = false;
+    };
+    using DictObject = Shared<Dict>;
+    using SetObject = Shared<Set>;
+    using RangeObject = Shared<Range>;
+    using BigIntObject = Shared<BigInt>;
+
+    /**
+     * Compact value layout: a one-byte tag plus an 8-byte payload.
+     * int (64-bit), double and bool live inline in the payload; big ints, strings and
+     * collections are reference-counted heap objects so that every element
+     * of a list costs 16 bytes and copying a collection is O(1).
+     */
+    union Payload {
+      long long i;
+      double d;
+      bool b;
+      HeapObject *heap;
+    };
 
+    Payload payload;
     Type type;
 
+    // True when the payload points to a heap object (string or collection)
+    bool isHeap() const {
+      return type == Type::STRING || type == Type::LIST || type == Type::DICT || type == Type::SET ||
+             type == Type::RANGE || type == Type::BIGINT || type == Type::SLICE || type == Type::VIEW ||
+             type == Type::GENERATOR;
+    }
+    // Type-erased parallelFor()
+    static void parallelRun(std::size_t count, std::size_t grain, void *context,
+                            void (*body)(void *context, std::size_t begin, std::size_t end));
+    // Drop one reference; frees the heap object when it was the last one
+    void release() {
+      if (--payload.heap->refs == 0) destroy();
+    }
+    void destroy();
+    // Give this handle its own copy of a shared heap object (copy-on-write mode)
+    void detach();
+    // Give the slice views of this list their own copy of its elements
+    void detachViews();
+    // Called before every in-place mutation of a collection
+    void prepareWrite() {
+      if (type == Type::LIST && static_cast<ListObject *>(payload.heap)->views != nullptr) detachViews();
+#ifdef TRANSPYLER_COPY_ON_WRITE
+      if (payload.heap->refs > 1) detach();
+#endif
+    }
+
+    // Typed views of the heap payload; callers check the tag first
+    std::string &strValue() const { return static_cast<StringObject *>(payload.heap)->value; }
+    std::string &mutableString() {
+      static_cast<StringObject *>(payload.heap)->hash.store(0, std::memory_order_relaxed);
+      return strValue();
+    }
+    ListObject &listObject() const { return *static_cast<ListObject *>(payload.heap); }
+    Dict &dictValue() const { return static_cast<DictObject *>(payload.heap)->value; }
+    Set &setValue() const { return static_cast<SetObject *>(payload.heap)->value; }
+    const Range &rangeValue() const { return static_cast<RangeObject *>(payload.heap)->value; }
+    const BigInt &bigIntValue() const { return static_cast<BigIntObject *>(payload.heap)->value; }
+    const SliceObject &sliceValue() const { return *static_cast<SliceObject *>(payload.heap); }
+    // Defined after ViewObject
+    const ViewObject &viewValue() const;
+    GeneratorObject &generatorObject() const { return *static_cast<GeneratorObject *>(payload.heap); }
+    // New view of this dict
+    DynamicType viewOf(ViewKind kind) const;
+
+    /**
+     * Elements of a LIST or SLICE: `size` elements `stride` apart, starting
+     * at the first pointer of the storage alternative the list uses.
+     */
+    struct ListSpan {
+      std::size_t storage;
+      union {
+        const DynamicType *items;
+        const long long *ints;
+        const double *doubles;
+      };
+      std::ptrdiff_t stride;
+      std::size_t size;
+
+      DynamicType operator[](std::size_t index) const {
+        std::ptrdiff_t at = static_cast<std::ptrdiff_t>(index) * stride;
+        if (storage == ListObject::INTS) return DynamicType(ints[at]);
+        if (storage == ListObject::DOUBLES) return DynamicType(doubles[at]);
+        return items[at];
+      }
+    };
+    static ListSpan spanOf(const ListObject &list, long long start, long long step, std::size_t size);
+    // Position of the first element of a LIST or SLICE equal to item, or its size
+    std::size_t findItem(const DynamicType &item) const;
+    // Shared loop of minItem() and maxItem()
+    template <typename Less>
+    DynamicType extremeItem(const char *empty, Less less) const;
+    ListSpan listSpan() const {
+      if (type == Type::LIST) return spanOf(listObject(), 0, 1, listObject().size());
+      const SliceObject &slice = sliceValue();
+      return spanOf(*slice.source->list, slice.start, slice.step, slice.length);
+    }
+    // Turn a slice view into a list holding its own copy of the elements; called by list writes
+    void materialize();
+    // View of `length` items of this LIST or SLICE, at item first, first + step, ...
+    DynamicType sliceOf(long long first, long long step, std::size_t length) const;
+
+    // INT or BIGINT (bool is excluded, as in the int-only paths of the operators)
+    bool isIntegral() const { return type == Type::INT || type == Type::BIGINT; }
+    // Kinds that compare and hash as numbers: True == 1 == 1.0
+    bool isNumberLike() const { return isNumeric() || type == Type::BOOL; }
+    // Exact value of an INT, BIGINT or BOOL
+    BigInt toBigInt() const;
+
+    // Element at a position of a sequence (list, range or string); no bounds check
+    DynamicType itemAt(std::size_t index) const;
+
+    // One switch label per (lhs, rhs) tag combination, used by the inline operators
+    static constexpr int typePair(Type lhs, Type rhs) {
+      return (static_cast<int>(lhs) << 4) | static_cast<int>(rhs);
+    }
+
+    // Out-of-line slow paths of the operators: strings, collections, bools, big ints
+    // (including INT results that overflow 64 bits) and errors
+    DynamicType addSlow(const DynamicType &other) const;
+    DynamicType subSlow(const DynamicType &other) const;
+    DynamicType mulSlow(const DynamicType &other) const;
+    DynamicType divSlow(const DynamicType &other) const;
+    DynamicType modSlow(const DynamicType &other) const;
+    DynamicType floorDivSlow(const DynamicType &other) const;
+    bool equalsSlow(const DynamicType &other) const;
+    int compareSlow(const DynamicType &other) const;
+    // Exact order of an int, a bool or a big int against a double that is not
+    // NaN; converting the int to a double would round it
+    int compareWithDouble(double d) const;
+    // A NaN against any number, where every ordering is false
+    bool unorderedWith(const DynamicType &other) const;
+
   public:
     // Constructors
-    DynamicType() : value(std::monostate{}), type(Type::NONE) {}
+    DynamicType() : type(Type::NONE) { payload.i = 0; }
 
-    DynamicType(int val) : value(val), type(Type::INT) {}
+    DynamicType(int val) : type(Type::INT) { payload.i = val; }
 
-    DynamicType(double val) : value(val), type(Type::DOUBLE) {}
+    // Boxes a type-lowered `long long` local
+    DynamicType(long long val) : type(Type::INT) { payload.i = val; }
 
-    DynamicType(const std::string &val) : value(val), type(Type::STRING) {}
+    DynamicType(long val) : type(Type::INT) { payload.i = val; }
 
-    DynamicType(const char *val) : value(std::string(val)), type(Type::STRING) {}
+    // Stored as INT whenever the value fits in 64 bits
+    DynamicType(BigInt val);
 
-    DynamicType(bool val) : value(val), type(Type::BOOL) {}
+    DynamicType(double val) : type(Type::DOUBLE) { payload.d = val; }
 
-    DynamicType(const std::vector<DynamicType> &val) : value(val), type(Type::LIST) {}
+    // Strings and containers are taken by value and moved into the heap
+    // object, so temporaries (e.g. generated list literals) are never copied
+    DynamicType(std::string val) : type(Type::STRING) { payload.heap = new StringObject(std::move(val)); }
 
-    DynamicType(const std::map<std::string, DynamicType> &val) : value(val), type(Type::DICT) {}
+    DynamicType(const char *val) : type(Type::STRING) { payload.heap = new StringObject(val); }
 
-    DynamicType(const std::unordered_set<DynamicType> &val) : value(val), type(Type::SET) {}
-    
-    // Accept std::set but convert internally to unordered_set
-    DynamicType(const std::set<DynamicType> &val) : value(std::unordered_set<DynamicType>(val.begin(), val.end())), type(Type::SET) {}
+    DynamicType(bool val) : type(Type::BOOL) { payload.i = 0; payload.b = val; }
+
+    DynamicType(std::vector<DynamicType> val) : type(Type::LIST) { payload.heap = new ListObject(std::move(val)); }
+
+    DynamicType(Dict val);
+
+    DynamicType(Set val);
+
+    // Accept the standard sets too, converted to a Set
+    DynamicType(const std::unordered_set<DynamicType> &val) : DynamicType(Set(val.begin(), val.end())) {}
+
+    DynamicType(const std::set<DynamicType> &val) : DynamicType(Set(val.begin(), val.end())) {}
+
+    DynamicType(const Range &val) : type(Type::RANGE) { payload.heap = new RangeObject(val); }
+
+    // Copy and move: scalars are a plain 16-byte copy, heap payloads share one reference-counted object
+    DynamicType(const DynamicType &other) : payload(other.payload), type(other.type) {
+      if (isHeap()) ++payload.heap->refs;
+    }
+
+    DynamicType(DynamicType &&other) noexcept : payload(other.payload), type(other.type) {
+      other.type = Type::NONE;
+    }
+
+    DynamicType &operator=(const DynamicType &other) {
+      // Read other before releasing: it may live inside the collection this is about to free
+      Payload incoming = other.payload;
+      Type incomingType = other.type;
+      if (other.isHeap()) ++incoming.heap->refs;
+      if (isHeap()) release();
+      payload = incoming;
+      type = incomingType;
+      return *this;
+    }
+
+    DynamicType &operator=(DynamicType &&other) noexcept {
+      // Detach other first: it may live inside the collection this is about to release
+      Payload incoming = other.payload;
+      Type incomingType = other.type;
+      other.type = Type::NONE;
+      if (isHeap()) release();
+      payload = incoming;
+      type = incomingType;
+      return *this;
+    }
+
+    ~DynamicType() {
+      if (isHeap()) release();
+    }
+
+    /**
+     * Shared immutable string for a literal: every call with the same text
+     * returns a handle to one buffer whose hash is already computed, so equal
+     * literals and dict keys compare by pointer first. The table keeps a
+     * reference, so in-place appends always copy an interned string.
+     * Generated code hoists string literals into `static const` constants
+     * built with this.
+     */
+    static DynamicType intern(std::string_view text);
+
+    /**
+     * Generator owning a suspended coroutine frame; Generator.hpp calls this
+     * when a generator function or expression is called. The frame is
+     * destroyed with the last handle, whether or not it ran to the end.
+     */
+    static DynamicType generator(void *frame, bool (*resume)(void *frame, DynamicType &out),
+                                 void (*destroyFrame)(void *frame));
+
+    /**
+     * Run a generator to its next yield and store the value in out. A
+     * generator whose body raised is finished, as in Python.
+     * Python example: next(g)
+     * @return false, leaving out unchanged, once the generator is exhausted
+     * @throws std::runtime_error if not a generator, or what the body raises
+     */
+    bool nextItem(DynamicType &out) const;
+
+    /**
+     * Call body(begin, end) on pieces of [0, count), at most grain indices
+     * each, and return once every piece has run. In -DTRANSPYLER_PARALLEL
+     * builds the pieces are spread over a pool of worker threads, started by
+     * the first call and reused, plus the caller; idle threads steal work
+     * from busy ones, so pieces may cost very different times. Otherwise, and
+     * for loops started from inside a piece, the caller runs body(0, count).
+     * @throws the first exception a piece throws, after the others finish
+     */
+    template <typename Body>
+    static void parallelFor(std::size_t count, std::size_t grain, Body &&body) {
+      using Callable = std::remove_reference_t<Body>;
+      parallelRun(count, grain, &body, [](void *context, std::size_t begin, std::size_t end) {
+        (*static_cast<Callable *>(context))(begin, end);
+      });
+    }
+    /**
+     * Threads parallelFor() spreads work over, the caller included: the
+     * TRANSPYLER_THREADS environment variable if set, else the hardware
+     * threads; 1 without -DTRANSPYLER_PARALLEL.
+     */
+    static std::size_t parallelThreads();
+
+    /**
+     * Write the value to path in the runtime's binary format: a tag byte per
+     * value, a length before every string and collection, and the elements
+     * of a packed int or float list as one 8-byte aligned array. Floats are
+     * stored bit for bit and sets and dicts element by element, so load()
+     * gives back an equal value of the same types.
+     * Python example: save(table, "table.bin")
+     * @throws std::runtime_error if the file cannot be written, or for dict views and generators
+     */
+    void save(const std::string &path) const;
+    /**
+     * Read a value written by save(). The file is memory-mapped and packed
+     * lists keep their elements in the mapping, so loading a large numeric
+     * table costs no parsing and no copy: its pages are read as they are
+     * first touched. Strings, dicts and sets are built from the mapping.
+     * Python example: table = load("table.bin")
+     * @throws std::runtime_error if the file cannot be read or was not written by save()
+     */
+    static DynamicType load(const std::string &path);
 
-    ~DynamicType() = default;
+    /**
+     * Number of handles sharing this value's heap object (1 for scalars).
+     * Python example: sys.getrefcount(x), without the temporary reference
+     */
+    std::size_t refCount() const { return isHeap() ? payload.heap->refs : 1; }
 
     // Type checking
     /**
@@ -108,19 +854,51 @@ class DynamicType{
     bool isDouble() const { return type == Type::DOUBLE; }
     bool isString() const { return type == Type::STRING; }
     bool isBool() const { return type == Type::BOOL; }
-    bool isList() const { return type == Type::LIST; }
+    // Slice views are lists too
+    bool isList() const { return type == Type::LIST || type == Type::SLICE; }
     bool isDict() const { return type == Type::DICT; }
     bool isSet() const { return type == Type::SET; }
-    bool isNumeric() const { return type == Type::INT || type == Type::DOUBLE; }
+    bool isRange() const { return type == Type::RANGE; }
+    bool isBigInt() const { return type == Type::BIGINT; }
+    bool isView() const { return type == Type::VIEW; }
+    bool isGenerator() const { return type == Type::GENERATOR; }
+    // "dict_keys", "dict_values" or "dict_items"; only for views
+    const char *viewName() const;
+    // Values a for loop can walk
+    bool isIterable() const {
+      return isList() || type == Type::STRING || type == Type::DICT || type == Type::SET || type == Type::RANGE ||
+             type == Type::VIEW || type == Type::GENERATOR;
+    }
+    bool isNumeric() const { return type == Type::INT || type == Type::DOUBLE || type == Type::BIGINT; }
 
     // Type conversion helpers
-    int toInt() const;
+    // @throws std::runtime_error for a BIGINT, which does not fit a long long
+    long long toInt() const;
     double toDouble() const;
     std::string toString() const;
+    /**
+     * Append the text toString() returns to out, without building temporary
+     * strings; print() formats every argument straight into its buffer.
+     * Floats use Python's repr: the shortest digits that round-trip (0.1, 2.5,
+     * 1e+16).
+     */
+    void formatTo(std::string &out) const;
     bool toBool() const;
 
-    // Arithmetic operators
-    DynamicType operator+(const DynamicType &other) const;
+    // Arithmetic operators; int and double operands are handled inline (see below)
+    DynamicType operator+(const DynamicType &other) const &;
+    // Rvalue left operand (a + b + c, x = std::move(x) + y): a list or string
+    // that no other handle shares is extended in place instead of copied
+    DynamicType operator+(const DynamicType &other) &&;
+    /**
+     * Augmented addition. Python example: x += y
+     * A list is extended in place, so aliases see the change as in Python; a
+     * string is appended to in place only while no other handle shares it,
+     * so a loop accumulating into one string grows a single buffer
+     * geometrically, like a string builder, and is linear overall. The right
+     * operand is formatted straight into that buffer.
+     */
+    DynamicType &operator+=(const DynamicType &other);
     DynamicType operator-(const DynamicType &other) const;
     DynamicType operator*(const DynamicType &other) const;
     DynamicType operator/(const DynamicType &other) const;
@@ -128,6 +906,27 @@ class DynamicType{
     DynamicType pow(const DynamicType &exponent) const;
     DynamicType floor_div(const DynamicType &other) const;
 
+    /**
+     * Bitwise operators on ints and bools; union, intersection and symmetric
+     * difference on sets (a - b is their difference). Every element is
+     * hashed once: the result is sized up front and filled from the stored
+     * hashes of the operands.
+     * Python example: flags | mask, seen & wanted, a ^ b
+     * @throws std::runtime_error for other operand types
+     */
+    DynamicType operator|(const DynamicType &other) const;
+    DynamicType operator&(const DynamicType &other) const;
+    DynamicType operator^(const DynamicType &other) const;
+
+    /**
+     * Three-way comparison shared by the ordering operators.
+     * Python example: (a > b) - (a < b)
+     * @return Negative, zero or positive as this is less than, equivalent to
+     *         or greater than other. Lists compare element by element; values
+     *         of unrelated types are ordered by type so sets can hold them.
+     */
+    int compare(const DynamicType &other) const;
+
     // Comparison operators (needed for std::set<DynamicType>)
     bool operator==(const DynamicType &other) const;
     bool operator!=(const DynamicType &other) const;
@@ -149,6 +948,56 @@ class DynamicType{
     DynamicType &operator[](const size_t index);
     DynamicType &operator[](const std::string &key);
     DynamicType &operator[](const DynamicType &key);
+    /**
+     * Read an element without creating it: indexes lists, ranges and strings,
+     * looks up dict keys.
+     * Python example: lst[i], d[key]
+     * @throws std::runtime_error if the index is out of range or the key is missing
+     */
+    DynamicType getItem(const DynamicType &key) const;
+    /**
+     * Store an element: replaces a list element, or inserts or replaces a dict
+     * entry. Unlike operator[] this keeps a packed int or float list packed
+     * when the value has the same type.
+     * Python example: lst[i] = value, d[key] = value
+     * @throws std::runtime_error if the list index is out of range
+     */
+    void setItem(const DynamicType &key, const DynamicType &value);
+    /**
+     * Augmented element assignment, obj[key] += value, without unpacking a
+     * packed list.
+     * @throws std::runtime_error if the list index is out of range
+     */
+    void addToItem(const DynamicType &key, const DynamicType &value);
+    /**
+     * Sum, smallest and largest element of an iterable, walking packed lists
+     * as primitive arrays.
+     * Python example: sum(lst), min(lst), max(lst)
+     * @throws std::runtime_error if not iterable, or min/max of an empty one
+     */
+    DynamicType sumItems() const;
+    DynamicType minItem() const;
+    DynamicType maxItem() const;
+
+    /**
+     * Number of elements of a string or collection.
+     * Python example: len(x)
+     * @throws std::runtime_error for scalars and generators
+     */
+    std::size_t size() const;
+    // size() where it is known, 0 for generators and scalars; sizes reserve() ahead of a loop
+    std::size_t lengthHint() const;
+
+    /**
+     * Iteration protocol used by generated for-loops; nothing is copied up
+     * front. Lists and strings are walked in place by position (so appending
+     * inside the loop is safe), ranges compute each element, dicts, sets and
+     * dict views walk their table and generators are resumed once per step.
+     * Python example: for x in value
+     * @throws std::runtime_error if not iterable
+     */
+    Iterator begin() const;
+    IterationEnd end() const { return IterationEnd(); }
 
     // Output stream
     friend std::ostream &operator<<(std::ostream &os, const DynamicType &dt) {
@@ -159,27 +1008,100 @@ class DynamicType{
     // Collection getters
     // Non-const accessors (mutation allowed)
     std::vector<DynamicType>& getList();
-    std::map<std::string, DynamicType>& getDict();
-    std::unordered_set<DynamicType>& getSet();
-    // Const accessors (read-only)
+    Dict& getDict();
+    Set& getSet();
+    // Const accessors (read-only); getList() const needs a LIST, as a slice view owns no vector
     const std::vector<DynamicType>& getList() const;
-    const std::map<std::string, DynamicType>& getDict() const;
-    const std::unordered_set<DynamicType>& getSet() const;
+    const Dict& getDict() const;
+    const Set& getSet() const;
 
     // Lists methods
     void append(const DynamicType &item);
+    void append(DynamicType &&item);
+    /**
+     * Append every element of an iterable.
+     * Python example: lst.extend(other)
+     * @throws std::runtime_error if not a list or other is not iterable
+     */
+    void extend(const DynamicType &items);
+    /**
+     * Construct a new last element of a list in place and return it.
+     * C++ builder for lists: result.emplace(std::string("x"))
+     */
+    template <typename... Args>
+    DynamicType &emplace(Args &&...args) {
+      return getList().emplace_back(std::forward<Args>(args)...);
+    }
     void remove(size_t index);
     /**
-     * Get a sublist from start to end (exclusive).
+     * Remove and return the last element of a list, in O(1).
+     * Python example: lst.pop()
+     * @throws std::runtime_error if not a list, or the list is empty
+     */
+    DynamicType pop();
+    /**
+     * Remove and return a list element, or the value of a dict key. A negative
+     * index counts from the end. The elements on the nearer side of the index
+     * are moved, so popping the first or the last element is O(1) amortized.
+     * Python example: lst.pop(0), lst.pop(-2), d.pop(key)
+     * @throws std::runtime_error if the index is out of range or the key is missing
+     */
+    DynamicType pop(const DynamicType &key);
+    /**
+     * Remove and return the value of a dict key, or fallback when it is missing.
+     * Python example: d.pop(key, None)
+     * @throws std::runtime_error if not a dict
+     */
+    DynamicType pop(const DynamicType &key, const DynamicType &fallback);
+    /**
+     * Insert item before index. A negative index counts from the end and an
+     * out-of-range one is clamped, as in Python; inserting at the front or the
+     * back is O(1) amortized.
+     * Python example: lst.insert(0, x)
+     * @throws std::runtime_error if not a list
+     */
+    void insert(const DynamicType &index, const DynamicType &item);
+    /**
+     * Capacity hint: make room for `additional` more elements, so the next
+     * appends do not reallocate. Generated code calls it before a loop that
+     * appends once per iteration and whose trip count is known. Ignored when
+     * additional is not positive or this is not a list.
+     * C++ example: result.reserve(n)
+     */
+    void reserve(long long additional);
+    /**
+     * Capacity hint for a counting loop whose counter is a DynamicType: room
+     * for high - low more elements (one more when inclusive) if both are
+     * ints. Other values are ignored rather than reported, since the loop
+     * may not run at all.
+     * C++ example: result.reserve(i, n)
+     */
+    void reserve(const DynamicType &low, const DynamicType &high, bool inclusive = false);
+    /**
+     * Slice a list or string with Python's rules: a NONE bound is an omitted
+     * one, negative bounds count from the end and out-of-range bounds are
+     * clamped. A list slice is a view sharing the list's elements, so reading,
+     * iterating and len() never copy; it becomes a list of its own on its
+     * first write, and later writes to the list do not show through it.
+     * Python example: lst[mid:], lst[::-1], s[1:-1]
+     * @param start First index (NONE: the start, or the end for a negative step)
+     * @param stop Index to stop before (NONE: past the last element)
+     * @param step Stride (NONE: 1)
+     * @return DynamicType containing the slice
+     * @throws std::runtime_error if not a list or string, or step is zero
+     */
+    DynamicType slice(const DynamicType &start, const DynamicType &stop, const DynamicType &step = DynamicType()) const;
+    /**
+     * Get a sublist from start to end (exclusive), as a view like slice().
      * Python example: lst[2:5]
      * @param start Starting index
      * @param end Ending index (exclusive)
      * @return DynamicType containing the sublist
      * @throws std::runtime_error if not a list or indices are out of range
      */
-    DynamicType sublist(size_t start, size_t end);
+    DynamicType sublist(size_t start, size_t end) const;
     /**
-     * Get a sublist from start to end (exclusive) with a step.
+     * Get a sublist from start to end (exclusive) with a step, as a view like slice().
      * Python example: lst[2:10:2]
      * @param start Starting index
      * @param end Ending index (exclusive)
@@ -187,50 +1109,70 @@ class DynamicType{
      * @return DynamicType containing the sublist
      * @throws std::runtime_error if not a list or indices are out of range
      */
-    DynamicType sublist(size_t start, size_t end, size_t step);
+    DynamicType sublist(size_t start, size_t end, size_t step) const;
     
     // DynamicType wrapper overloads for sublist
-    DynamicType sublist(const DynamicType& start, const DynamicType& end) {
+    DynamicType sublist(const DynamicType& start, const DynamicType& end) const {
       return sublist(static_cast<size_t>(start.toInt()), static_cast<size_t>(end.toInt()));
     }
-    DynamicType sublist(const DynamicType& start, const DynamicType& end, const DynamicType& step) {
+    DynamicType sublist(const DynamicType& start, const DynamicType& end, const DynamicType& step) const {
       return sublist(static_cast<size_t>(start.toInt()), static_cast<size_t>(end.toInt()), static_cast<size_t>(step.toInt()));
     }
 
-    // Dict methods
+    // Dict methods; string overloads look keys up without allocating
     void remove(const std::string &key);
     void set(const std::string &key, const DynamicType &value);
-    void set(const DynamicType &key, const DynamicType &value) { set(key.toString(), value); }
+    void set(const DynamicType &key, const DynamicType &value);
     DynamicType get(const std::string &key) const;
-    DynamicType get(const DynamicType &key) const { return get(key.toString()); }
+    DynamicType get(const DynamicType &key) const;
     void removeKey(const std::string &key) { remove(key); }
-    void removeKey(const DynamicType &key) { remove(key.toString()); }
-    /**
-     * Get all keys from dictionary as a list.
-     * Python example: my_dict.keys()
-     * @return DynamicType containing list of keys as strings
-     * @throws std::runtime_error if not a dict
-    */
-    DynamicType keys() const;
+    void removeKey(const DynamicType &key);
     /**
-     * Get all values from dictionary as a list.
-     * Python example: my_dict.values()
-     * @return DynamicType containing list of values
+     * Views of a dictionary's keys, values or (key, value) pairs, in
+     * insertion order. A view copies nothing: it holds a reference to the
+     * dict and reads it as it is iterated, so it reflects later changes and
+     * streaming through a large dict takes no extra memory. Views have a
+     * len(), support `in`, print as dict_keys([...]) and so on, and compare
+     * by identity; an items view iterated with `for k, v in d.items()` never
+     * builds the pairs.
+     * Python example: my_dict.keys(), my_dict.values(), my_dict.items()
      * @throws std::runtime_error if not a dict
      */
+    DynamicType keys() const;
     DynamicType values() const;
-    /**
-     * Get all key-value pairs from dictionary as a list of lists.
-     * Python example: my_dict.items()
-     * Each item is a 2-element list [key, value]
-     * @return DynamicType containing list of [key, value] pairs
-     * @throws std::runtime_error if not a dict
-     */
     DynamicType items() const;
     
     // List methods
     void removeAt(size_t index) { remove(index); }
-    void removeAt(const DynamicType &index) { remove(static_cast<size_t>(index.toInt())); }
+    void removeAt(const DynamicType &index) { pop(index); }
+    /**
+     * Position of the first element equal to item, or of the first occurrence
+     * of a substring.
+     * Python example: lst.index(x), s.index(sub)
+     * @throws std::runtime_error if not found, or not a list or string
+     */
+    DynamicType index(const DynamicType &item) const;
+    /**
+     * Number of elements equal to item, or of non-overlapping occurrences of
+     * a substring.
+     * Python example: lst.count(x), s.count(sub)
+     * @throws std::runtime_error if not a list or string
+     */
+    DynamicType count(const DynamicType &item) const;
+    /**
+     * Concatenate the strings of an iterable with this string between them.
+     * The total length is added up first, so the result is allocated once.
+     * Python example: ", ".join(fields)
+     * @throws std::runtime_error if not a string, or an element is not a string
+     */
+    DynamicType join(const DynamicType &items) const;
+    /**
+     * Sort a list in place in ascending order. Packed int and float lists are
+     * sorted as primitive arrays; other lists use a stable sort with <.
+     * Python example: lst.sort()
+     * @throws std::runtime_error if not a list, or elements are not comparable
+     */
+    void sort();
     
     // Dict, List common methods  
     bool contains(const DynamicType& key) const;
@@ -238,6 +1180,430 @@ class DynamicType{
     // Set operations
     void add(const DynamicType &item);
     void remove(const DynamicType &item);
+    /**
+     * Set algebra with any iterable as the argument, as in Python; a list or
+     * range argument is hashed into a set first. The in-place forms walk the
+     * smaller of the two sets.
+     * Python example: a.union(b), a.intersection(b), a.difference(b),
+     * a.symmetric_difference(b); a.update(b), a.intersection_update(b),
+     * a.difference_update(b), a.symmetric_difference_update(b)
+     * @throws std::runtime_error if not a set, or other is not iterable
+     */
+    DynamicType union_(const DynamicType &other) const;
+    DynamicType intersection(const DynamicType &other) const;
+    DynamicType difference(const DynamicType &other) const;
+    DynamicType symmetric_difference(const DynamicType &other) const;
+    void update(const DynamicType &other);
+    void intersection_update(const DynamicType &other);
+    void difference_update(const DynamicType &other);
+    void symmetric_difference_update(const DynamicType &other);
+};
+
+struct DynamicType::Dict::Entry {
+  DynamicType key;
+  DynamicType value;
+  std::size_t hash;
+  bool live;
+};
+
+class DynamicType::Dict::const_iterator {
+  public:
+    const_iterator(const Entry *pos, const Entry *last) : pos(pos), last(last) { skipDead(); }
+
+    const Entry &operator*() const { return *pos; }
+    const Entry *operator->() const { return pos; }
+    const_iterator &operator++() {
+      ++pos;
+      skipDead();
+      return *this;
+    }
+    bool operator!=(const const_iterator &other) const { return pos != other.pos; }
+
+  private:
+    void skipDead() {
+      while (pos != last && !pos->live) ++pos;
+    }
+
+    const Entry *pos;
+    const Entry *last;
+};
+
+inline DynamicType::Dict::const_iterator DynamicType::Dict::begin() const {
+  return const_iterator(entries.data(), entries.data() + entries.size());
+}
+
+inline DynamicType::Dict::const_iterator DynamicType::Dict::end() const {
+  return const_iterator(entries.data() + entries.size(), entries.data() + entries.size());
+}
+
+struct DynamicType::Set::Slot {
+  DynamicType item;
+  std::size_t hash;
+};
+
+class DynamicType::Set::const_iterator {
+  public:
+    const_iterator(const std::int8_t *control, const Slot *pos, const Slot *last) : control(control), pos(pos), last(last) {
+      skipFree();
+    }
+
+    const DynamicType &operator*() const { return pos->item; }
+    const DynamicType *operator->() const { return &pos->item; }
+    // Hash of the current element, as stored in its slot
+    std::size_t hash() const { return pos->hash; }
+    const_iterator &operator++() {
+      ++control;
+      ++pos;
+      skipFree();
+      return *this;
+    }
+    bool operator!=(const const_iterator &other) const { return pos != other.pos; }
+
+  private:
+    // EMPTY and DELETED are the negative control bytes
+    void skipFree() {
+      while (pos != last && *control < 0) {
+        ++control;
+        ++pos;
+      }
+    }
+
+    const std::int8_t *control;
+    const Slot *pos;
+    const Slot *last;
 };
 
+inline DynamicType::Set::const_iterator DynamicType::Set::begin() const {
+  return const_iterator(control.data(), slots.data(), slots.data() + slots.size());
+}
+
+inline DynamicType::Set::const_iterator DynamicType::Set::end() const {
+  return const_iterator(control.data() + control.size(), slots.data() + slots.size(), slots.data() + slots.size());
+}
+
+inline std::size_t DynamicType::Dict::liveFrom(std::size_t position) const {
+  while (position < entries.size() && !entries[position].live) ++position;
+  return position;
+}
+
+inline std::size_t DynamicType::Set::liveFrom(std::size_t position) const {
+  // EMPTY and DELETED are the negative control bytes
+  while (position < slots.size() && control[position] < 0) ++position;
+  return position;
+}
+
+inline const DynamicType &DynamicType::Set::itemAt(std::size_t position) const { return slots[position].item; }
+
+struct DynamicType::ViewObject : HeapObject {
+  DynamicType dict;
+  ViewKind kind;
+};
+
+inline const DynamicType::ViewObject &DynamicType::viewValue() const {
+  return *static_cast<const ViewObject *>(payload.heap);
+}
+
+/**
+ * Forward iterator over a DynamicType. It keeps its own handle on the
+ * iterated value, so rebinding the loop's source variable does not end the
+ * loop early. Sequences re-read their length on every step; dicts, sets and
+ * dict views are walked by position in their table and fail if their size
+ * changes, as in Python; generators are resumed once per step.
+ */
+class DynamicType::Iterator {
+  public:
+    explicit Iterator(DynamicType source)
+        : source(std::move(source)), index(0), expected(0), mode(modeOf(this->source.type)), done(false) {
+      if (mode != Mode::SEQUENCE) start();
+    }
+
+    DynamicType operator*() const { return mode == Mode::SEQUENCE ? source.itemAt(index) : current(); }
+    Iterator &operator++() {
+      ++index;
+      if (mode != Mode::SEQUENCE) advance();
+      return *this;
+    }
+    bool operator!=(IterationEnd) const { return mode == Mode::SEQUENCE ? index < source.size() : !done; }
+
+    /**
+     * Element `position` of the current item, which must hold exactly `count`
+     * elements: the targets of `for k, v in pairs`. The pairs of an items
+     * view are read straight from the dict.
+     * @throws std::runtime_error if the item is not a sequence of `count` elements
+     */
+    DynamicType unpack(std::size_t position, std::size_t count) const;
+
+  private:
+    enum class Mode : std::uint8_t { SEQUENCE, TABLE, GENERATOR };
+    static Mode modeOf(Type type) {
+      if (type == Type::DICT || type == Type::SET || type == Type::VIEW) return Mode::TABLE;
+      return type == Type::GENERATOR ? Mode::GENERATOR : Mode::SEQUENCE;
+    }
+    // First element of a table or generator
+    void start();
+    // Next live table position, or the generator's next value
+    void advance();
+    DynamicType current() const;
+
+    DynamicType source;
+    // Sequence index, or position in the dict's entries or the set's slots
+    std::size_t index;
+    // Size of the table when the loop started
+    std::size_t expected;
+    // Last value a generator yielded
+    DynamicType value;
+    Mode mode;
+    bool done;
+};
+
+inline DynamicType::Iterator DynamicType::begin() const {
+  if (!isIterable()) runtime_fail("Type is not iterable");
+  return Iterator(*this);
+}
+
+/**
+ * Python numeric semantics on native values, shared by DynamicType and by
+ * generated code whose locals were lowered to long long / double:
+ * floor division rounds toward negative infinity and the remainder takes
+ * the sign of the divisor.
+ */
+inline double py_truediv(double a, double b) {
+  if (b == 0.0) runtime_fail("Division by zero");
+  return a / b;
+}
+
+inline long long py_floordiv(long long a, long long b) {
+  if (b == 0) runtime_fail("Floor division by zero");
+  long long q = a / b;
+  if (a % b != 0 && ((a < 0) != (b < 0))) --q;
+  return q;
+}
+
+inline double py_floordiv(double a, double b) {
+  if (b == 0.0) runtime_fail("Floor division by zero");
+  return std::floor(a / b);
+}
+
+inline long long py_mod(long long a, long long b) {
+  if (b == 0) runtime_fail("Modulo by zero");
+  // LLONG_MIN % -1 traps on some targets; the result is always 0
+  if (b == -1) return 0;
+  long long r = a % b;
+  if (r != 0 && ((r < 0) != (b < 0))) r += b;
+  return r;
+}
+
+inline double py_mod(double a, double b) {
+  if (b == 0.0) runtime_fail("Modulo by zero");
+  double r = std::fmod(a, b);
+  if (r != 0.0 && ((r < 0) != (b < 0))) r += b;
+  return r;
+}
+
+/**
+ * Overflow-checked 64-bit arithmetic: store a op b in result and return
+ * true if the exact result does not fit. GCC and Clang compile these to the
+ * native operation plus a branch on the overflow flag.
+ */
+inline bool add_overflow(long long a, long long b, long long &result) {
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_add_overflow(a, b, &result);
+#else
+  if ((b > 0 && a > LLONG_MAX - b) || (b < 0 && a < LLONG_MIN - b)) return true;
+  result = a + b;
+  return false;
+#endif
+}
+
+inline bool sub_overflow(long long a, long long b, long long &result) {
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_sub_overflow(a, b, &result);
+#else
+  if ((b < 0 && a > LLONG_MAX + b) || (b > 0 && a < LLONG_MIN + b)) return true;
+  result = a - b;
+  return false;
+#endif
+}
+
+inline bool mul_overflow(long long a, long long b, long long &result) {
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_mul_overflow(a, b, &result);
+#else
+  if (a > 0 ? (b > 0 ? a > LLONG_MAX / b : b < LLONG_MIN / a)
+            : (b > 0 ? a < LLONG_MIN / b : (a != 0 && b < LLONG_MAX / a))) {
+    return true;
+  }
+  result = a * b;
+  return false;
+#endif
+}
+
+/**
+ * Exact three-way comparison of an int and a double that is not NaN, as in
+ * Python: 2**53 + 1 > 2.0**53, although the int rounds to that double.
+ */
+inline int compare_int_double(long long i, double d) {
+  // Doubles of magnitude 2**63 and more are past every long long
+  if (d >= 9223372036854775808.0) return -1;
+  if (d < -9223372036854775808.0) return 1;
+  long long whole = static_cast<long long>(d);
+  if (i != whole) return (i > whole) - (i < whole);
+  // Same integer part: the fraction the cast dropped decides
+  double fraction = d - static_cast<double>(whole);
+  return (fraction < 0) - (fraction > 0);
+}
+
+/**
+ * Inline fast paths of the arithmetic and comparison operators. Generated
+ * code does most of its arithmetic on ints and doubles, so those tag pairs
+ * are a switch plus a native operation that the compiler can inline at the
+ * call site; every other combination falls through to the out-of-line slow
+ * path in DynamicType.cpp. Int results are overflow-checked and promoted to
+ * a BigInt by the slow path when they do not fit in 64 bits.
+ */
+inline DynamicType DynamicType::operator+(const DynamicType &other) const & {
+  TRANSPYLER_PROFILE_OP(ADD, type, other.type);
+  switch (typePair(type, other.type)) {
+    case typePair(Type::INT, Type::INT): {
+      long long result;
+      if (!add_overflow(payload.i, other.payload.i, result)) return DynamicType(result);
+      return addSlow(other);
+    }
+    case typePair(Type::DOUBLE, Type::DOUBLE): return DynamicType(payload.d + other.payload.d);
+    case typePair(Type::INT, Type::DOUBLE): return DynamicType(payload.i + other.payload.d);
+    case typePair(Type::DOUBLE, Type::INT): return DynamicType(payload.d + other.payload.i);
+    default: return addSlow(other);
+  }
+}
+
+inline DynamicType DynamicType::operator-(const DynamicType &other) const {
+  TRANSPYLER_PROFILE_OP(SUB, type, other.type);
+  switch (typePair(type, other.type)) {
+    case typePair(Type::INT, Type::INT): {
+      long long result;
+      if (!sub_overflow(payload.i, other.payload.i, result)) return DynamicType(result);
+      return subSlow(other);
+    }
+    case typePair(Type::DOUBLE, Type::DOUBLE): return DynamicType(payload.d - other.payload.d);
+    case typePair(Type::INT, Type::DOUBLE): return DynamicType(payload.i - other.payload.d);
+    case typePair(Type::DOUBLE, Type::INT): return DynamicType(payload.d - other.payload.i);
+    default: return subSlow(other);
+  }
+}
+
+inline DynamicType DynamicType::operator*(const DynamicType &other) const {
+  TRANSPYLER_PROFILE_OP(MUL, type, other.type);
+  switch (typePair(type, other.type)) {
+    case typePair(Type::INT, Type::INT): {
+      long long result;
+      if (!mul_overflow(payload.i, other.payload.i, result)) return DynamicType(result);
+      return mulSlow(other);
+    }
+    case typePair(Type::DOUBLE, Type::DOUBLE): return DynamicType(payload.d * other.payload.d);
+    case typePair(Type::INT, Type::DOUBLE): return DynamicType(payload.i * other.payload.d);
+    case typePair(Type::DOUBLE, Type::INT): return DynamicType(payload.d * other.payload.i);
+    default: return mulSlow(other);
+  }
+}
+
+inline DynamicType DynamicType::operator/(const DynamicType &other) const {
+  TRANSPYLER_PROFILE_OP(DIV, type, other.type);
+  switch (typePair(type, other.type)) {
+    case typePair(Type::INT, Type::INT):
+      return DynamicType(py_truediv(static_cast<double>(payload.i), static_cast<double>(other.payload.i)));
+    case typePair(Type::DOUBLE, Type::DOUBLE): return DynamicType(py_truediv(payload.d, other.payload.d));
+    default: return divSlow(other);
+  }
+}
+
+inline DynamicType DynamicType::operator%(const DynamicType &other) const {
+  TRANSPYLER_PROFILE_OP(MOD, type, other.type);
+  switch (typePair(type, other.type)) {
+    case typePair(Type::INT, Type::INT): return DynamicType(py_mod(payload.i, other.payload.i));
+    case typePair(Type::DOUBLE, Type::DOUBLE): return DynamicType(py_mod(payload.d, other.payload.d));
+    default: return modSlow(other);
+  }
+}
+
+inline DynamicType DynamicType::floor_div(const DynamicType &other) const {
+  TRANSPYLER_PROFILE_OP(FLOOR_DIV, type, other.type);
+  switch (typePair(type, other.type)) {
+    case typePair(Type::INT, Type::INT):
+      // LLONG_MIN // -1 overflows; the slow path promotes it
+      if (other.payload.i == -1) return floorDivSlow(other);
+      return DynamicType(py_floordiv(payload.i, other.payload.i));
+    case typePair(Type::DOUBLE, Type::DOUBLE): return DynamicType(py_floordiv(payload.d, other.payload.d));
+    default: return floorDivSlow(other);
+  }
+}
+
+inline bool DynamicType::operator==(const DynamicType &other) const {
+  TRANSPYLER_PROFILE_OP(EQ, type, other.type);
+  switch (typePair(type, other.type)) {
+    case typePair(Type::INT, Type::INT): return payload.i == other.payload.i;
+    case typePair(Type::DOUBLE, Type::DOUBLE): return payload.d == other.payload.d;
+    case typePair(Type::INT, Type::DOUBLE):
+      return !std::isnan(other.payload.d) && compare_int_double(payload.i, other.payload.d) == 0;
+    case typePair(Type::DOUBLE, Type::INT):
+      return !std::isnan(payload.d) && compare_int_double(other.payload.i, payload.d) == 0;
+    case typePair(Type::STRING, Type::STRING):
+      // Interned literals and copies share one buffer
+      return payload.heap == other.payload.heap || strValue() == other.strValue();
+    default: return equalsSlow(other);
+  }
+}
+
+inline bool DynamicType::operator!=(const DynamicType &other) const { return !(*this == other); }
+
+inline int DynamicType::compare(const DynamicType &other) const {
+  switch (typePair(type, other.type)) {
+    case typePair(Type::INT, Type::INT): return (payload.i > other.payload.i) - (payload.i < other.payload.i);
+    case typePair(Type::DOUBLE, Type::DOUBLE): return (payload.d > other.payload.d) - (payload.d < other.payload.d);
+    // NaN is unordered; compare() reports it as equivalent
+    case typePair(Type::INT, Type::DOUBLE):
+      return std::isnan(other.payload.d) ? 0 : compare_int_double(payload.i, other.payload.d);
+    case typePair(Type::DOUBLE, Type::INT):
+      return std::isnan(payload.d) ? 0 : -compare_int_double(other.payload.i, payload.d);
+    default: return compareSlow(other);
+  }
+}
+
+inline bool DynamicType::unorderedWith(const DynamicType &other) const {
+  return (type == Type::DOUBLE && std::isnan(payload.d) && other.isNumberLike()) ||
+         (other.type == Type::DOUBLE && std::isnan(other.payload.d) && isNumberLike());
+}
+
+// Each ordering operator is one dispatch. Doubles compare directly so that
+// NaN is unordered, as in Python; a NaN against an int, a bool or a big int
+// is unordered too, which compare() cannot express.
+inline bool DynamicType::operator<(const DynamicType &other) const {
+  TRANSPYLER_PROFILE_OP(LT, type, other.type);
+  if (type == Type::DOUBLE && other.type == Type::DOUBLE) return payload.d < other.payload.d;
+  if (unorderedWith(other)) return false;
+  return compare(other) < 0;
+}
+
+inline bool DynamicType::operator<=(const DynamicType &other) const {
+  TRANSPYLER_PROFILE_OP(LE, type, other.type);
+  if (type == Type::DOUBLE && other.type == Type::DOUBLE) return payload.d <= other.payload.d;
+  if (unorderedWith(other)) return false;
+  return compare(other) <= 0;
+}
+
+inline bool DynamicType::operator>(const DynamicType &other) const {
+  TRANSPYLER_PROFILE_OP(GT, type, other.type);
+  if (type == Type::DOUBLE && other.type == Type::DOUBLE) return payload.d > other.payload.d;
+  if (unorderedWith(other)) return false;
+  return compare(other) > 0;
+}
+
+inline bool DynamicType::operator>=(const DynamicType &other) const {
+  TRANSPYLER_PROFILE_OP(GE, type, other.type);
+  if (type == Type::DOUBLE && other.type == Type::DOUBLE) return payload.d >= other.payload.d;
+  if (unorderedWith(other)) return false;
+  return compare(other) >= 0;
+}
+
+static_assert(sizeof(DynamicType) == 16, "DynamicType must stay a tag plus an 8-byte payload");
+
 #endif // DYNAMIC_TYPE_HPP
@@ -0,0 +1,71 @@
+// Copyright (c) 2025 Andres Quesada, David Obando, Randy Aguero
+#ifndef GENERATOR_HPP
+#define GENERATOR_HPP
+
+/**
+ * Generator functions and generator expressions as C++20 coroutines.
+ *
+ * Any function or lambda returning DynamicType whose body uses co_yield is a
+ * generator: calling it allocates the coroutine frame and returns a GENERATOR
+ * value without running the body. Each next() or for loop step resumes the
+ * frame up to the next co_yield, which moves the value straight into the
+ * iterator, so a generator holds one element at a time however long it runs.
+ *
+ * The generated code includes this header only when the program yields; the
+ * rest of the runtime is plain C++17 and reaches the frame through the
+ * function pointers stored in the GENERATOR value.
+ */
+#if !defined(__cpp_impl_coroutine)
+#error "Generators need C++20 coroutines: compile with -std=c++20"
+#endif
+
+#include "DynamicType.hpp"
+#include <coroutine>
+
+namespace transpyler_generator {
+
+  struct Promise {
+    using Handle = std::coroutine_handle<Promise>;
+
+    // Where the next co_yield stores its value, set by each resume
+    DynamicType *out = nullptr;
+
+    DynamicType get_return_object() {
+      return DynamicType::generator(Handle::from_promise(*this).address(), &resume, &release);
+    }
+
+    // Lazy: the body starts on the first next(); the frame outlives the last
+    // co_yield so done() can be checked before it is destroyed
+    std::suspend_always initial_suspend() noexcept { return {}; }
+    std::suspend_always final_suspend() noexcept { return {}; }
+
+    std::suspend_always yield_value(DynamicType value) {
+      *out = std::move(value);
+      return {};
+    }
+
+    void return_void() {}
+
+    // Reaches the caller of next(); the generator is finished from then on
+    void unhandled_exception() { throw; }
+
+    static bool resume(void *frame, DynamicType &value) {
+      Handle handle = Handle::from_address(frame);
+      handle.promise().out = &value;
+      handle.resume();
+      return !handle.done();
+    }
+
+    static void release(void *frame) {
+      Handle::from_address(frame).destroy();
+    }
+  };
+
+} // namespace transpyler_generator
+
+template <typename... Args>
+struct std::coroutine_traits<DynamicType, Args...> {
+  using promise_type = transpyler_generator::Promise;
+};
+
+#endif // GENERATOR_HPP
@@ -0,0 +1,158 @@
+// Copyright (c) 2025 Andres Quesada, David Obando, Randy Aguero
+#ifndef PROFILE_HPP
+#define PROFILE_HPP
+
+/**
+ * Runtime profiling counters, compiled in with -DTRANSPYLER_PROFILE; every
+ * hook below is a no-op otherwise.
+ *
+ * The runtime counts the operator dispatches per operation and (lhs, rhs)
+ * type pair, and per type the deep copies of collections, packed lists
+ * unpacked to DynamicType items and toString() conversions, plus heap object
+ * allocations and raised exceptions. Functions transpiled with --profile time
+ * themselves with TRANSPYLER_PROFILE_FUNCTION, giving calls, total and self
+ * time per Python function.
+ *
+ * The report goes to stderr when the program exits, also when an uncaught
+ * exception ends it: a table, or JSON with TRANSPYLER_PROFILE_FORMAT=json.
+ * TRANSPYLER_PROFILE_OUTPUT=path writes it to a file instead.
+ */
+#ifdef TRANSPYLER_PROFILE
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace transpyler_profile {
+
+  enum class Op : std::uint8_t { ADD, INPLACE_ADD, SUB, MUL, DIV, MOD, FLOOR_DIV, POW, NEG, EQ, LT, LE, GT, GE, COUNT };
+  enum class Event : std::uint8_t { DEEP_COPY, UNPACK, TO_STRING, COUNT };
+
+  // DynamicType::Type tags fit in 4 bits (see DynamicType::typePair)
+  constexpr std::size_t TYPES = 16;
+  constexpr std::size_t OPS = static_cast<std::size_t>(Op::COUNT);
+  constexpr std::size_t EVENTS = static_cast<std::size_t>(Event::COUNT);
+
+  // Relaxed atomics: the parallel list kernels dispatch from worker threads
+  struct Counters {
+    std::atomic<std::uint64_t> dispatches[OPS][TYPES][TYPES];
+    std::atomic<std::uint64_t> events[EVENTS][TYPES];
+    std::atomic<std::uint64_t> allocations;
+    std::atomic<std::uint64_t> allocatedBytes;
+    std::atomic<std::uint64_t> exceptions;
+  };
+  inline Counters counters;
+
+  inline void dispatch(Op op, int lhs, int rhs) {
+    counters.dispatches[static_cast<std::size_t>(op)][lhs][rhs].fetch_add(1, std::memory_order_relaxed);
+  }
+
+  inline void count(Event event, int type) {
+    counters.events[static_cast<std::size_t>(event)][type].fetch_add(1, std::memory_order_relaxed);
+  }
+
+  inline void allocation(std::size_t bytes) {
+    counters.allocations.fetch_add(1, std::memory_order_relaxed);
+    counters.allocatedBytes.fetch_add(bytes, std::memory_order_relaxed);
+  }
+
+  /**
+   * Calls and time of one transpiled function. Instances are function-local
+   * statics that link themselves into a list for the report. Functions also
+   * run on parallel_map() workers, so the counts are relaxed atomics and
+   * every thread times its own calls.
+   */
+  struct FunctionStats {
+    const char *name;
+    std::atomic<std::uint64_t> calls{0};
+    // Wall time of the outermost active calls on each thread, so recursion is not counted twice
+    std::atomic<std::uint64_t> totalNs{0};
+    // Time not spent in other timed functions
+    std::atomic<std::uint64_t> selfNs{0};
+    // Slot of the function in each thread's count of active calls
+    std::size_t id;
+    FunctionStats *next;
+
+    explicit FunctionStats(const char *name);
+  };
+  inline std::atomic<FunctionStats *> registeredFunctions{nullptr};
+  inline std::atomic<std::size_t> registeredCount{0};
+
+  // A function may first run on a worker thread, so registering is a lock-free push
+  inline FunctionStats::FunctionStats(const char *name)
+      : name(name), id(registeredCount.fetch_add(1, std::memory_order_relaxed)),
+        next(registeredFunctions.load(std::memory_order_relaxed)) {
+    while (!registeredFunctions.compare_exchange_weak(next, this, std::memory_order_release, std::memory_order_relaxed)) {
+    }
+  }
+
+  // Times the enclosing function call and charges it to the caller's child time
+  class FunctionTimer {
+    public:
+      explicit FunctionTimer(FunctionStats &stats) : stats(stats), parent(current), start(now()) {
+        stats.calls.fetch_add(1, std::memory_order_relaxed);
+        ++active(stats);
+        current = this;
+      }
+
+      ~FunctionTimer() {
+        std::uint64_t elapsed = now() - start;
+        stats.selfNs.fetch_add(elapsed - childNs, std::memory_order_relaxed);
+        if (--active(stats) == 0) stats.totalNs.fetch_add(elapsed, std::memory_order_relaxed);
+        if (parent != nullptr) parent->childNs += elapsed;
+        current = parent;
+      }
+
+      FunctionTimer(const FunctionTimer &) = delete;
+      FunctionTimer &operator=(const FunctionTimer &) = delete;
+
+    private:
+      static std::uint64_t now() {
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+      }
+
+      // Calls of a function active on this thread
+      static unsigned &active(const FunctionStats &stats) {
+        if (stats.id >= activeCalls.size()) activeCalls.resize(stats.id + 1);
+        return activeCalls[stats.id];
+      }
+
+      inline static thread_local FunctionTimer *current = nullptr;
+      inline static thread_local std::vector<unsigned> activeCalls;
+
+      FunctionStats &stats;
+      FunctionTimer *parent;
+      std::uint64_t start;
+      std::uint64_t childNs = 0;
+  };
+
+  // Write the report once; called at exit and before an uncaught exception aborts
+  void report();
+
+}  // namespace transpyler_profile
+
+#define TRANSPYLER_PROFILE_OP(op, lhs, rhs) \
+  ::transpyler_profile::dispatch(::transpyler_profile::Op::op, static_cast<int>(lhs), static_cast<int>(rhs))
+#define TRANSPYLER_PROFILE_EVENT(event, type) \
+  ::transpyler_profile::count(::transpyler_profile::Event::event, static_cast<int>(type))
+#define TRANSPYLER_PROFILE_ALLOCATION(bytes) ::transpyler_profile::allocation(bytes)
+#define TRANSPYLER_PROFILE_EXCEPTION() \
+  ::transpyler_profile::counters.exceptions.fetch_add(1, std::memory_order_relaxed)
+#define TRANSPYLER_PROFILE_FUNCTION(name)                                          \
+  static ::transpyler_profile::FunctionStats transpyler_profile_stats(name);        \
+  ::transpyler_profile::FunctionTimer transpyler_profile_timer(transpyler_profile_stats)
+
+#else
+
+#define TRANSPYLER_PROFILE_OP(op, lhs, rhs) static_cast<void>(0)
+#define TRANSPYLER_PROFILE_EVENT(event, type) static_cast<void>(0)
+#define TRANSPYLER_PROFILE_ALLOCATION(bytes) static_cast<void>(0)
+#define TRANSPYLER_PROFILE_EXCEPTION() static_cast<void>(0)
+#define TRANSPYLER_PROFILE_FUNCTION(name) static_cast<void>(0)
+
+#endif // TRANSPYLER_PROFILE
+
+#endif // PROFILE_HPP
@@ -0,0 +1,153 @@
+// Copyright (c) 2025 Andres Quesada, David Obando, Randy Aguero
+#ifndef RUNTIME_BENCH_HPP
+#define RUNTIME_BENCH_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/**
+ * Minimal in-process microbenchmark harness for the C++ runtime.
+ *
+ * A benchmark is a function running its operation `iterations` times:
+ *
+ *   BENCH(add_int_int) {
+ *     for (std::size_t i = 0; i < iterations; ++i) bench::keep(a + b);
+ *   }
+ *
+ * run() grows the iteration count until a run takes --min-time, repeats
+ * it and reports the fastest run in nanoseconds per operation, one
+ * "name ns" line per benchmark, so the output of one run can be checked in
+ * as a baseline for --compare.
+ */
+namespace bench {
+
+  // Keep a value observable, so the compiler cannot drop the work producing it
+  template <typename T>
+  inline void keep(const T &value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "g"(&value) : "memory");
+#else
+    static const void *volatile sink;
+    sink = &value;
+#endif
+  }
+
+  struct Case {
+    const char *name;
+    void (*run)(std::size_t iterations);
+  };
+
+  inline std::vector<Case> &registry() {
+    static std::vector<Case> cases;
+    return cases;
+  }
+
+  struct Register {
+    Register(const char *name, void (*run)(std::size_t)) { registry().push_back(Case{name, run}); }
+  };
+
+  // Nanoseconds per operation of the fastest of `repetitions` timed runs
+  inline double measure(const Case &bench, double minSeconds, int repetitions) {
+    using Clock = std::chrono::steady_clock;
+    auto seconds = [&bench](std::size_t iterations) {
+      Clock::time_point start = Clock::now();
+      bench.run(iterations);
+      return std::chrono::duration<double>(Clock::now() - start).count();
+    };
+
+    std::size_t iterations = 1;
+    double elapsed = seconds(iterations);
+    while (elapsed < minSeconds && iterations < (std::size_t(1) << 40)) {
+      // Aim a bit past the target so the loop usually ends on the next run
+      double scale = elapsed > 0 ? 1.2 * minSeconds / elapsed : 100.0;
+      iterations = static_cast<std::size_t>(static_cast<double>(iterations) * std::min(std::max(scale, 2.0), 100.0));
+      elapsed = seconds(iterations);
+    }
+    double best = elapsed;
+    for (int repetition = 1; repetition < repetitions; ++repetition) {
+      best = std::min(best, seconds(iterations));
+    }
+    return best * 1e9 / static_cast<double>(iterations);
+  }
+
+  // name -> ns per operation, from the output of an earlier run
+  inline std::map<std::string, double> readBaseline(const char *path) {
+    std::map<std::string, double> baseline;
+    std::ifstream file(path);
+    if (!file) {
+      std::fprintf(stderr, "cannot read baseline %s\n", path);
+      std::exit(2);
+    }
+    std::string line;
+    while (std::getline(file, line)) {
+      if (line.empty() || line[0] == '#') continue;
+      std::istringstream fields(line);
+      std::string name;
+      double nanoseconds;
+      if (fields >> name >> nanoseconds) baseline[name] = nanoseconds;
+    }
+    return baseline;
+  }
+
+  /**
+   * Run the registered benchmarks.
+   * Options: --filter TEXT (names containing TEXT), --min-time SECONDS
+   * (per timed run, default 0.2), --repetitions N (default 3) and
+   * --compare FILE (print the change against a baseline).
+   */
+  inline int run(int argc, char **argv) {
+    const char *filter = "";
+    const char *comparePath = nullptr;
+    double minSeconds = 0.2;
+    int repetitions = 3;
+    for (int i = 1; i < argc; ++i) {
+      bool hasValue = i + 1 < argc;
+      if (std::strcmp(argv[i], "--filter") == 0 && hasValue) {
+        filter = argv[++i];
+      } else if (std::strcmp(argv[i], "--min-time") == 0 && hasValue) {
+        minSeconds = std::atof(argv[++i]);
+      } else if (std::strcmp(argv[i], "--repetitions") == 0 && hasValue) {
+        repetitions = std::max(1, std::atoi(argv[++i]));
+      } else if (std::strcmp(argv[i], "--compare") == 0 && hasValue) {
+        comparePath = argv[++i];
+      } else {
+        std::fprintf(stderr, "usage: %s [--filter TEXT] [--min-time SECONDS] [--repetitions N] [--compare FILE]\n", argv[0]);
+        return 2;
+      }
+    }
+
+    std::map<std::string, double> baseline;
+    if (comparePath != nullptr) baseline = readBaseline(comparePath);
+
+    std::printf("# benchmark ns/op%s\n", comparePath != nullptr ? " baseline change" : "");
+    for (const Case &bench : registry()) {
+      if (std::strstr(bench.name, filter) == nullptr) continue;
+      double nanoseconds = measure(bench, minSeconds, repetitions);
+      std::printf("%-28s %10.2f", bench.name, nanoseconds);
+      auto previous = baseline.find(bench.name);
+      if (previous != baseline.end() && previous->second > 0) {
+        std::printf(" %10.2f %+7.1f%%", previous->second, (nanoseconds / previous->second - 1.0) * 100.0);
+      }
+      std::printf("\n");
+      std::fflush(stdout);
+    }
+    return 0;
+  }
+
+} // namespace bench
+
+#define BENCH(name)                                               \
+  static void bench_##name(std::size_t iterations);               \
+  static const bench::Register register_##name(#name, bench_##name); \
+  static void bench_##name(std::size_t iterations)
+
+#endif // RUNTIME_BENCH_HPP
@@ -0,0 +1,456 @@
+// Copyright (c) 2025 Andres Quesada, David Obando, Randy Aguero
+//
+// Per-operation microbenchmarks of the DynamicType runtime. `make bench`
+// builds them with -O2 and compares against baseline.txt. After a
+// deliberate performance change, regenerate the baseline on the same
+// machine with `./build/runtime_bench.exe > src/runtime/cpp/bench/baseline.txt`.
+#include "bench.hpp"
+#include "builtins.hpp"
+#include "Generator.hpp"
+#include <filesystem>
+
+namespace {
+  // Operands are read from small tables indexed by the loop counter, so the
+  // compiler cannot fold an operation into a constant
+  constexpr std::size_t MASK = 7;
+
+  const std::vector<DynamicType> &ints() {
+    static const std::vector<DynamicType> values{3, -17, 42, 1000003, 7, -1, 65536, 99};
+    return values;
+  }
+
+  const std::vector<DynamicType> &doubles() {
+    static const std::vector<DynamicType> values{0.5, -2.25, 3.14159, 1e6, 7.0, -0.125, 2.5e-3, 99.9};
+    return values;
+  }
+
+  const std::vector<DynamicType> &strings() {
+    static const std::vector<DynamicType> values{"alpha", "beta", "gamma", "delta", "epsilon", "zeta", "eta", "theta"};
+    return values;
+  }
+
+  // [0, 1, ..., size - 1] as a packed int list
+  DynamicType intList(long long size) {
+    DynamicType list(std::vector<DynamicType>{});
+    for (long long i = 0; i < size; ++i) list.append(DynamicType(i));
+    return list;
+  }
+
+  // A binary operator over every pair of two operand tables
+  template <typename Op>
+  void binary(std::size_t iterations, const std::vector<DynamicType> &left, const std::vector<DynamicType> &right, Op op) {
+    for (std::size_t i = 0; i < iterations; ++i) {
+      bench::keep(op(left[i & MASK], right[(i >> 3) & MASK]));
+    }
+  }
+} // namespace
+
+// Construction and copy
+
+BENCH(construct_int) {
+  for (std::size_t i = 0; i < iterations; ++i) bench::keep(DynamicType(static_cast<long long>(i)));
+}
+
+BENCH(construct_double) {
+  for (std::size_t i = 0; i < iterations; ++i) bench::keep(DynamicType(static_cast<double>(i)));
+}
+
+BENCH(construct_string) {
+  for (std::size_t i = 0; i < iterations; ++i) bench::keep(DynamicType("a short string"));
+}
+
+BENCH(construct_list4) {
+  for (std::size_t i = 0; i < iterations; ++i) {
+    bench::keep(DynamicType(std::vector<DynamicType>{DynamicType(1), DynamicType(2), DynamicType(3), DynamicType(4)}));
+  }
+}
+
+BENCH(construct_dict2) {
+  for (std::size_t i = 0; i < iterations; ++i) {
+    bench::keep(DynamicType(DynamicType::Dict{{DynamicType("a"), DynamicType(1)}, {DynamicType("b"), DynamicType(2)}}));
+  }
+}
+
+BENCH(copy_int) {
+  for (std::size_t i = 0; i < iterations; ++i) {
+    DynamicType copy = ints()[i & MASK];
+    bench::keep(copy);
+  }
+}
+
+BENCH(copy_string) {
+  for (std::size_t i = 0; i < iterations; ++i) {
+    DynamicType copy = strings()[i & MASK];
+    bench::keep(copy);
+  }
+}
+
+BENCH(copy_list) {
+  static const DynamicType list = intList(100);
+  for (std::size_t i = 0; i < iterations; ++i) {
+    DynamicType copy = list;
+    bench::keep(copy);
+  }
+}
+
+// Arithmetic, per operand type pair
+
+BENCH(add_int_int) { binary(iterations, ints(), ints(), [](const DynamicType &a, const DynamicType &b) { return a + b; }); }
+BENCH(add_int_double) { binary(iterations, ints(), doubles(), [](const DynamicType &a, const DynamicType &b) { return a + b; }); }
+BENCH(add_double_double) { binary(iterations, doubles(), doubles(), [](const DynamicType &a, const DynamicType &b) { return a + b; }); }
+BENCH(add_str_str) { binary(iterations, strings(), strings(), [](const DynamicType &a, const DynamicType &b) { return a + b; }); }
+BENCH(sub_int_int) { binary(iterations, ints(), ints(), [](const DynamicType &a, const DynamicType &b) { return a - b; }); }
+BENCH(sub_double_double) { binary(iterations, doubles(), doubles(), [](const DynamicType &a, const DynamicType &b) { return a - b; }); }
+BENCH(mul_int_int) { binary(iterations, ints(), ints(), [](const DynamicType &a, const DynamicType &b) { return a * b; }); }
+BENCH(mul_int_double) { binary(iterations, ints(), doubles(), [](const DynamicType &a, const DynamicType &b) { return a * b; }); }
+BENCH(mul_double_double) { binary(iterations, doubles(), doubles(), [](const DynamicType &a, const DynamicType &b) { return a * b; }); }
+BENCH(div_int_int) { binary(iterations, ints(), ints(), [](const DynamicType &a, const DynamicType &b) { return a / b; }); }
+BENCH(div_double_double) { binary(iterations, doubles(), doubles(), [](const DynamicType &a, const DynamicType &b) { return a / b; }); }
+BENCH(floordiv_int_int) { binary(iterations, ints(), ints(), [](const DynamicType &a, const DynamicType &b) { return a.floor_div(b); }); }
+BENCH(floordiv_double_double) { binary(iterations, doubles(), doubles(), [](const DynamicType &a, const DynamicType &b) { return a.floor_div(b); }); }
+BENCH(mod_int_int) { binary(iterations, ints(), ints(), [](const DynamicType &a, const DynamicType &b) { return a % b; }); }
+BENCH(mod_double_double) { binary(iterations, doubles(), doubles(), [](const DynamicType &a, const DynamicType &b) { return a % b; }); }
+BENCH(pow_int_int) {
+  binary(iterations, ints(), ints(), [](const DynamicType &a, const DynamicType &b) { return a.pow(DynamicType(b.toInt() & 3)); });
+}
+
+BENCH(add_int_overflow) {
+  static const DynamicType large(9223372036854775807LL);
+  for (std::size_t i = 0; i < iterations; ++i) bench::keep(large + ints()[i & MASK]);
+}
+
+// Comparison, per operand type pair
+
+BENCH(eq_int_int) { binary(iterations, ints(), ints(), [](const DynamicType &a, const DynamicType &b) { return a == b; }); }
+BENCH(eq_int_double) { binary(iterations, ints(), doubles(), [](const DynamicType &a, const DynamicType &b) { return a == b; }); }
+BENCH(eq_str_str) { binary(iterations, strings(), strings(), [](const DynamicType &a, const DynamicType &b) { return a == b; }); }
+BENCH(lt_int_int) { binary(iterations, ints(), ints(), [](const DynamicType &a, const DynamicType &b) { return a < b; }); }
+BENCH(lt_int_double) { binary(iterations, ints(), doubles(), [](const DynamicType &a, const DynamicType &b) { return a < b; }); }
+BENCH(lt_double_double) { binary(iterations, doubles(), doubles(), [](const DynamicType &a, const DynamicType &b) { return a < b; }); }
+BENCH(lt_str_str) { binary(iterations, strings(), strings(), [](const DynamicType &a, const DynamicType &b) { return a < b; }); }
+
+// Lists
+
+BENCH(list_get_item) {
+  static const DynamicType list = intList(1024);
+  for (std::size_t i = 0; i < iterations; ++i) bench::keep(list.getItem(DynamicType(static_cast<long long>(i & 1023))));
+}
+
+BENCH(list_index_ref) {
+  static DynamicType list = DynamicType(std::vector<DynamicType>(1024, DynamicType("x")));
+  for (std::size_t i = 0; i < iterations; ++i) bench::keep(list[i & 1023]);
+}
+
+BENCH(list_set_item) {
+  static DynamicType list = intList(1024);
+  for (std::size_t i = 0; i < iterations; ++i) list.setItem(DynamicType(static_cast<long long>(i & 1023)), ints()[i & MASK]);
+  bench::keep(list);
+}
+
+BENCH(list_append_int) {
+  DynamicType list(std::vector<DynamicType>{});
+  for (std::size_t i = 0; i < iterations; ++i) {
+    if ((i & 4095) == 0) list = DynamicType(std::vector<DynamicType>{});
+    list.append(ints()[i & MASK]);
+  }
+  bench::keep(list);
+}
+
+BENCH(list_append_str) {
+  DynamicType list(std::vector<DynamicType>{});
+  for (std::size_t i = 0; i < iterations; ++i) {
+    if ((i & 4095) == 0) list = DynamicType(std::vector<DynamicType>{});
+    list.append(strings()[i & MASK]);
+  }
+  bench::keep(list);
+}
+
+BENCH(list_pop_back) {
+  // Stack use: push, push, pop
+  DynamicType list = intList(1024);
+  for (std::size_t i = 0; i < iterations; ++i) {
+    list.append(ints()[i & MASK]);
+    list.append(ints()[(i + 1) & MASK]);
+    bench::keep(list.pop());
+  }
+  bench::keep(list);
+}
+
+BENCH(list_pop_front) {
+  // Queue use on a 1024-element list: append at the back, pop from the front
+  DynamicType list = intList(1024);
+  DynamicType front(0);
+  for (std::size_t i = 0; i < iterations; ++i) {
+    list.append(ints()[i & MASK]);
+    bench::keep(list.pop(front));
+  }
+  bench::keep(list);
+}
+
+BENCH(list_insert_front) {
+  DynamicType list(std::vector<DynamicType>{});
+  DynamicType front(0);
+  for (std::size_t i = 0; i < iterations; ++i) {
+    if ((i & 1023) == 0) list = intList(1024);
+    list.insert(front, ints()[i & MASK]);
+    bench::keep(list.pop());
+  }
+  bench::keep(list);
+}
+
+BENCH(list_sublist_100) {
+  static const DynamicType list = intList(1024);
+  for (std::size_t i = 0; i < iterations; ++i) {
+    std::size_t start = i & 511;
+    bench::keep(list.sublist(start, start + 100));
+  }
+}
+
+BENCH(list_slice_copy_100) {
+  // A written slice: the view becomes a list of its own
+  static const DynamicType list = intList(1024);
+  for (std::size_t i = 0; i < iterations; ++i) {
+    DynamicType part = list.sublist(i & 511, (i & 511) + 100);
+    part.append(DynamicType(0));
+    bench::keep(part);
+  }
+}
+
+// Dicts and sets
+
+BENCH(dict_get_str) {
+  static const DynamicType dict = [] {
+    DynamicType d = DynamicType(DynamicType::Dict{});
+    for (const DynamicType &key : strings()) d.set(key, DynamicType(1));
+    return d;
+  }();
+  for (std::size_t i = 0; i < iterations; ++i) bench::keep(dict.get(strings()[i & MASK]));
+}
+
+BENCH(dict_get_int) {
+  static const DynamicType dict = [] {
+    DynamicType d = DynamicType(DynamicType::Dict{});
+    for (long long i = 0; i < 1024; ++i) d.set(DynamicType(i), DynamicType(i));
+    return d;
+  }();
+  for (std::size_t i = 0; i < iterations; ++i) bench::keep(dict.get(DynamicType(static_cast<long long>(i & 1023))));
+}
+
+BENCH(dict_set_str) {
+  static DynamicType dict = DynamicType(DynamicType::Dict{});
+  for (std::size_t i = 0; i < iterations; ++i) dict.set(strings()[i & MASK], ints()[(i >> 3) & MASK]);
+  bench::keep(dict);
+}
+
+BENCH(dict_set_int) {
+  static DynamicType dict = DynamicType(DynamicType::Dict{});
+  for (std::size_t i = 0; i < iterations; ++i) dict.set(DynamicType(static_cast<long long>(i & 1023)), ints()[i & MASK]);
+  bench::keep(dict);
+}
+
+BENCH(set_add_int) {
+  static DynamicType set = DynamicType(DynamicType::Set{});
+  for (std::size_t i = 0; i < iterations; ++i) set.add(DynamicType(static_cast<long long>(i & 1023)));
+  bench::keep(set);
+}
+
+BENCH(set_contains_int) {
+  static const DynamicType set = [] {
+    DynamicType s = DynamicType(DynamicType::Set{});
+    for (long long i = 0; i < 1024; i += 2) s.add(DynamicType(i));
+    return s;
+  }();
+  for (std::size_t i = 0; i < iterations; ++i) bench::keep(set.contains(DynamicType(static_cast<long long>(i & 1023))));
+}
+
+BENCH(set_contains_str) {
+  static const DynamicType set = [] {
+    DynamicType s = DynamicType(DynamicType::Set{});
+    for (std::size_t i = 0; i < strings().size(); i += 2) s.add(strings()[i]);
+    return s;
+  }();
+  for (std::size_t i = 0; i < iterations; ++i) bench::keep(set.contains(strings()[i & MASK]));
+}
+
+BENCH(set_dedup_ids) {
+  // set(ids) over 4096 ids with every value repeated four times; cost per id
+  static const DynamicType ids = [] {
+    std::vector<DynamicType> items;
+    for (long long i = 0; i < 4096; ++i) items.emplace_back((i * 2654435761LL) & 1023);
+    return DynamicType(std::move(items));
+  }();
+  for (std::size_t i = 0; i < iterations; i += 4096) bench::keep(set(ids));
+}
+
+BENCH(set_intersection) {
+  // 1024-element sets overlapping by half; cost per element of the smaller operand
+  static const DynamicType a = set(range(0, 1024));
+  static const DynamicType b = set(range(512, 1536));
+  for (std::size_t i = 0; i < iterations; i += 1024) bench::keep(a & b);
+}
+
+// Hashing
+
+BENCH(hash_int) {
+  std::hash<DynamicType> hash;
+  for (std::size_t i = 0; i < iterations; ++i) bench::keep(hash(ints()[i & MASK]));
+}
+
+BENCH(hash_double) {
+  std::hash<DynamicType> hash;
+  for (std::size_t i = 0; i < iterations; ++i) bench::keep(hash(doubles()[i & MASK]));
+}
+
+BENCH(hash_str_cached) {
+  std::hash<DynamicType> hash;
+  for (std::size_t i = 0; i < iterations; ++i) bench::keep(hash(strings()[i & MASK]));
+}
+
+BENCH(hash_str_fresh) {
+  std::hash<DynamicType> hash;
+  for (std::size_t i = 0; i < iterations; ++i) bench::keep(hash(DynamicType("a fresh string")));
+}
+
+BENCH(hash_list16) {
+  static const DynamicType list = intList(16);
+  std::hash<DynamicType> hash;
+  for (std::size_t i = 0; i < iterations; ++i) bench::keep(hash(list));
+}
+
+// Strings
+
+BENCH(str_append_loop) {
+  // s += piece on one uniquely owned string, 4096 appends per build
+  for (std::size_t i = 0; i < iterations; i += 4096) {
+    DynamicType text("");
+    for (std::size_t j = 0; j < 4096; ++j) text += strings()[j & MASK];
+    bench::keep(text);
+  }
+}
+
+BENCH(str_join_16) {
+  static const DynamicType separator(", ");
+  static const DynamicType fields = [] {
+    std::vector<DynamicType> items;
+    for (std::size_t i = 0; i < 16; ++i) items.push_back(strings()[i & MASK]);
+    return DynamicType(std::move(items));
+  }();
+  for (std::size_t i = 0; i < iterations; ++i) bench::keep(separator.join(fields));
+}
+
+BENCH(str_repeat_64) {
+  static const DynamicType dash("-");
+  static const DynamicType count(64);
+  for (std::size_t i = 0; i < iterations; ++i) bench::keep(dash * count);
+}
+
+// Formatting
+
+BENCH(to_string_int) {
+  for (std::size_t i = 0; i < iterations; ++i) bench::keep(ints()[i & MASK].toString());
+}
+
+BENCH(to_string_double) {
+  for (std::size_t i = 0; i < iterations; ++i) bench::keep(doubles()[i & MASK].toString());
+}
+
+BENCH(to_string_list16) {
+  static const DynamicType list = intList(16);
+  for (std::size_t i = 0; i < iterations; ++i) bench::keep(list.toString());
+}
+
+// Ranges
+
+BENCH(range_construct) {
+  for (std::size_t i = 0; i < iterations; ++i) bench::keep(range(static_cast<long long>(i & 1023)));
+}
+
+BENCH(range_iterate_per_item) {
+  // One range of 1024 items per 1024 iterations
+  static const DynamicType values = range(1024);
+  long long total = 0;
+  std::size_t done = 0;
+  while (done < iterations) {
+    for (DynamicType value : values) {
+      total += value.toInt();
+      if (++done == iterations) break;
+    }
+  }
+  bench::keep(total);
+}
+
+BENCH(range_get_item) {
+  static const DynamicType values = range(0, 4096, 3);
+  for (std::size_t i = 0; i < iterations; ++i) bench::keep(values.getItem(DynamicType(static_cast<long long>(i & 1023))));
+}
+
+// Lazy iteration
+
+namespace {
+  // def counter(): n = 0; while True: yield n; n += 1
+  DynamicType counter() {
+    DynamicType n(0);
+    while (true) {
+      co_yield n;
+      n += DynamicType(1);
+    }
+  }
+} // namespace
+
+BENCH(dict_items_unpack_per_item) {
+  // for k, v in d.items() over 1024 entries, no pair built per item
+  static const DynamicType dict = [] {
+    DynamicType d = DynamicType(DynamicType::Dict{});
+    for (long long i = 0; i < 1024; ++i) d.set(DynamicType(i), DynamicType(i));
+    return d;
+  }();
+  for (std::size_t i = 0; i < iterations; i += 1024) {
+    for (DynamicType::Iterator it = dict.items().begin(); it != DynamicType::IterationEnd(); ++it) {
+      bench::keep(it.unpack(0, 2));
+      bench::keep(it.unpack(1, 2));
+    }
+  }
+}
+
+BENCH(generator_next) {
+  static const DynamicType numbers = counter();
+  DynamicType value;
+  for (std::size_t i = 0; i < iterations; ++i) {
+    numbers.nextItem(value);
+    bench::keep(value);
+  }
+}
+
+// Parallel loops (spread over the worker pool with RUNTIME_FLAGS=-DTRANSPYLER_PARALLEL)
+
+BENCH(parallel_map_per_item) {
+  // parallel_map(square, xs) over 4096 ints: the cost of dealing out and collecting items
+  static const DynamicType values = [] {
+    DynamicType list = DynamicType(std::vector<DynamicType>{});
+    for (long long i = 0; i < 4096; ++i) list.append(DynamicType(i));
+    return list;
+  }();
+  for (std::size_t i = 0; i < iterations; i += 4096) {
+    bench::keep(parallel_map([](const DynamicType &x) { return x * x; }, values));
+  }
+}
+
+// Binary files
+
+BENCH(load_int_array_per_item) {
+  // load() of a saved 65536-int list: mapping the file and adopting the array
+  static const std::string path = [] {
+    DynamicType list = DynamicType(std::vector<DynamicType>{});
+    for (long long i = 0; i < 65536; ++i) list.append(DynamicType(i));
+    std::string file = (std::filesystem::temp_directory_path() / "runtime_bench_table.bin").string();
+    list.save(file);
+    return file;
+  }();
+  for (std::size_t i = 0; i < iterations; i += 65536) {
+    bench::keep(DynamicType::load(path));
+  }
+}
+
+int main(int argc, char **argv) {
+  return bench::run(argc, argv);
+}
@@ -1,57 +1,114 @@
 // Copyright (c) 2025 Andres Quesada, David Obando, Randy Aguero
 #include "builtins.hpp"
 #include <algorithm>
+#include <cmath>
+#include <cstdio>
 #include <cstdlib>
+#include <cstring>
+#include <exception>
+#ifdef TRANSPYLER_PROFILE
+#include <cstdarg>
+#include <vector>
+#endif
 
 
 // print() template implementation moved to builtins.hpp
 
-DynamicType len(const DynamicType &obj) {
-    if (obj.isList()) {
-      return DynamicType(static_cast<int>(obj.getList().size()));
+namespace {
+
+std::terminate_handler previous_terminate = nullptr;
+
+// An uncaught exception skips static destructors; write what was printed first
+[[noreturn]] void flush_then_terminate() {
+    stdout_buffer.flush();
+#ifdef TRANSPYLER_PROFILE
+    transpyler_profile::report();
+#endif
+    if (previous_terminate != nullptr) {
+        previous_terminate();
     }
-    if (obj.isDict()) {
-      return DynamicType(static_cast<int>(obj.getDict().size()));
+    std::abort();
+}
+
+// Block-buffered stdin: one fread per 64 KiB instead of one read per line
+struct InputBuffer {
+    char data[1 << 16];
+    std::size_t position = 0;
+    std::size_t end = 0;
+
+    // Next line without its newline; false at end of input
+    bool read_line(std::string &line) {
+        line.clear();
+        bool any = false;
+        while (true) {
+            if (position == end) {
+                end = std::fread(data, 1, sizeof(data), stdin);
+                position = 0;
+                if (end == 0) {
+                    return any;
+                }
+            }
+            any = true;
+            const char *start = data + position;
+            const char *newline = static_cast<const char *>(std::memchr(start, '\n', end - position));
+            if (newline != nullptr) {
+                line.append(start, newline);
+                position += static_cast<std::size_t>(newline - start) + 1;
+                if (!line.empty() && line.back() == '\r') {
+                    line.pop_back();
+                }
+                return true;
+            }
+            line.append(start, end - position);
+            position = end;
+        }
     }
-    if( obj.isSet()) {
-      return DynamicType(static_cast<int>(obj.getSet().size()));
+};
+
+InputBuffer stdin_buffer;
+
+}  // namespace
+
+OutputBuffer stdout_buffer;
+
+OutputBuffer::OutputBuffer() {
+    text.reserve(FLUSH_SIZE + 1024);
+    previous_terminate = std::set_terminate(flush_then_terminate);
+}
+
+OutputBuffer::~OutputBuffer() {
+    flush();
+}
+
+void OutputBuffer::flush() {
+    if (!text.empty()) {
+        std::fwrite(text.data(), 1, text.size(), stdout);
+        text.clear();
     }
-    if (obj.isString()) {
-      return DynamicType(static_cast<int>(obj.toString().length()));
+    std::fflush(stdout);
+}
+
+DynamicType len(const DynamicType &obj) {
+    if (obj.isList() || obj.isDict() || obj.isSet() || obj.isString() || obj.isRange() || obj.isView()) {
+      return DynamicType(static_cast<long long>(obj.size()));
     }
-    throw std::runtime_error("len() not supported for this type");
+    runtime_fail("len() not supported for this type");
 }
 
-DynamicType range(int stop) {
-  std::vector<DynamicType> result;
-  for (int i = 0; i < stop; ++i) {
-    result.push_back(DynamicType(i));
-  }
-  return DynamicType(result);
+// range() stores only its bounds; elements are produced while iterating
+DynamicType range(long long stop) {
+  return range(0, stop, 1);
 }
 
-DynamicType range(int start, int stop) {
-  std::vector<DynamicType> result;
-  for (int i = start; i < stop; ++i) {
-    result.push_back(DynamicType(i));
-  }
-  return DynamicType(result);
+DynamicType range(long long start, long long stop) {
+  return range(start, stop, 1);
 }
 
-DynamicType range(int start, int stop, int step) {
-    std::vector<DynamicType> result;
-    if (step > 0) {
-        for (int i = start; i < stop; i += step) {
-            result.push_back(DynamicType(i));
-        }
-    } else if (step < 0) {
-        for (int i = start; i > stop; i += step) {
-            result.push_back(DynamicType(i));
-        }
-    } else {
-        throw std::runtime_error("range() step argument must not be zero");
+DynamicType range(long long start, long long stop, long long step) {
+    if (step == 0) {
+        runtime_fail("range() step argument must not be zero");
     }
-    return DynamicType(result);
+    return DynamicType(DynamicType::Range{start, stop, step});
 }
 
 // DynamicType overloads for range()
@@ -72,6 +129,26 @@ DynamicType str(const DynamicType& value) {
 }
 
 DynamicType int_(const DynamicType& value) {
+    if (value.isBigInt()) {
+        return value;
+    }
+    if (value.isString()) {
+        try {
+            return DynamicType(value.toInt());
+        } catch (const std::runtime_error&) {
+            // Too long for 64 bits (or not a number, which fromString reports)
+            return DynamicType(BigInt::fromString(value.toString()));
+        }
+    }
+    if (value.isDouble()) {
+        double d = value.toDouble();
+        if (std::isnan(d)) runtime_fail("cannot convert float NaN to integer");
+        if (std::isinf(d)) runtime_fail("cannot convert float infinity to integer");
+        // Truncation only fits when the double lies within [-2**63, 2**63)
+        if (d >= 9223372036854775808.0 || d < -9223372036854775808.0) {
+            return DynamicType(BigInt::fromDouble(d));
+        }
+    }
     return DynamicType(value.toInt());
 }
 
@@ -84,13 +161,14 @@ DynamicType bool_(const DynamicType& value) {
 }
 
 DynamicType abs(const DynamicType& value) {
-    if (value.isInt()) {
-        return DynamicType(std::abs(value.toInt()));
+    if (value.isInt() || value.isBigInt()) {
+        // Unary minus promotes abs(-2**63) to a big int
+        return value < DynamicType(0) ? -value : value;
     }
     if (value.isDouble()) {
         return DynamicType(std::abs(value.toDouble()));
     }
-    throw std::runtime_error("abs() requires numeric argument");
+    runtime_fail("abs() requires numeric argument");
 }
 
 DynamicType min(const DynamicType& a, const DynamicType& b) {
@@ -101,81 +179,315 @@ DynamicType max(const DynamicType& a, const DynamicType& b) {
     return (a > b) ? a : b;
 }
 
+DynamicType min(const DynamicType& iterable) {
+    return iterable.minItem();
+}
+
+DynamicType max(const DynamicType& iterable) {
+    return iterable.maxItem();
+}
+
 DynamicType sum(const DynamicType& iterable) {
-    if (!iterable.isList()) {
-        throw std::runtime_error("sum() requires a list");
+    if (iterable.isRange()) {
+        // Closed form, no iteration needed; DynamicType arithmetic promotes
+        // to a big int if count * (first + last) overflows
+        long long count = len(iterable).toInt();
+        if (count == 0) {
+            return DynamicType(0);
+        }
+        DynamicType first = iterable.getItem(DynamicType(0));
+        DynamicType last = iterable.getItem(DynamicType(count - 1));
+        return (DynamicType(count) * (first + last)).floor_div(DynamicType(2));
     }
-    
-    const std::vector<DynamicType>& list = iterable.getList();
-    DynamicType result(0);
-    
-    for (const DynamicType& item : list) {
-        result = result + item;
+    if (!iterable.isIterable() || iterable.isString() || iterable.isDict()) {
+        runtime_fail("sum() requires an iterable of numbers");
     }
+    return iterable.sumItems();
+}
+
+DynamicType sorted(const DynamicType& iterable) {
+    DynamicType result(std::vector<DynamicType>{});
+    result.extend(iterable);
+    result.sort();
     return result;
 }
 
 DynamicType type(const DynamicType& value) {
     switch (value.getType()) {
         case DynamicType::Type::NONE:   return DynamicType("<class 'NoneType'>");
-        case DynamicType::Type::INT:    return DynamicType("<class 'int'>");
+        case DynamicType::Type::INT:
+        case DynamicType::Type::BIGINT: return DynamicType("<class 'int'>");
         case DynamicType::Type::DOUBLE: return DynamicType("<class 'float'>");
         case DynamicType::Type::STRING: return DynamicType("<class 'str'>");
         case DynamicType::Type::BOOL:   return DynamicType("<class 'bool'>");
-        case DynamicType::Type::LIST:   return DynamicType("<class 'list'>");
+        case DynamicType::Type::LIST:
+        case DynamicType::Type::SLICE:  return DynamicType("<class 'list'>");
         case DynamicType::Type::DICT:   return DynamicType("<class 'dict'>");
         case DynamicType::Type::SET:    return DynamicType("<class 'set'>");
+        case DynamicType::Type::RANGE:  return DynamicType("<class 'range'>");
+        case DynamicType::Type::VIEW:   return DynamicType(std::string("<class '") + value.viewName() + "'>");
+        case DynamicType::Type::GENERATOR: return DynamicType("<class 'generator'>");
         default: return DynamicType("<class 'unknown'>");
     }
 }
 
 DynamicType input(const std::string& prompt) {
-    if (!prompt.empty()) {
-        std::cout << prompt;
-    }
+    // The prompt and everything printed before it must show before blocking
+    stdout_buffer.text += prompt;
+    stdout_buffer.flush();
     std::string line;
-    std::getline(std::cin, line);
-    return DynamicType(line);
+    stdin_buffer.read_line(line);
+    return DynamicType(std::move(line));
+}
+
+DynamicType input(const DynamicType& prompt) {
+    return input(prompt.toString());
 }
 
 DynamicType input() {
-    return input("");
+    return input(std::string());
 }
 
 DynamicType set() {
-    return DynamicType(std::unordered_set<DynamicType>());
+    return DynamicType(DynamicType::Set());
 }
 
 DynamicType set(const DynamicType& iterable) {
-    std::unordered_set<DynamicType> result;
+    DynamicType::Set result;
     
-    if (iterable.isList()) {
-        const std::vector<DynamicType>& list = iterable.getList();
-        for (const DynamicType& item : list) {
+    if (iterable.isSet()) {
+        result = iterable.getSet();
+    } else if (iterable.isIterable()) {
+        // Sized for all distinct elements, so deduplicating never rehashes
+        result.reserve(iterable.lengthHint());
+        for (DynamicType item : iterable) {
             result.insert(item);
         }
-    } else if (iterable.isSet()) {
-        result = iterable.getSet();
     } else {
-        throw std::runtime_error("set() requires an iterable (list or set)");
+        runtime_fail("set() requires an iterable");
     }
     
-    return DynamicType(result);
+    return DynamicType(std::move(result));
+}
+
+DynamicType list() {
+    return DynamicType(std::vector<DynamicType>{});
+}
+
+DynamicType list(const DynamicType& iterable) {
+    if (!iterable.isIterable()) {
+        runtime_fail("list() requires an iterable");
+    }
+    DynamicType result(std::vector<DynamicType>{});
+    result.extend(iterable);
+    return result;
+}
+
+DynamicType next(const DynamicType& iterator) {
+    DynamicType item;
+    if (!iterator.nextItem(item)) {
+        runtime_fail("StopIteration");
+    }
+    return item;
+}
+
+DynamicType next(const DynamicType& iterator, const DynamicType& fallback) {
+    DynamicType item;
+    return iterator.nextItem(item) ? item : fallback;
+}
+
+DynamicType save(const DynamicType& value, const DynamicType& path) {
+    if (!path.isString()) {
+        runtime_fail("save() path must be a string");
+    }
+    value.save(path.toString());
+    return DynamicType();
+}
+
+DynamicType load(const DynamicType& path) {
+    if (!path.isString()) {
+        runtime_fail("load() path must be a string");
+    }
+    return DynamicType::load(path.toString());
 }
 
 // Data structure helper functions
 DynamicType sublist(const DynamicType& list, const DynamicType& start, const DynamicType& end) {
     if (!list.isList()) {
-        throw std::runtime_error("sublist() can only be called on lists");
+        runtime_fail("sublist() can only be called on lists");
     }
     
-    // Convert DynamicType arguments to size_t
-    size_t startIdx = static_cast<size_t>(start.toInt());
-    size_t endIdx = static_cast<size_t>(end.toInt());
-    
-    // Create a non-const copy to call sublist
-    DynamicType listCopy = list;
-    return listCopy.sublist(startIdx, endIdx);
+    // A view sharing the list's elements; nothing is copied
+    return list.sublist(start, end);
 }
 
 
+#ifdef TRANSPYLER_PROFILE
+namespace {
+
+const char *const PROFILE_OPS[] = {"add", "iadd", "sub", "mul", "truediv", "mod", "floordiv", "pow", "neg",
+                                   "eq", "lt", "le", "gt", "ge"};
+const char *const PROFILE_EVENTS[] = {"deep_copy", "unpack", "to_string"};
+static_assert(sizeof(PROFILE_OPS) / sizeof(*PROFILE_OPS) == transpyler_profile::OPS, "one name per Op");
+static_assert(sizeof(PROFILE_EVENTS) / sizeof(*PROFILE_EVENTS) == transpyler_profile::EVENTS, "one name per Event");
+
+const char *profile_type_name(std::size_t tag) {
+    switch (static_cast<DynamicType::Type>(tag)) {
+        case DynamicType::Type::NONE:   return "None";
+        case DynamicType::Type::INT:    return "int";
+        case DynamicType::Type::DOUBLE: return "float";
+        case DynamicType::Type::STRING: return "str";
+        case DynamicType::Type::BOOL:   return "bool";
+        case DynamicType::Type::LIST:   return "list";
+        case DynamicType::Type::DICT:   return "dict";
+        case DynamicType::Type::SET:    return "set";
+        case DynamicType::Type::RANGE:  return "range";
+        case DynamicType::Type::BIGINT: return "bigint";
+        case DynamicType::Type::SLICE:  return "slice";
+        case DynamicType::Type::VIEW:   return "view";
+        case DynamicType::Type::GENERATOR: return "generator";
+        default: return "?";
+    }
+}
+
+struct ProfileRow {
+    const char *name;
+    const char *lhs;
+    // Empty for unary operations and events
+    const char *rhs;
+    std::uint64_t count;
+};
+
+std::vector<ProfileRow> profile_dispatch_rows() {
+    std::vector<ProfileRow> rows;
+    for (std::size_t op = 0; op < transpyler_profile::OPS; ++op) {
+        bool unary = op == static_cast<std::size_t>(transpyler_profile::Op::NEG);
+        for (std::size_t lhs = 0; lhs < transpyler_profile::TYPES; ++lhs) {
+            for (std::size_t rhs = 0; rhs < transpyler_profile::TYPES; ++rhs) {
+                std::uint64_t count = transpyler_profile::counters.dispatches[op][lhs][rhs].load(std::memory_order_relaxed);
+                if (count != 0) rows.push_back(ProfileRow{PROFILE_OPS[op], profile_type_name(lhs), unary ? "" : profile_type_name(rhs), count});
+            }
+        }
+    }
+    std::stable_sort(rows.begin(), rows.end(), [](const ProfileRow &a, const ProfileRow &b) { return a.count > b.count; });
+    return rows;
+}
+
+std::vector<ProfileRow> profile_event_rows() {
+    std::vector<ProfileRow> rows;
+    for (std::size_t event = 0; event < transpyler_profile::EVENTS; ++event) {
+        for (std::size_t type = 0; type < transpyler_profile::TYPES; ++type) {
+            std::uint64_t count = transpyler_profile::counters.events[event][type].load(std::memory_order_relaxed);
+            if (count != 0) rows.push_back(ProfileRow{PROFILE_EVENTS[event], profile_type_name(type), "", count});
+        }
+    }
+    return rows;
+}
+
+// Functions by self time, the most expensive first
+std::vector<const transpyler_profile::FunctionStats *> profile_functions() {
+    std::vector<const transpyler_profile::FunctionStats *> functions;
+    for (const transpyler_profile::FunctionStats *f = transpyler_profile::registeredFunctions.load(); f != nullptr; f = f->next) {
+        functions.push_back(f);
+    }
+    std::stable_sort(functions.begin(), functions.end(),
+                     [](const transpyler_profile::FunctionStats *a, const transpyler_profile::FunctionStats *b) { return a->selfNs > b->selfNs; });
+    return functions;
+}
+
+void appendf(std::string &out, const char *format, ...) {
+    char line[512];
+    va_list args;
+    va_start(args, format);
+    int length = std::vsnprintf(line, sizeof(line), format, args);
+    va_end(args);
+    if (length > 0) out.append(line, std::min(static_cast<std::size_t>(length), sizeof(line) - 1));
+}
+
+unsigned long long profile_value(const std::atomic<std::uint64_t> &counter) {
+    return static_cast<unsigned long long>(counter.load(std::memory_order_relaxed));
+}
+
+std::string profile_table(double total_ms) {
+    std::string out;
+    appendf(out, "== TransPYler profile: %.3f ms ==\n", total_ms);
+    appendf(out, "%-10s %-8s %-8s %14s\n", "operation", "lhs", "rhs", "dispatches");
+    for (const ProfileRow &row : profile_dispatch_rows()) {
+        appendf(out, "%-10s %-8s %-8s %14llu\n", row.name, row.lhs, row.rhs, static_cast<unsigned long long>(row.count));
+    }
+    appendf(out, "\n%-10s %-8s %23s\n", "event", "type", "count");
+    for (const ProfileRow &row : profile_event_rows()) {
+        appendf(out, "%-10s %-8s %23llu\n", row.name, row.lhs, static_cast<unsigned long long>(row.count));
+    }
+    appendf(out, "%-19s %23llu (%llu bytes)\n", "heap allocations", profile_value(transpyler_profile::counters.allocations),
+            profile_value(transpyler_profile::counters.allocatedBytes));
+    appendf(out, "%-19s %23llu\n", "exceptions", profile_value(transpyler_profile::counters.exceptions));
+
+    std::vector<const transpyler_profile::FunctionStats *> functions = profile_functions();
+    if (!functions.empty()) {
+        appendf(out, "\n%-24s %12s %12s %12s\n", "function", "calls", "total ms", "self ms");
+        for (const transpyler_profile::FunctionStats *f : functions) {
+            appendf(out, "%-24s %12llu %12.3f %12.3f\n", f->name, static_cast<unsigned long long>(f->calls), f->totalNs / 1e6, f->selfNs / 1e6);
+        }
+    }
+    return out;
+}
+
+std::string profile_json(double total_ms) {
+    std::string out;
+    appendf(out, "{\"total_ms\": %.3f, \"dispatches\": [", total_ms);
+    const char *separator = "";
+    for (const ProfileRow &row : profile_dispatch_rows()) {
+        appendf(out, "%s{\"op\": \"%s\", \"lhs\": \"%s\", \"rhs\": \"%s\", \"count\": %llu}", separator, row.name, row.lhs, row.rhs,
+                static_cast<unsigned long long>(row.count));
+        separator = ", ";
+    }
+    out += "], \"events\": [";
+    separator = "";
+    for (const ProfileRow &row : profile_event_rows()) {
+        appendf(out, "%s{\"event\": \"%s\", \"type\": \"%s\", \"count\": %llu}", separator, row.name, row.lhs,
+                static_cast<unsigned long long>(row.count));
+        separator = ", ";
+    }
+    appendf(out, "], \"allocations\": %llu, \"allocated_bytes\": %llu, \"exceptions\": %llu, \"functions\": [",
+            profile_value(transpyler_profile::counters.allocations), profile_value(transpyler_profile::counters.allocatedBytes),
+            profile_value(transpyler_profile::counters.exceptions));
+    separator = "";
+    // Function names are Python identifiers: nothing to escape
+    for (const transpyler_profile::FunctionStats *f : profile_functions()) {
+        appendf(out, "%s{\"name\": \"%s\", \"calls\": %llu, \"total_ms\": %.3f, \"self_ms\": %.3f}", separator, f->name,
+                static_cast<unsigned long long>(f->calls), f->totalNs / 1e6, f->selfNs / 1e6);
+        separator = ", ";
+    }
+    out += "]}\n";
+    return out;
+}
+
+const std::chrono::steady_clock::time_point profile_start = std::chrono::steady_clock::now();
+
+// Static objects are destroyed after main() returns: report then
+struct ProfileAtExit {
+    ~ProfileAtExit() { transpyler_profile::report(); }
+} profile_at_exit;
+
+}  // namespace
+
+void transpyler_profile::report() {
+    static std::atomic<bool> reported{false};
+    if (reported.exchange(true)) {
+        return;
+    }
+    // After everything the program printed, as a terminal shows both streams
+    stdout_buffer.flush();
+    double total_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - profile_start).count();
+    const char *format = std::getenv("TRANSPYLER_PROFILE_FORMAT");
+    std::string text = format != nullptr && std::strcmp(format, "json") == 0 ? profile_json(total_ms) : profile_table(total_ms);
+
+    const char *path = std::getenv("TRANSPYLER_PROFILE_OUTPUT");
+    std::FILE *file = path != nullptr && *path != '\0' ? std::fopen(path, "w") : nullptr;
+    std::fwrite(text.data(), 1, text.size(), file != nullptr ? file : stderr);
+    if (file != nullptr) {
+        std::fclose(file);
+    }
+}
+#endif // TRANSPYLER_PROFILE
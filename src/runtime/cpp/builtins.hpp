@@ -4,31 +4,60 @@
 #define BUILTINS_HPP
 
 #include "DynamicType.hpp"
+#include <algorithm>
+#include <cstdlib>
 #include <iostream>
+#ifdef TRANSPYLER_PARALLEL
+#include <mutex>
+#endif
 
 // Python built-in functions
 
+/**
+ * Buffered standard output. print() formats straight into `text`, which is
+ * written to stdout once it passes FLUSH_SIZE, before input() reads, at exit
+ * and before an uncaught exception ends the program, so lines are never
+ * flushed one by one. In -DTRANSPYLER_PARALLEL builds print() holds `lock`,
+ * so lines printed by parallel_map() workers never interleave.
+ */
+struct OutputBuffer {
+    static constexpr std::size_t FLUSH_SIZE = 1 << 16;
+    std::string text;
+#ifdef TRANSPYLER_PARALLEL
+    std::mutex lock;
+#endif
+
+    OutputBuffer();
+    ~OutputBuffer();
+    void flush();
+};
+
+extern OutputBuffer stdout_buffer;
+
 // print() - Output to console
 template<typename... Args> // Folding template to accept multiple arguments
 void print(const Args&... args) {
-    if constexpr (sizeof...(args) == 0) { // No arguments
-        std::cout << std::endl;
-    } else {
-        bool first = true;
-        /*This prints all the arguments, if the argument isn't the first one,
-        then it should leave a space before the argument*/
-        ((std::cout << (first ? (first = false, "") : " ") << args.toString()), ...);
-        std::cout << std::endl;
+#ifdef TRANSPYLER_PARALLEL
+    std::lock_guard<std::mutex> guard(stdout_buffer.lock);
+#endif
+    std::string &out = stdout_buffer.text;
+    [[maybe_unused]] bool first = true;
+    /*This prints all the arguments, if the argument isn't the first one,
+    then it should leave a space before the argument*/
+    ((out += (first ? (first = false, "") : " "), args.formatTo(out)), ...);
+    out += '\n';
+    if (out.size() >= OutputBuffer::FLUSH_SIZE) {
+        stdout_buffer.flush();
     }
 }
 
 // len() - Get length of sequence
 DynamicType len(const DynamicType& value);
 
-// range() - Generate sequence of integers
-DynamicType range(int stop);
-DynamicType range(int start, int stop);
-DynamicType range(int start, int stop, int step);
+// range() - Lazy sequence of integers (no element storage)
+DynamicType range(long long stop);
+DynamicType range(long long start, long long stop);
+DynamicType range(long long start, long long stop, long long step);
 DynamicType range(const DynamicType& stop);
 DynamicType range(const DynamicType& start, const DynamicType& stop);
 DynamicType range(const DynamicType& start, const DynamicType& stop, const DynamicType& step);
@@ -43,16 +72,59 @@ DynamicType bool_(const DynamicType& value);
 DynamicType abs(const DynamicType& value);
 DynamicType min(const DynamicType& a, const DynamicType& b);
 DynamicType max(const DynamicType& a, const DynamicType& b);
+// Smallest or largest element of an iterable; throws if it is empty
+DynamicType min(const DynamicType& iterable);
+DynamicType max(const DynamicType& iterable);
 DynamicType sum(const DynamicType& iterable);
+// New list of the elements of an iterable in ascending order
+DynamicType sorted(const DynamicType& iterable);
 
 // Utility functions
 DynamicType type(const DynamicType& value);
+// input() reads stdin in large blocks and splits lines from the buffer
 DynamicType input(const std::string& prompt);
+DynamicType input(const DynamicType& prompt);
 DynamicType input();
 
 // Collection functions
 DynamicType set();
 DynamicType set(const DynamicType& iterable);
+// New list of the elements of any iterable (list(d.items()), list(generator))
+DynamicType list();
+DynamicType list(const DynamicType& iterable);
+// next() - Resume a generator; without a default an exhausted one raises StopIteration
+DynamicType next(const DynamicType& iterator);
+DynamicType next(const DynamicType& iterator, const DynamicType& fallback);
+
+/**
+ * save() - Write a value to a binary file that load() reads back; packed int
+ * and float lists are stored as plain arrays, so load() of a large table
+ * maps the file instead of parsing it. Files are for the same machine type.
+ */
+DynamicType save(const DynamicType& value, const DynamicType& path);
+DynamicType load(const DynamicType& path);
+
+/**
+ * parallel_map() - List of fn(item) for every item of an iterable, in order,
+ * like list(map(fn, iterable)). In -DTRANSPYLER_PARALLEL builds the calls are
+ * spread over all cores (DynamicType::parallelFor()), so fn must not depend
+ * on the order of the calls or write a collection another call uses; it may
+ * read shared values and print. The first exception a call raises is raised
+ * here once the running calls finish.
+ */
+template<typename Fn>
+DynamicType parallel_map(Fn fn, const DynamicType& iterable) {
+    const DynamicType items = iterable.getType() == DynamicType::Type::LIST ? iterable : list(iterable);
+    std::vector<DynamicType> results(items.size());
+    // Small pieces, so idle threads have work to steal when calls differ in cost
+    std::size_t grain = results.size() / (DynamicType::parallelThreads() * 16);
+    DynamicType::parallelFor(results.size(), grain, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            results[i] = fn(items.getItem(DynamicType(static_cast<long long>(i))));
+        }
+    });
+    return DynamicType(std::move(results));
+}
 
 // Data structure helper functions
 DynamicType sublist(const DynamicType& list, const DynamicType& start, const DynamicType& end);
@@ -1,19 +1,82 @@
 # src/tools/transpile_cli.py
 import argparse
+import os
+import shlex
+import sys
+import tempfile
+import time
+from pathlib import Path
+
+from src.compiler.batch import build_all, collect_sources, print_report, write_timings
+from src.compiler.build_cache import BuildCache, RUNTIME_DIR, RUNTIME_SOURCES
 from src.compiler.transpiler import Transpiler
 
 def main():
     p = argparse.ArgumentParser(description="Transpile Fangless Python to C++")
-    p.add_argument("input", help="Input .flpy/.py file")
-    p.add_argument("-o", "--output", default="output.cpp", help="Output C++ file")
+    p.add_argument("input", help="Input .flpy/.py file, or with --batch a directory or manifest")
+    p.add_argument("-o", "--output", help="Output C++ file (default output.cpp), or with --batch the output directory (default build)")
+    p.add_argument(
+        "--profile",
+        action="store_true",
+        help="Time every function; compile with -DTRANSPYLER_PROFILE to get the report",
+    )
+    p.add_argument("--compile", metavar="EXE", help="Also compile the C++ and the runtime into EXE")
+    p.add_argument("--cxx", default=os.environ.get("CXX", "g++"), help="Compiler for --compile (default $CXX or g++)")
+    p.add_argument("--cxxflags", default="-std=c++20 -Wall", help="Compiler flags for --compile")
+    p.add_argument("--no-cache", action="store_true", help="Transpile and compile without the build cache")
+    p.add_argument("--cache-dir", help="Build cache directory (default $TRANSPYLER_CACHE_DIR or ~/.cache/transpyler)")
+    p.add_argument(
+        "--batch",
+        action="store_true",
+        help="Transpile and compile every script of a directory or of a manifest (one path per line)",
+    )
+    p.add_argument("-j", "--jobs", type=int, help="Parallel compilations for --batch (default: one per core)")
+    p.add_argument("--transpile-only", action="store_true", help="With --batch, do not compile")
+    p.add_argument("--timings", metavar="CSV", help="With --batch, also write the per-file timings to CSV")
     args = p.parse_args()
 
+    if args.batch:
+        sys.exit(batch(args))
+
     with open(args.input, "r", encoding="utf-8") as f:
         source = f.read()
 
-    t = Transpiler()
-    out = t.transpile(source, filename=args.output)
+    cache = None if args.no_cache else BuildCache(args.cache_dir)
+    t = Transpiler(profile=args.profile, cache=cache)
+    out = t.transpile(source, filename=args.output or "output.cpp")
     print(f"[ok] C++ generated at: {out}")
 
+    if args.compile:
+        flags = [*shlex.split(args.cxxflags), "-I", str(RUNTIME_DIR)]
+        sources = [out, *map(str, RUNTIME_SOURCES)]
+        if cache is not None:
+            result = cache.compile(args.cxx, flags, sources, args.compile)
+        else:
+            # Without the cache, compile through a scratch cache that is not kept
+            with tempfile.TemporaryDirectory(prefix="transpyler-") as scratch:
+                result = BuildCache(scratch).compile(args.cxx, flags, sources, args.compile)
+        sys.stderr.write(result.stderr.decode(errors="replace"))
+        if result.returncode != 0:
+            sys.exit(result.returncode)
+        print(f"[ok] Executable built at: {args.compile}")
+
+def batch(args):
+    """--batch: returns the exit status, 1 when any script failed"""
+    target = Path(args.input)
+    sources = collect_sources(target)
+    root = target if target.is_dir() else target.parent
+    output_dir = args.output or "build"
+
+    start = time.perf_counter()
+    with tempfile.TemporaryDirectory(prefix="transpyler-") as scratch:
+        # Without the cache the batch still shares the runtime objects, through a scratch cache
+        cache = BuildCache(scratch if args.no_cache else args.cache_dir)
+        results = build_all(sources, output_dir, cache, cxx=args.cxx, flags=shlex.split(args.cxxflags),
+                            jobs=args.jobs, compile=not args.transpile_only, profile=args.profile, root=root)
+    print_report(results, time.perf_counter() - start)
+    if args.timings:
+        write_timings(results, args.timings)
+    return 1 if any(r.error is not None for r in results) else 0
+
 if __name__ == "__main__":
     main()
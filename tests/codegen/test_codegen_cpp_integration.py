@@ -46,7 +46,7 @@ class TestCodeGeneratorCppIntegration:
         assert "using namespace std;" in code
 
         # Check function
-        assert "_fn_add(DynamicType a, DynamicType b)" in code
+        assert "_fn_add(const DynamicType &a, const DynamicType &b)" in code
         assert "DynamicType x = " in code
         assert "(a) + (b)" in code
 
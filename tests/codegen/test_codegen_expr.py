@@ -15,6 +15,7 @@ import pytest
 from src.core import (
     LiteralExpr, Identifier, UnaryExpr, BinaryExpr, CallExpr
 )
+from src.core.ast.ast_expressions import ComparisonExpr
 from src.codegen.expr_generator import ExprGenerator
 from src.codegen.scope_manager import ScopeManager
 
@@ -170,10 +171,10 @@ class TestExprGeneratorBinaryOps:
         assert "(a) % (b)" in code
 
     def test_binary_power_maps_to_pow(self):
-        """Test power operator ** maps to pow()."""
+        """Test power operator ** maps to DynamicType::pow, which keeps ints exact."""
         expr = BinaryExpr(left=Identifier(name="a"), op="**", right=Identifier(name="b"))
         code = self.gen.visit(expr)
-        assert "pow(" in code and "toDouble()" in code
+        assert code == "(a).pow(b)"
 
     def test_binary_equality(self):
         """Test equality operator."""
@@ -207,6 +208,14 @@ class TestExprGeneratorBinaryOps:
         # Logical operators now wrap with toBool() conversions
         assert "toBool()" in code and "||" in code
 
+    def test_condition_is_raw_bool(self):
+        """Test conditions use comparison results without a DynamicType round trip."""
+        less = ComparisonExpr(left=Identifier(name="a"), op="<", right=Identifier(name="b"))
+        expr = BinaryExpr(left=less, op="and", right=UnaryExpr(op="not", operand=Identifier(name="c")))
+        code = self.gen.visit_condition(expr)
+        assert code == "(((a) < (b)) && ((!((c).toBool()))))"
+        assert self.gen.visit(less) == "DynamicType((a) < (b))"
+
 
 # ============ ExprGenerator Call Expression Tests ============
 
@@ -251,6 +260,28 @@ class TestExprGeneratorCallExpr:
         code = self.gen.visit(expr)
         assert "_fn_add(" in code and "(x) + (y)" in code
 
+    def test_parallel_map_call(self):
+        """Test parallel_map passes a user function by name and wraps a builtin in a lambda."""
+        self.scope.declare("xs")
+        user = CallExpr(callee=Identifier(name="parallel_map"), args=[Identifier(name="square"), Identifier(name="xs")])
+        assert self.gen.visit(user) == "parallel_map(_fn_square, xs)"
+        builtin = CallExpr(callee=Identifier(name="parallel_map"), args=[Identifier(name="str"), Identifier(name="xs")])
+        assert self.gen.visit(builtin) == "parallel_map([](const DynamicType &item) { return str(item); }, xs)"
+
+    def test_parallel_map_needs_function_name(self):
+        """Test parallel_map rejects a first argument that is not a function name."""
+        expr = CallExpr(callee=Identifier(name="parallel_map"), args=[LiteralExpr(value=1), Identifier(name="xs")])
+        with pytest.raises(TypeError):
+            self.gen.visit(expr)
+
+    def test_save_load_call(self):
+        """Test save and load map to the runtime builtins."""
+        self.scope.declare("table")
+        save = CallExpr(callee=Identifier(name="save"), args=[Identifier(name="table"), LiteralExpr(value="t.bin")])
+        assert self.gen.visit(save).startswith("::save(table, ")
+        load = CallExpr(callee=Identifier(name="load"), args=[LiteralExpr(value="t.bin")])
+        assert self.gen.visit(load).startswith("::load(")
+
 
 if __name__ == "__main__":
     pytest.main([__file__, "-v"])
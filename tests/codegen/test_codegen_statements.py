@@ -65,6 +65,34 @@ class TestBasicStatementGeneratorAssign:
         assert "DynamicType c = " in code
         assert "(a) + (b)" in code
 
+    def test_augmented_add_is_in_place(self):
+        """Test x += y uses the in-place operator instead of building a new value."""
+        self.scope.declare("x")
+        stmt = Assign(target=Identifier(name="x"), op="+=", value=Identifier(name="y"))
+        assert self.gen.visit(stmt) == "x += (y);"
+
+    def test_self_concat_moves_target(self):
+        """Test x = x + a + b moves x into the sum."""
+        self.scope.declare("x")
+        value = BinaryExpr(
+            left=BinaryExpr(left=Identifier(name="x"), op="+", right=Identifier(name="a")),
+            op="+",
+            right=Identifier(name="b"),
+        )
+        code = self.gen.visit(Assign(target=Identifier(name="x"), value=value))
+        assert code == "x = ((std::move(x)) + (a)) + (b);"
+
+    def test_self_concat_reading_target_later_is_not_moved(self):
+        """Test x = x + a + x keeps x intact for the operand that reads it again."""
+        self.scope.declare("x")
+        value = BinaryExpr(
+            left=BinaryExpr(left=Identifier(name="x"), op="+", right=Identifier(name="a")),
+            op="+",
+            right=Identifier(name="x"),
+        )
+        code = self.gen.visit(Assign(target=Identifier(name="x"), value=value))
+        assert "std::move" not in code
+
     def test_assign_non_identifier_target_raises_error(self):
         """Test that non-identifier targets raise NotImplementedError."""
         stmt = Assign(target=LiteralExpr(value=10), value=LiteralExpr(value=20))
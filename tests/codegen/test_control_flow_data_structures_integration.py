@@ -45,6 +45,7 @@ class TestControlFlowDataStructuresIntegration:
             "-I", str(runtime_path),
             cpp_file,
             str(runtime_path / "DynamicType.cpp"),
+            str(runtime_path / "BigInt.cpp"),
             str(runtime_path / "builtins.cpp"),
             "-o", exe_file
         ]
@@ -39,6 +39,7 @@ class TestDataStructureMethods(unittest.TestCase):
             "g++", "-std=c++17",
             str(cpp_file),
             str(runtime_dir / "DynamicType.cpp"),
+            str(runtime_dir / "BigInt.cpp"),
             str(runtime_dir / "builtins.cpp"),
             f"-I{runtime_dir}",
             "-o", str(exe_file)
@@ -42,6 +42,7 @@ class TestDataStructuresIntegration(unittest.TestCase):
             "g++", "-std=c++17",
             str(cpp_file),
             str(runtime_dir / "DynamicType.cpp"),
+            str(runtime_dir / "BigInt.cpp"),
             str(runtime_dir / "builtins.cpp"),
             f"-I{runtime_dir}",
             "-o", str(exe_file)
@@ -309,8 +310,9 @@ if __name__ == "__main__":
 """
         output = self._transpile_and_run(python_code)
         
-        self.assertIn("Mixed set length: 3", output)
-        self.assertIn("After adds: 5", output)
+        # True == 1 hash and compare equal, as in Python, so they are one element
+        self.assertIn("Mixed set length: 2", output)
+        self.assertIn("After adds: 4", output)
 
     # ========== COMPLEX SCENARIOS ==========
     
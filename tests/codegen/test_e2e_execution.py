@@ -9,9 +9,14 @@ produces correct output when executed.
 import pytest
 import tempfile
 import os
+import json
+import shutil
 import subprocess
 from pathlib import Path
 from src.compiler.transpiler import Transpiler
+from src.compiler import build_cache
+from src.compiler.build_cache import BuildCache
+from src.compiler.batch import build_all, collect_sources
 
 
 class TestEndToEndExecution:
@@ -25,15 +30,16 @@ class TestEndToEndExecution:
     def runtime_path(self):
         return Path("src/runtime/cpp")
     
-    def compile_and_run(self, cpp_file, runtime_path):
+    def compile_and_run(self, cpp_file, runtime_path, flags=(), stdin=None, env=None):
         """Compile and execute C++ code, return output."""
         exe_file = cpp_file.replace('.cpp', '_exec')
         
         compile_cmd = [
-            "g++", "-std=c++17", 
+            "g++", "-std=c++20", *flags,
             "-I", str(runtime_path),
             cpp_file,
             str(runtime_path / "DynamicType.cpp"),
+            str(runtime_path / "BigInt.cpp"),
             str(runtime_path / "builtins.cpp"),
             "-o", exe_file
         ]
@@ -43,7 +49,7 @@ class TestEndToEndExecution:
         if compile_result.returncode != 0:
             return None, compile_result.stderr, compile_result.returncode
         
-        run_result = subprocess.run([f"./{exe_file}"], capture_output=True, text=True, timeout=5)
+        run_result = subprocess.run([f"./{exe_file}"], input=stdin, capture_output=True, text=True, timeout=5, env=env)
         
         # Cleanup
         if os.path.exists(exe_file):
@@ -247,9 +253,25 @@ print(a != b)
         assert "0" in lines[2] or "false" in lines[2].lower()
         # a != b: True
         assert "1" in lines[3] or "true" in lines[3].lower()
-        
+
         os.remove(cpp_file)
-    
+
+    def test_nan_is_unordered_against_every_number(self, transpiler, runtime_path):
+        """Test every ordering with a NaN is False, whatever kind of number the other side is."""
+        source = """
+nan = float("nan")
+for x in [1, 2.5, True, 2 ** 70, nan]:
+    print(x < nan, x <= nan, x > nan, x >= nan, nan < x, nan <= x, nan > x, nan >= x, x == nan)
+"""
+
+        cpp_file = transpiler.transpile(source, "test_e2e_nan.cpp")
+        stdout, stderr, retcode = self.compile_and_run(cpp_file, runtime_path)
+
+        assert retcode == 0, f"Execution failed: {stderr}"
+        assert stdout.strip().split('\n') == [" ".join(["False"] * 9)] * 5
+
+        os.remove(cpp_file)
+
     def test_logical_operators_execution(self, transpiler, runtime_path):
         """Test logical operators work correctly."""
         source = """
@@ -345,6 +367,1198 @@ for num in range(2, 11):
         assert "7" in lines[3]
         
         os.remove(cpp_file)
+    
+    def test_list_argument_aliasing_execution(self, transpiler, runtime_path):
+        """Test lists are passed by reference like Python objects."""
+        source = """
+def fill(items):
+    items.append(4)
+    items[0] = 10
+
+data = [1, 2, 3]
+alias = data
+fill(data)
+print(alias)
+print(len(data))
+"""
+        
+        cpp_file = transpiler.transpile(source, "test_e2e_alias.cpp")
+        stdout, stderr, retcode = self.compile_and_run(cpp_file, runtime_path)
+        
+        assert retcode == 0, f"Execution failed: {stderr}"
+        lines = stdout.strip().split('\n')
+        assert "[10, 2, 3, 4]" in lines[0]  # Mutations reach the caller and every alias
+        assert "4" in lines[1]
+        
+        os.remove(cpp_file)
+
+    def test_lazy_range_and_loop_execution(self, transpiler, runtime_path):
+        """Test range() values are lazy and loops iterate the live list."""
+        source = """
+r = range(2, 10, 3)
+print(r)
+print(len(r), r[1], sum(r))
+print(5 in r, 6 in r)
+items = [1, 2]
+for x in items:
+    if x < 3:
+        items.append(x + 10)
+print(items)
+for ch in "ab":
+    print(ch)
+"""
+        
+        cpp_file = transpiler.transpile(source, "test_e2e_range.cpp")
+        stdout, stderr, retcode = self.compile_and_run(cpp_file, runtime_path)
+        
+        assert retcode == 0, f"Execution failed: {stderr}"
+        lines = stdout.strip().split('\n')
+        assert lines[0] == "range(2, 10, 3)"
+        assert lines[1] == "3 5 15"
+        assert lines[2] == "True False"
+        assert lines[3] == "[1, 2, 11, 12]"  # Elements appended inside the loop are visited
+        assert lines[4:6] == ["a", "b"]
+        
+        os.remove(cpp_file)
+
+    def test_lowered_locals_execution(self, transpiler, runtime_path):
+        """Test natively typed locals keep Python semantics."""
+        source = """
+def stats(n):
+    evens = 0
+    half = 0.0
+    for k in range(1, n + 1):
+        half += k / 2
+        if k % 2 == 0:
+            evens += 1
+    print(evens, half == 27.5, -7 // 2, -7 % 3)
+    return evens
+
+print(stats(10) + 1)
+"""
+        
+        cpp_file = transpiler.transpile(source, "test_e2e_lowered.cpp")
+        with open(cpp_file) as f:
+            assert "long long evens = 0LL;" in f.read()
+        stdout, stderr, retcode = self.compile_and_run(cpp_file, runtime_path)
+        
+        assert retcode == 0, f"Execution failed: {stderr}"
+        lines = stdout.strip().split('\n')
+        assert lines[0] == "5 True -4 2"  # Floor division and modulo round like Python
+        assert lines[1] == "6"
+        
+        os.remove(cpp_file)
+
+    def test_specialized_clones_execution(self, transpiler, runtime_path):
+        """Test typed clones and the dispatch stub agree with the generic version."""
+        source = """
+def fib(n):
+    if n < 2:
+        return n
+    return fib(n - 1) + fib(n - 2)
+
+def total(n):
+    s = 0
+    for i in range(n):
+        s += fib(i)
+    return s
+
+print(fib(20), total(15))
+print(fib(True))
+"""
+        
+        cpp_file = transpiler.transpile(source, "test_e2e_clones.cpp")
+        with open(cpp_file) as f:
+            code = f.read()
+        assert "DynamicType _fn_fib__i(long long n) {" in code  # fib can outgrow a long long
+        assert "s += (_fn_fib__i(i));" in code  # Clone calls clone directly
+        stdout, stderr, retcode = self.compile_and_run(cpp_file, runtime_path)
+        
+        assert retcode == 0, f"Execution failed: {stderr}"
+        lines = stdout.strip().split('\n')
+        assert lines[0] == "6765 986"
+        assert lines[1] == "True"
+        
+        os.remove(cpp_file)
+
+    def test_operator_fast_and_slow_paths(self, transpiler, runtime_path):
+        """Test inline int/double operators agree with the out-of-line slow paths."""
+        source = """
+a = 7
+b = 2
+x = 1.5
+print(a + b, a - b, a * b, a // b, a % b, -a // b, -a % b)
+print(a + x, x * a, a / b, x < a, a <= 7, b > a, x == 1.5, a != 7)
+print("ab" + "c", "ab" * 2, [1] + [2], "a" < "b", a == "7")
+print([1, 2] < [1, 3], [10] > [9], [1] <= [1], "b" >= "a", 3 >= 3.0)
+"""
+        
+        cpp_file = transpiler.transpile(source, "test_e2e_operators.cpp")
+        stdout, stderr, retcode = self.compile_and_run(cpp_file, runtime_path)
+        
+        assert retcode == 0, f"Execution failed: {stderr}"
+        lines = stdout.strip().split('\n')
+        assert lines[0] == "9 5 14 3 1 -4 1"
+        assert lines[2] == "abc abab [1, 2] True False"
+        assert lines[1].split()[3:] == ["True", "True", "False", "True", "False"]  # 1.5 < 7 compares values
+        assert lines[3] == "True True True True True"  # Lists compare element by element
+        
+        os.remove(cpp_file)
+
+    def test_in_place_concat_keeps_aliasing(self, transpiler, runtime_path):
+        """Test += and x = x + y reuse buffers without changing Python aliasing."""
+        source = """
+def build(n):
+    out = []
+    s = ""
+    for i in range(n):
+        out += [i]
+        s = s + str(i) + ","
+    t = out
+    out = out + [99]
+    t += [7]
+    print(out, t, s)
+
+def pairs():
+    p = (1, 2)
+    q = p
+    p += (3, 4)
+    return [len(p), len(q)]
+
+a = [1, 2]
+b = a
+a += [3]
+a = a + a
+print(a, b)
+w = "x"
+v = w
+w += "y"
+print(w, v)
+e = [1]
+e.extend(e)
+e.extend(range(2))
+print(e)
+build(4)
+t = (1, 2)
+u = t
+t += (3, 4)
+r = u + (5, 6)
+k = r
+r += (7, 8)
+print(len(t), len(u), len(r), len(k), pairs())
+"""
+        
+        cpp_file = transpiler.transpile(source, "test_e2e_concat.cpp")
+        stdout, stderr, retcode = self.compile_and_run(cpp_file, runtime_path)
+        
+        assert retcode == 0, f"Execution failed: {stderr}"
+        lines = stdout.strip().split('\n')
+        assert lines[0] == "[1, 2, 3, 1, 2, 3] [1, 2, 3]"  # += extends the shared list
+        assert lines[1] == "xy x"  # Strings stay immutable for other handles
+        assert lines[2] == "[1, 1, 0, 1]"
+        assert lines[3] == "[0, 1, 2, 3, 99] [0, 1, 2, 3, 7] 0,1,2,3,"
+        assert lines[4] == "4 2 6 4 [4, 2]"  # Tuples are rebound, never extended under an alias
+        
+        os.remove(cpp_file)
+
+    def test_dict_order_and_typed_keys(self, transpiler, runtime_path):
+        """Test dicts keep insertion order, typed keys and survive deletes and growth."""
+        source = """
+counts = {}
+for w in ["b", "a", "c", "a", "b", "a"]:
+    if w in counts:
+        counts[w] += 1
+    else:
+        counts[w] = 1
+print(counts)
+sq = {3: 9, 1: 1, 2: 4}
+sq[10] = 100
+sq.pop(1)
+print(sq, sq[2], 2 in sq, "2" in sq, len(sq))
+big = {}
+for i in range(1000):
+    big[i] = i * i
+for i in range(0, 1000, 2):
+    big.pop(i)
+total = 0
+for k in big:
+    total += big[k]
+print(len(big), total, big[999], {"x": 1, "y": 2} == {"y": 2, "x": 1})
+"""
+        
+        cpp_file = transpiler.transpile(source, "test_e2e_dict.cpp")
+        stdout, stderr, retcode = self.compile_and_run(cpp_file, runtime_path)
+        
+        assert retcode == 0, f"Execution failed: {stderr}"
+        lines = stdout.strip().split('\n')
+        assert lines[0] == "{'b': 2, 'a': 3, 'c': 1}"  # Insertion order, not sorted
+        assert lines[1] == "{3: 9, 2: 4, 10: 100} 4 True False 3"  # 2 and "2" are different keys
+        assert lines[2] == "500 166666500 998001 True"
+        
+        os.remove(cpp_file)
+
+    def test_list_pop_insert_and_reserve(self, transpiler, runtime_path):
+        """Test pop/insert at both ends, negative indices, and reserve() hints before append loops."""
+        source = """
+queue = []
+for i in range(6):
+    queue.append(i)
+queue.insert(0, -1)
+queue.insert(-1, 99)
+queue.insert(100, 7)
+print(queue, queue[-1], queue[-3])
+first = queue.pop(0)
+last = queue.pop()
+print(first, last, queue.pop(-2), queue)
+words = ["a", "b"]
+for i in range(2000):
+    words.insert(0, "x")
+    words.pop()
+    words.append("y")
+    words.pop(0)
+print(len(words), words[0], words[-1])
+total = 0
+while len(queue) > 0:
+    total += queue.pop(0)
+print(total, queue)
+countdown = []
+n = 4
+while n > 0:
+    countdown.append(n)
+    n = n - 1
+countdown[-1] = 0
+d = {"k": 1, "j": 2}
+print(countdown, d.pop("k"), d)
+"""
+
+        cpp_file = transpiler.transpile(source, "test_e2e_pop_insert.cpp")
+        with open(cpp_file) as f:
+            cpp = f.read()
+        # The for-range and the counting while loop both know their trip count
+        assert "(queue).reserve(" in cpp and "(countdown).reserve(" in cpp
+        stdout, stderr, retcode = self.compile_and_run(cpp_file, runtime_path)
+
+        assert retcode == 0, f"Execution failed: {stderr}"
+        lines = stdout.strip().split('\n')
+        assert lines[0] == "[-1, 0, 1, 2, 3, 4, 99, 5, 7] 7 99"
+        assert lines[1] == "-1 7 99 [0, 1, 2, 3, 4, 5]"
+        assert lines[2] == "2 a y"
+        assert lines[3] == "15 []"
+        assert lines[4] == "[4, 3, 2, 0] 1 {'j': 2}"
+
+        os.remove(cpp_file)
+
+    def test_set_algebra(self, transpiler, runtime_path):
+        """Test set deduplication, the |, &, -, ^ operators, the in-place set methods and erase churn."""
+        source = """
+ids = []
+for i in range(10000):
+    ids.append(i % 1000)
+unique = set(ids)
+print(len(unique), 999 in unique, 1000 in unique)
+evens = set()
+for i in range(0, 20, 2):
+    evens.add(i)
+small = {0, 1, 2, 3, 4, 5}
+print(len(evens | small), len(evens & small), len(evens - small), len(small - evens), len(evens ^ small))
+print(5 | 3, 6 & 3, 6 ^ 3, 1 + 2 & 3, 1 | 2 == 3, True & False, True | False)
+total = 0
+for x in small & evens:
+    total += x
+print(total)
+small.update([10, 11])
+small.intersection_update(evens | {11})
+print(len(small), 11 in small, 1 in small)
+small.difference_update({0, 2})
+print(len(small), small == {4, 10, 11}, small.union([1]) == {1, 4, 10, 11})
+for i in range(1000):
+    unique.remove(i)
+for i in range(5000):
+    unique.add(i)
+    unique.discard(i - 3)
+print(len(unique), unique == {4997, 4998, 4999})
+s = {1, 2, 3}
+s.symmetric_difference_update({3, 4})
+print(s == {1, 2, 4}, s.symmetric_difference({1}) == {2, 4}, s.difference([2]) == {1, 4}, s.intersection(range(2, 5)) == {2, 4})
+"""
+
+        cpp_file = transpiler.transpile(source, "test_e2e_set_algebra.cpp")
+        stdout, stderr, retcode = self.compile_and_run(cpp_file, runtime_path)
+
+        assert retcode == 0, f"Execution failed: {stderr}"
+        lines = stdout.strip().split('\n')
+        assert lines[0] == "1000 True False"
+        assert lines[1] == "13 3 7 3 10"
+        assert lines[2] == "7 2 5 3 True False True"
+        assert lines[3] == "6"
+        assert lines[4] == "5 True False"
+        assert lines[5] == "3 True True"
+        assert lines[6] == "3 True"
+        assert lines[7] == "True True True True"
+
+        os.remove(cpp_file)
+
+    def test_string_building(self, transpiler, runtime_path):
+        """Test in-place string accumulation, str.join and string repetition."""
+        source = """
+report = ""
+for i in range(5):
+    report = report + str(i) + ","
+print(report)
+line = "x"
+alias = line
+for i in range(3):
+    line += "-" + str(i)
+print(line, alias)
+fields = ["id", "name", "score"]
+print(", ".join(fields), "|".join([]), "-".join("abc"))
+rows = {"a": 1, "b": 2}
+print(";".join(rows))
+print("ab" * 3, 2 * "xy", "q" * 0, len("abc" * 1000))
+csv = ""
+for i in range(1000):
+    csv += ",".join([str(i), str(i * i)]) + "\\n"
+print(len(csv))
+cells = ["", ""]
+cells[1] += "z"
+cells[1] += "w"
+print(cells[1])
+l = [1, 2]
+l = l + [3] + l
+s = "ab"
+s = s + "-" + s
+print(l, s)
+"""
+
+        cpp_file = transpiler.transpile(source, "test_e2e_string_building.cpp")
+        with open(cpp_file) as f:
+            cpp = f.read()
+        # s = s + ... reuses s's buffer; s += "a" + b appends each piece
+        assert "report = ((std::move(report))" in cpp
+        assert "line += (str(i));" in cpp
+        stdout, stderr, retcode = self.compile_and_run(cpp_file, runtime_path)
+
+        assert retcode == 0, f"Execution failed: {stderr}"
+        lines = stdout.strip().split('\n')
+        assert lines[0] == "0,1,2,3,4,"
+        assert lines[1] == "x-0-1-2 x"
+        assert lines[2] == "id, name, score  a-b-c"
+        assert lines[3] == "a;b"
+        assert lines[4] == "ababab xyxy  3000"
+        assert lines[5] == "10427"
+        assert lines[6] == "zw"
+        assert lines[7] == "[1, 2, 3, 1, 2] ab-ab"
+
+        os.remove(cpp_file)
+
+    def test_generators_and_lazy_iteration(self, transpiler, runtime_path):
+        """Test generator functions and expressions, dict views and for k, v unpacking."""
+        source = """
+def squares(n):
+    for i in range(n):
+        if i == 4:
+            return
+        yield i * i
+
+def naturals():
+    n = 0
+    while True:
+        yield n
+        n += 1
+
+def evens(source):
+    for x in source:
+        if x % 2 == 0:
+            yield x
+
+ages = {"ana": 31, "bo": 25, "cy": 40}
+for name, age in ages.items():
+    print(name, age)
+print(name, age)
+print(ages.keys(), ages.values(), ages.items())
+print(len(ages.items()), "bo" in ages.keys(), 40 in ages.values(), type(ages.keys()))
+print(list(squares(10)), sum(squares(3)), next(squares(0), "none"))
+stream = evens(naturals())
+first = next(stream)
+second = next(stream)
+print(first, second, next(stream), type(stream))
+limit = 30
+print(sum(age for age in ages.values() if age > limit))
+print(list((n, a) for n, a in ages.items() if a < limit), ",".join(n for n in ages))
+print(sorted(set(x % 3 for x in range(10))), 9 in squares(10), max(squares(4)))
+for x in squares(3):
+    print(x)
+try_count = 0
+for key in ages:
+    try_count += 1
+print(try_count)
+"""
+
+        cpp_file = transpiler.transpile(source, "test_e2e_generators.cpp")
+        with open(cpp_file) as f:
+            cpp = f.read()
+        assert '#include "Generator.hpp"' in cpp
+        assert "DynamicType _fn_squares(DynamicType n)" in cpp
+        assert "__it_name.unpack(1, 2)" in cpp
+        stdout, stderr, retcode = self.compile_and_run(cpp_file, runtime_path)
+
+        assert retcode == 0, f"Execution failed: {stderr}"
+        lines = stdout.strip().split('\n')
+        assert lines[:3] == ["ana 31", "bo 25", "cy 40"]
+        assert lines[3] == "cy 40"
+        assert lines[4] == "dict_keys(['ana', 'bo', 'cy']) dict_values([31, 25, 40]) dict_items([('ana', 31), ('bo', 25), ('cy', 40)])"
+        assert lines[5] == "3 True True <class 'dict_keys'>"
+        assert lines[6] == "[0, 1, 4, 9] 5 none"
+        assert lines[7] == "0 2 4 <class 'generator'>"
+        assert lines[8] == "71"
+        assert lines[9] == "[[bo, 25]] ana,bo,cy"
+        assert lines[10] == "[0, 1, 2] True 9"
+        assert lines[11:14] == ["0", "1", "4"]
+        assert lines[14] == "3"
+
+        os.remove(cpp_file)
+
+    def test_generator_expression_late_binding(self, transpiler, runtime_path):
+        """Test generator expressions read outer variables when they resume, as in Python."""
+        source = """
+def table(n):
+    rows = []
+    for i in range(n):
+        rows.append(",".join(str(x * i) for x in range(3)))
+        step = i + 1
+        for y in (x * step for x in range(2)):
+            rows.append(y)
+    return rows
+
+k = 10
+g = (x + k for x in range(3))
+k = 20
+print(list(g))
+for i in range(2):
+    print(sum(x * i for x in range(4)), list(x + k for x in range(2)))
+print(table(2))
+"""
+
+        cpp_file = transpiler.transpile(source, "test_e2e_genexpr_binding.cpp")
+        stdout, stderr, retcode = self.compile_and_run(cpp_file, runtime_path)
+
+        assert retcode == 0, f"Execution failed: {stderr}"
+        assert stdout.strip().split('\n') == [
+            "[20, 21, 22]",
+            "0 [20, 21]",
+            "6 [20, 21]",
+            "[0,0,0, 0, 1, 0,1,2, 0, 2]",
+        ]
+        os.remove(cpp_file)
+
+        # A function's locals are copied into the generator, so rebinding one later is rejected
+        for body in [
+            "def f(n):\n    m = 1\n    g = (x * m for x in range(n))\n    m = 5\n    return g\n",
+            "gens = []\nfor i in range(3):\n    gens.append((x * i for x in range(2)))\n",
+        ]:
+            with pytest.raises(NotImplementedError, match="reassigned after the generator is created"):
+                transpiler.transpile(body, "test_e2e_genexpr_rebound.cpp")
+
+    def test_iteration_errors(self, transpiler, runtime_path):
+        """Test resizing a dict while iterating it and unpacking a wrong-sized item both raise."""
+        for body, message in [
+            ("d = {1: 2}\nfor k in d:\n    d[k + 1] = 0\n", "dictionary changed size during iteration"),
+            ("for a, b in [[1, 2], [3]]:\n    print(a, b)\n", "not enough values to unpack"),
+            ("def g():\n    yield 1\nit = g()\nprint(next(it))\nprint(next(it))\n", "StopIteration"),
+        ]:
+            cpp_file = transpiler.transpile(body, "test_e2e_iteration_errors.cpp")
+            stdout, stderr, retcode = self.compile_and_run(cpp_file, runtime_path)
+            assert retcode != 0
+            assert message in stderr
+            os.remove(cpp_file)
+
+    def test_structural_and_numeric_hashing(self, transpiler, runtime_path):
+        """Test equal values hash equal across numeric kinds and inside containers."""
+        source = """
+pairs = set()
+for i in range(3):
+    for j in range(3):
+        pairs.add([i % 2, j % 2])
+print(len(pairs), [1, 0] in pairs, [1, 2] in pairs)
+nums = {1, 1.0, True, 2, 2 ** 70, 2.0 ** 70}
+print(len(nums), 1.0 in nums, 2 ** 70 in nums)
+d = {}
+d[1] = "int"
+d[1.0] = "float"
+d[True] = "bool"
+print(len(d), d[1], 1 == 1.0, True == 1, True < 2, 2 ** 70 == 2.0 ** 70)
+words = {"ab" + "c", "abc", "a" + "bc"}
+print(len(words), {range(0): "a", range(3, 3): "b"}[range(5, 5)])
+a = 2 ** 53 + 1
+f = 2.0 ** 53
+b = 2 ** 64 + 1
+g = 2.0 ** 64
+print(a == f, a > f, f < a, a - 1 == f, b == g, b > g, b - 1 == g, len({a, f}), len({b, g}))
+print(2 ** 63 == 2.0 ** 63, 9223372036854775807 < 2.0 ** 63, -3 > -3.5, 10 ** 400 < float("inf"))
+"""
+        
+        cpp_file = transpiler.transpile(source, "test_e2e_hashing.cpp")
+        stdout, stderr, retcode = self.compile_and_run(cpp_file, runtime_path)
+        
+        assert retcode == 0, f"Execution failed: {stderr}"
+        lines = stdout.strip().split('\n')
+        assert lines[0] == "4 True False"  # Lists hash by their elements
+        assert lines[1] == "3 True True"
+        assert lines[2] == "1 bool True True True True"  # One key: 1 == 1.0 == True
+        assert lines[3] == "1 b"  # Empty ranges are equal and hash equal
+        # Ints and doubles compare exactly, not after rounding the int to a double
+        assert lines[4] == "False True True True False True True 2 2"
+        assert lines[5] == "True True True True"
+        
+        os.remove(cpp_file)
+
+    def test_hoisted_literal_constants(self, transpiler, runtime_path):
+        """Test repeated literals share one interned constant that appends never modify."""
+        source = """
+def build(n):
+    counts = {"ab": 0}
+    s = "ab"
+    for i in range(n):
+        s += "ab"
+        counts["ab"] = counts["ab"] + 1
+    return [s, counts["ab"], "ab", 1180591620717411303424 + n]
+
+print(build(3))
+print(build(1))
+"""
+        
+        cpp_file = transpiler.transpile(source, "test_e2e_literals.cpp")
+        with open(cpp_file) as f:
+            cpp_code = f.read()
+        # One interned constant per distinct literal, built once before main()
+        assert cpp_code.count('DynamicType::intern("ab")') == 1
+        assert 'BigInt::fromString("1180591620717411303424")' in cpp_code.split("int main()")[0]
+        stdout, stderr, retcode = self.compile_and_run(cpp_file, runtime_path)
+        
+        assert retcode == 0, f"Execution failed: {stderr}"
+        lines = stdout.strip().split('\n')
+        assert lines[0] == "[abababab, 3, ab, 1180591620717411303427]"
+        assert lines[1] == "[abab, 1, ab, 1180591620717411303425]"
+        
+        os.remove(cpp_file)
+
+    def test_slice_views(self, transpiler, runtime_path):
+        """Test slices follow Python's bounds and stay independent of their list."""
+        source = """
+def total(a):
+    if len(a) <= 2:
+        return sum(a)
+    mid = len(a) // 2
+    return total(a[:mid]) + total(a[mid:])
+
+a = [5, 3, 9, 1, 7, 2, 8]
+print(total(a), a[-2:], a[::2], a[5:1:-1], a[10:], a[-100:2])
+b = a[1:5]
+c = b[::-1]
+a[2] = 100
+print(a, b, c, len(c), c[0])
+b.append(4)
+d = a[:]
+d[0] = 0
+print(b, c, a[0], a[1:3] == [3, 100], 100 in a[1:3], "hello"[1:-1], "hello"[::-1])
+"""
+        
+        cpp_file = transpiler.transpile(source, "test_e2e_slices.cpp")
+        stdout, stderr, retcode = self.compile_and_run(cpp_file, runtime_path)
+        
+        assert retcode == 0, f"Execution failed: {stderr}"
+        lines = stdout.strip().split('\n')
+        assert lines[0] == "35 [2, 8] [5, 9, 7, 8] [2, 7, 1, 9] [] [5, 3]"
+        # Writing to the list after slicing does not show through the slices
+        assert lines[1] == "[5, 3, 100, 1, 7, 2, 8] [3, 9, 1, 7] [7, 1, 9, 3] 4 7"
+        # Writing to a slice (or a[:] copy) leaves the list and other slices alone
+        assert lines[2] == "[3, 9, 1, 7, 4] [7, 1, 9, 3] 5 True True ell olleh"
+        
+        os.remove(cpp_file)
+
+    def test_buffered_print_and_input(self, transpiler, runtime_path):
+        """Test Python float repr, buffered input() and output kept when the program fails."""
+        source = """
+print(2.5, 0.1, 1 / 3, 1e16, 1e15, 100.0, 1e-05, 0.0001, [0.5, 2.0])
+name = input("Name: ")
+print("Hi", name)
+print(input() + "!")
+items = [1]
+print(items[3])
+"""
+        
+        cpp_file = transpiler.transpile(source, "test_e2e_io.cpp")
+        stdout, stderr, retcode = self.compile_and_run(cpp_file, runtime_path, stdin="Ada\r\nlast")
+        
+        # The index error ends the program, but everything printed before it is flushed
+        assert retcode != 0
+        assert "Index out of range" in stderr
+        lines = stdout.split('\n')
+        assert lines[0] == "2.5 0.1 0.3333333333333333 1e+16 1000000000000000.0 100.0 1e-05 0.0001 [0.5, 2.0]"
+        assert lines[1] == "Name: Hi Ada"
+        assert lines[2] == "last!"
+        
+        os.remove(cpp_file)
+
+    def test_heap_object_pool(self, transpiler, runtime_path):
+        """Test heavy allocation churn gives the same results with and without the pool."""
+        source = """
+def build(n):
+    rows = []
+    for i in range(n):
+        rows.append([i, str(i), {"k": i}, {i}])
+    return rows
+
+total = 0
+rows = []
+for k in range(50):
+    rows = build(200)
+    total = total + len(rows) + rows[k][2]["k"]
+print(total, rows[199], len(str(rows)))
+"""
+        
+        cpp_file = transpiler.transpile(source, "test_e2e_pool.cpp")
+        pooled = self.compile_and_run(cpp_file, runtime_path)
+        # The runtime builds warning-free without the pool as well
+        system = self.compile_and_run(
+            cpp_file, runtime_path, flags=("-DTRANSPYLER_SYSTEM_ALLOCATOR", "-Wall", "-Wextra", "-Werror")
+        )
+        
+        assert pooled[2] == 0, f"Execution failed: {pooled[1]}"
+        assert system[2] == 0, f"Execution failed: {system[1]}"
+        assert pooled[0] == system[0]
+        assert pooled[0].split()[:2] == ["11225", "[199,"]
+        
+        os.remove(cpp_file)
+
+    def test_int_overflow_promotes_to_big_int(self, transpiler, runtime_path):
+        """Test ints past 64 bits stay exact, in generic code and in typed clones."""
+        source = """
+def fact(n):
+    f = 1
+    for i in range(1, n + 1):
+        f = f * i
+    return f
+
+def fib(n):
+    a = 0
+    b = 1
+    for i in range(n):
+        t = a + b
+        a = b
+        b = t
+    return a
+
+m = 9223372036854775807
+print(m + 1, m * m, -m - 2, 2 ** 100)
+print(fact(30), fib(100), fact(25) // fact(23), fact(30) % 1000000007)
+big = 2 ** 64
+print(big - 1 == 18446744073709551615, big > m, -(2 ** 63), (big - big) + 1, type(big))
+print(int("123456789012345678901234567890") + 1, abs(-big), 2 ** -1 == 0.5)
+"""
+        
+        cpp_file = transpiler.transpile(source, "test_e2e_bigint.cpp")
+        with open(cpp_file) as f:
+            assert "DynamicType f = DynamicType(1);" in f.read()  # Product grows past long long
+        stdout, stderr, retcode = self.compile_and_run(cpp_file, runtime_path)
+        
+        assert retcode == 0, f"Execution failed: {stderr}"
+        lines = stdout.strip().split('\n')
+        assert lines[0] == (
+            "9223372036854775808 85070591730234615847396907784232501249 "
+            "-9223372036854775809 1267650600228229401496703205376"
+        )
+        assert lines[1] == (
+            "265252859812191058636308480000000 354224848179261915075 600 109361473"
+        )
+        assert lines[2] == "True True -9223372036854775808 1 <class 'int'>"
+        assert lines[3] == "123456789012345678901234567891 18446744073709551616 True"
+
+        os.remove(cpp_file)
+
+    def test_int_conversion_in_lowered_code(self, transpiler, runtime_path):
+        """Test int() of a str, big int or float keeps values past long long exact."""
+        source = """
+def convert(text, big, d):
+    a = int(text)
+    b = int(big)
+    c = int(d)
+    n = int(7)
+    return [a + 1, b, c, int(-d), int(-2.5), n * n]
+
+print(convert("123456789012345678901234567890", 10 ** 30, 2e19))
+"""
+
+        cpp_file = transpiler.transpile(source, "test_e2e_bigint.cpp")
+        with open(cpp_file) as f:
+            code = f.read()
+        assert "DynamicType c = int_(d);" in code  # 2e19 is past long long
+        assert "long long n = 7LL;" in code
+        stdout, stderr, retcode = self.compile_and_run(
+            cpp_file, runtime_path, flags=("-O1", "-fsanitize=undefined", "-fno-sanitize-recover")
+        )
+
+        assert retcode == 0, f"Execution failed: {stderr}"
+        assert stdout.strip() == (
+            "[123456789012345678901234567891, 1000000000000000000000000000000, "
+            "20000000000000000000, -20000000000000000000, -2, 49]"
+        )
+
+        os.remove(cpp_file)
+
+    def test_lowered_ints_never_wrap(self, transpiler, runtime_path):
+        """Test locals are only lowered to long long when their range fits."""
+        source = """
+def cubes(count):
+    total = 0
+    for i in range(count):
+        total += i*i*i
+    return total
+
+def power(n):
+    x = n*n
+    y = x*x
+    return y
+
+def small():
+    total = 0
+    for i in range(1000):
+        total += i*i*i
+    return total
+
+def fib(n):
+    if n < 2:
+        return n
+    return fib(n - 1) + fib(n - 2)
+
+print(cubes(3000000))
+print(power(100000))
+n = 100000
+x = n*n
+y = x*x
+print(y, small(), fib(20))
+"""
+
+        cpp_file = transpiler.transpile(source, "test_e2e_int_ranges.cpp")
+        with open(cpp_file) as f:
+            code = f.read()
+        assert "DynamicType total = DynamicType(0);" in code  # 2.0e25 outgrows long long
+        assert "long long total = 0LL;" in code                # small() stays below 2.5e11
+        # -fsanitize=undefined aborts on any signed overflow in the lowered code
+        stdout, stderr, retcode = self.compile_and_run(
+            cpp_file, runtime_path, flags=("-O1", "-fsanitize=undefined", "-fno-sanitize-recover")
+        )
+
+        assert retcode == 0, f"Execution failed: {stderr}"
+        assert stdout.strip().split('\n') == [
+            "20249986500002250000000000",
+            "100000000000000000000",
+            "100000000000000000000 249500250000 6765",
+        ]
+
+        os.remove(cpp_file)
+
+    def test_native_code_near_int64_limits(self, transpiler, runtime_path):
+        """Test typed clones, generators and native loops at the edges of int64."""
+        source = """
+def tail(stop):
+    seen = []
+    for i in range(stop - 7, stop, 3):
+        seen.append(i)
+    return seen
+
+def squares(n):
+    for i in range(n - 2, n):
+        yield i * i
+
+def scaled(a, b):
+    return a * b + a
+
+def literals():
+    x = 100000 * 100000
+    y = 65536 * 65536 * 4
+    z = -2147483647 - 10
+    return [x, y, z]
+
+def between(low, high):
+    out = []
+    i = low
+    while i < high:
+        out.append(i)
+        i += 1
+    return out
+
+m = 9223372036854775807
+print(tail(m))
+print(list(squares(m)))
+print(scaled(3037000499, 3037000499), scaled(5000000000, 5000000000))
+print(between(-m, -m + 3), len(between(5, 9)))
+print(literals())
+"""
+
+        cpp_file = transpiler.transpile(source, "test_e2e_int64_limits.cpp")
+        with open(cpp_file) as f:
+            # Products of int literals that only fit int64 are not evaluated in 32 bits
+            assert "long long x = ((100000LL) * (100000LL));" in f.read()
+        stdout, stderr, retcode = self.compile_and_run(
+            cpp_file, runtime_path, flags=("-fsanitize=undefined", "-fno-sanitize-recover")
+        )
+
+        assert retcode == 0, f"Execution failed: {stderr}"
+        assert stdout.strip().split('\n') == [
+            "[9223372036854775800, 9223372036854775803, 9223372036854775806]",
+            "[85070591730234615810503419636813398025, 85070591730234615828950163710522949636]",
+            "9223372033963249500 25000000005000000000",
+            "[-9223372036854775807, -9223372036854775806, -9223372036854775805] 4",
+            "[10000000000, 17179869184, -2147483657]",
+        ]
+
+        os.remove(cpp_file)
+
+    def test_packed_list_storage(self, transpiler, runtime_path):
+        """Test int and float lists stay correct as they switch storage."""
+        source = """
+xs = [5, 3, 9, 1]
+xs[0] = 7
+xs[1] += 10
+xs[2] *= 2
+xs[3] //= 2
+print(xs, sum(xs), min(xs), max(xs), 13 in xs, 5 in xs)
+fs = [1.5, 2.5]
+fs.append(0.25)
+print(fs, sum(fs), min(fs), max(fs))
+fs.append(1)
+fs[0] = 4
+print(fs, sum(fs), max(fs))
+ys = []
+for i in range(5):
+    ys.append(i * i)
+view = ys[1::2]
+ys[2] = 2.5
+print(ys, view, ys[1:] + [7, 8], view == [1, 9])
+zs = [9223372036854775807, 1]
+zs.extend(view)
+print(sum(zs), min(zs), len(zs))
+"""
+
+        cpp_file = transpiler.transpile(source, "test_e2e_packed_lists.cpp")
+        with open(cpp_file) as f:
+            assert ".setItem(" in f.read()
+        stdout, stderr, retcode = self.compile_and_run(cpp_file, runtime_path)
+
+        assert retcode == 0, f"Execution failed: {stderr}"
+        assert stdout.strip().split('\n') == [
+            "[7, 13, 18, 0] 38 0 18 True False",
+            "[1.5, 2.5, 0.25] 4.25 0.25 2.5",
+            "[4, 2.5, 0.25, 1] 7.75 4",
+            "[0, 1, 2.5, 9, 16] [1, 9] [1, 2.5, 9, 16, 7, 8] True",
+            "9223372036854775818 1 4",
+        ]
+
+        os.remove(cpp_file)
+
+    def test_bulk_list_kernels(self, transpiler, runtime_path):
+        """Test sum, min, max, count, index and sorting, with and without the parallel build."""
+        source = """
+xs = []
+for i in range(1100003):
+    xs.append((i * 7919) % 1000003 - 500000)
+ys = sorted(xs)
+print(sum(xs), min(xs), max(xs), xs.count(17), xs.index(17), 500003 in xs)
+print(ys[0], ys[550001], ys[len(ys) - 1], len(ys))
+big = [4611686018427387904, 4611686018427387904, 4611686018427387904, -5]
+print(sum(big), min(big), max(big[1:]))
+fs = [2.5, 1.0, 3.25, 1.0, -0.5]
+fs.sort()
+print(fs, fs.count(1.0), fs.index(3.25), sum(fs), 1 in fs)
+mixed = [3, 1.5, 2, True]
+mixed.sort()
+words = "banana"
+print(mixed, sorted(range(5, 0, -1)), words.count("an"), words.index("na"))
+"""
+
+        cpp_file = transpiler.transpile(source, "test_e2e_bulk_kernels.cpp")
+        serial = self.compile_and_run(cpp_file, runtime_path)
+        parallel = self.compile_and_run(cpp_file, runtime_path, flags=("-O2", "-DTRANSPYLER_PARALLEL"))
+
+        assert serial[2] == 0, f"Execution failed: {serial[1]}"
+        assert parallel[2] == 0, f"Execution failed: {parallel[1]}"
+        assert serial[0] == parallel[0]
+        assert serial[0].strip().split('\n') == [
+            "-3583467 -500000 500002 1 709372 False",
+            "-500000 -3 500002 1100003",
+            "13835058055282163707 -5 4611686018427387904",
+            "[-0.5, 1.0, 1.0, 2.5, 3.25] 2 4 7.25 True",
+            "[True, 1.5, 2, 3] [1, 2, 3, 4, 5] 2 2",
+        ]
+
+        os.remove(cpp_file)
+
+        # Failed searches raise, and a string is only searched for a string
+        for body, message in [
+            ('print("banana".index(5))\n', "index() needs a string argument"),
+            ('print("banana".index("x"))\n', "substring not found"),
+            ("print([1, 2].index(3))\n", "3 is not in list"),
+        ]:
+            cpp_file = transpiler.transpile(body, "test_e2e_index_errors.cpp")
+            stdout, stderr, retcode = self.compile_and_run(cpp_file, runtime_path)
+            assert retcode != 0
+            assert message in stderr
+            os.remove(cpp_file)
+
+    def test_parallel_map(self, transpiler, runtime_path):
+        """Test parallel_map keeps item order and raises errors, serially and on the worker pool."""
+        source = """
+def fib(n):
+    if n < 2:
+        return n
+    return fib(n - 1) + fib(n - 2)
+
+def describe(word):
+    return word + ":" + str(len(word))
+
+def total(n):
+    return sum(parallel_map(fib, range(n)))
+
+def check(x):
+    if x == 37:
+        print(1 // 0)
+    return x
+
+sizes = []
+for i in range(40):
+    sizes.append(i % 20)
+words = []
+for i in range(30):
+    words.append("w" * (i % 4 + 1))
+numbers = parallel_map(fib, sizes)
+labels = parallel_map(describe, words)
+print(numbers[15:25], sum(numbers))
+print(labels[:5], len(labels))
+print(parallel_map(total, [5, 10]), parallel_map(abs, [-2, 3]), parallel_map(str, range(3)), parallel_map(fib, []))
+print(parallel_map(check, range(40)))
+"""
+
+        cpp_file = transpiler.transpile(source, "test_e2e_parallel_map.cpp")
+        with open(cpp_file) as f:
+            assert "parallel_map(_fn_fib, sizes)" in f.read()
+        serial = self.compile_and_run(cpp_file, runtime_path)
+        parallel = self.compile_and_run(cpp_file, runtime_path, flags=("-O2", "-DTRANSPYLER_PARALLEL", "-pthread"),
+                                        env=dict(os.environ, TRANSPYLER_THREADS="4"))
+
+        assert serial[0] == parallel[0]
+        assert serial[0].strip().split('\n') == [
+            "[610, 987, 1597, 2584, 4181, 0, 1, 1, 2, 3] 21890",
+            "[w:1, ww:2, www:3, wwww:4, w:1] 30",
+            "[7, 88] [2, 3] [0, 1, 2] []",
+        ]
+        for stdout, stderr, retcode in (serial, parallel):
+            assert retcode != 0
+            assert "Floor division by zero" in stderr
+
+        os.remove(cpp_file)
+
+    def test_save_load(self, transpiler, runtime_path, tmp_path):
+        """Test load() gives back what save() wrote, and that loaded packed lists can still be modified."""
+        table = str(tmp_path / "table.bin")
+        source = f"""
+ids = []
+for i in range(1000):
+    ids.append(i * 7 % 1000)
+weights = [0.1, 2.5, -3.0, 1e300]
+data = [ids, weights, {{"a": 1, "b": [1, 2.5, "x"], 3: None}}, {{1, 2, 3}}, "text", True, 2 ** 100, range(1, 10, 2), [], ids[1:9:2]]
+save(data, "{table}")
+back = load("{table}")
+print(back == data, back[1], back[2], back[6], back[7], back[9])
+loaded = back[0]
+loaded.append(-1)
+loaded.sort()
+print(loaded[:4], len(loaded), sum(back[0]), ids[:3])
+"""
+
+        cpp_file = transpiler.transpile(source, "test_e2e_save_load.cpp")
+        stdout, stderr, retcode = self.compile_and_run(cpp_file, runtime_path)
+        assert retcode == 0, stderr
+        assert stdout.strip().split('\n') == [
+            "True [0.1, 2.5, -3.0, 1e+300] {'a': 1, 'b': [1, 2.5, x], 3: None} 1267650600228229401496703205376 range(1, 10, 2) [7, 21, 35, 49]",
+            "[-1, 0, 1, 2] 1001 499499 [0, 7, 14]",
+        ]
+        os.remove(cpp_file)
+
+        # A truncated file is rejected instead of read past its end
+        with open(table, "rb") as f:
+            contents = f.read()
+        with open(table, "wb") as f:
+            f.write(contents[:100])
+        cpp_file = transpiler.transpile(f'print(load("{table}"))', "test_e2e_load_truncated.cpp")
+        stdout, stderr, retcode = self.compile_and_run(cpp_file, runtime_path)
+        assert retcode != 0
+        assert "not a file written by save()" in stderr
+
+        os.remove(cpp_file)
+
+    def test_unchecked_build(self, transpiler, runtime_path):
+        """Test a clean program behaves the same with the hot-path type checks compiled out."""
+        source = """
+def tally(words):
+    counts = {}
+    for w in words:
+        if w in counts:
+            counts[w] += 1
+        else:
+            counts[w] = 1
+    return counts
+
+grid = []
+for i in range(50):
+    grid.append([i, i * 2.5])
+total = 0
+for row in grid:
+    row[0] = row[0] + 1
+    total = total + row[0] + row[1]
+counts = tally(["a", "b", "a", "c", "a"])
+print(total, counts["a"], len(counts), grid[49], 10 // 3, 7 % -3)
+"""
+
+        cpp_file = transpiler.transpile(source, "test_e2e_unchecked.cpp")
+        checked = self.compile_and_run(cpp_file, runtime_path)
+        unchecked = self.compile_and_run(cpp_file, runtime_path, flags=("-O2", "-DTRANSPYLER_UNCHECKED"))
+
+        assert checked[2] == 0, f"Execution failed: {checked[1]}"
+        assert unchecked[2] == 0, f"Execution failed: {unchecked[1]}"
+        assert checked[0] == unchecked[0]
+        assert checked[0].strip() == "4337.5 3 3 [50, 122.5] 3 -2"
+
+        os.remove(cpp_file)
+
+    def test_profile_build(self, runtime_path):
+        """Test the profiling build reports dispatches, events and per-function times at exit."""
+        source = """
+def fib(n):
+    if n < 2:
+        return n
+    return fib(n - 1) + fib(n - 2)
+
+def label(values):
+    text = ""
+    for v in values:
+        text = text + str(v)
+    return text
+
+words = [1.5, 2.5]
+words.append("x")
+print(fib(10), label(words))
+"""
+
+        cpp_file = Transpiler(profile=True).transpile(source, "test_e2e_profile.cpp")
+        plain = self.compile_and_run(cpp_file, runtime_path)
+        table = self.compile_and_run(cpp_file, runtime_path, flags=("-DTRANSPYLER_PROFILE",))
+        report = self.compile_and_run(cpp_file, runtime_path, flags=("-DTRANSPYLER_PROFILE",),
+                                      env=dict(os.environ, TRANSPYLER_PROFILE_FORMAT="json"))
+
+        assert plain[2] == 0 and table[2] == 0 and report[2] == 0, f"Execution failed: {table[1]}"
+        # The timers are no-ops without -DTRANSPYLER_PROFILE; output is the same either way
+        assert plain[0].strip() == table[0].strip() == "55 1.52.5x"
+        assert plain[1] == ""
+        assert "TransPYler profile" in table[1]
+
+        profile = json.loads(report[1])
+        calls = {f["name"]: f["calls"] for f in profile["functions"]}
+        # The generic fib() forwards int arguments to its typed clone fib__i(), if one is emitted
+        assert max(calls["fib"], calls.get("fib__i", 0)) == 177
+        assert calls["label"] == 1
+        assert any(d["op"] == "add" and d["lhs"] == "str" and d["rhs"] == "str" for d in profile["dispatches"])
+        assert any(e["event"] == "unpack" and e["type"] == "float" for e in profile["events"])
+        assert profile["exceptions"] == 0
+
+        os.remove(cpp_file)
+
+    def test_build_cache(self, runtime_path):
+        """The build cache restores unchanged C++ and executables and only recompiles what changed."""
+        with tempfile.TemporaryDirectory() as cache_dir:
+            cache = BuildCache(cache_dir, launcher="")
+            flags = ["-std=c++17", "-I", str(runtime_path)]
+            sources = ["test_e2e_cache.cpp"] + [str(runtime_path / name) for name in ("DynamicType.cpp", "BigInt.cpp", "builtins.cpp")]
+            exe_file = os.path.join(cache_dir, "program")
+
+            def entries(kind):
+                return sum(1 for p in Path(cache_dir, kind).rglob("*") if p.is_file())
+
+            def build_and_run():
+                assert cache.compile("g++", flags, sources, exe_file).returncode == 0
+                return subprocess.run([exe_file], capture_output=True, text=True).stdout.strip()
+
+            expected = Path(Transpiler(cache=cache).transpile("print(6 * 7)\n", "test_e2e_cache.cpp")).read_text()
+            os.remove("test_e2e_cache.cpp")
+            hit = Transpiler(cache=cache)
+            cpp_file = hit.transpile("print(6 * 7)\n", "test_e2e_cache.cpp")
+            # A hit never builds the parser
+            assert hit._parser is None
+            assert Path(cpp_file).read_text() == expected
+            # Other code generation options are separate entries
+            Transpiler(profile=True, cache=cache).transpile("print(6 * 7)\n", "test_e2e_cache_profile.cpp")
+            os.remove("test_e2e_cache_profile.cpp")
+            assert entries("cpp") == 2
+
+            assert build_and_run() == "42"
+            assert entries("obj") == 4 and entries("exe") == 1
+
+            # Unchanged: the executable comes from the cache
+            os.remove(exe_file)
+            assert build_and_run() == "42"
+            assert entries("obj") == 4 and entries("exe") == 1
+
+            # Changed program: only its own object is compiled, the runtime objects are reused
+            Transpiler(cache=cache).transpile("print(6 * 9)\n", cpp_file)
+            assert build_and_run() == "54"
+            assert entries("obj") == 5 and entries("exe") == 2
+
+        os.remove(cpp_file)
+
+    def test_build_cache_key_covers_transpiler_sources(self, tmp_path):
+        """Editing any transpiler package, including the AST in core, invalidates cached C++."""
+        shutil.copytree("src", tmp_path, dirs_exist_ok=True, ignore=shutil.ignore_patterns("__pycache__", "runtime"))
+        saved_root = build_cache._SRC_ROOT
+        build_cache._SRC_ROOT = tmp_path
+        try:
+            versions = set()
+            for edited in [None, "core/ast/ast_expressions.py", "codegen/expr_generator.py"]:
+                if edited is not None:
+                    with open(tmp_path / edited, "a") as f:
+                        f.write("\n# edited\n")
+                build_cache.transpiler_version.cache_clear()
+                versions.add(build_cache.transpiler_version())
+            assert len(versions) == 3
+        finally:
+            build_cache._SRC_ROOT = saved_root
+            build_cache.transpiler_version.cache_clear()
+
+
+    def test_batch_build(self):
+        """Batch mode builds every script of a directory and reports the broken ones."""
+        with tempfile.TemporaryDirectory() as work:
+            scripts = Path(work, "scripts")
+            (scripts / "nested").mkdir(parents=True)
+            # Sorted first: the unfinished script must not leak lexer state into the next ones
+            (scripts / "a_broken.py").write_text("x = (\n")
+            (scripts / "square.py").write_text("def square(n):\n    return n * n\n\nprint(square(7))\n")
+            (scripts / "nested" / "greet.flpy").write_text("for w in ['a', 'b']:\n    print(w + '!')\n")
+
+            sources = collect_sources(scripts)
+            assert [p.name for p in sources] == ["a_broken.py", "greet.flpy", "square.py"]
+            results = build_all(sources, Path(work, "out"), BuildCache(Path(work, "cache"), launcher=""),
+                                flags=["-std=c++17"], jobs=2, root=scripts)
+
+            broken, greet, square = results
+            assert broken.error is not None and broken.executable is None
+            assert greet.error is None and greet.executable == Path(work, "out", "nested", "greet.exe")
+            assert square.error is None and square.compile_ms > 0
+            assert subprocess.run([str(greet.executable)], capture_output=True, text=True).stdout.split() == ["a!", "b!"]
+            assert subprocess.run([str(square.executable)], capture_output=True, text=True).stdout.strip() == "49"
+
+            manifest = Path(work, "manifest.txt")
+            manifest.write_text("# smoke test\nscripts/square.py\n")
+            assert collect_sources(manifest) == [Path(work, "scripts", "square.py")]
 
 
 if __name__ == "__main__":
@@ -0,0 +1,117 @@
+"""
+test_specialization.py
+----------------------
+Unit tests for FunctionSpecializer: typed clones of user functions.
+
+Tests validate:
+- Call sites with native arguments produce clones, solely dynamic ones do not
+- Recursive clones get a native return type from the fixed point, unless
+  the returned range can outgrow a long long (fib stays DynamicType)
+- Clones contradicted by their body are dropped
+- Generated code: clone signatures, dispatch stub and const& parameters
+"""
+
+import pytest
+from src.core import (
+    Module, FunctionDef, Identifier, LiteralExpr, BinaryExpr, CallExpr,
+    Assign, ExprStmt, Return, If, Block, Attribute
+)
+from src.core.ast.ast_expressions import ComparisonExpr
+from src.codegen.specialization import FunctionSpecializer
+from src.codegen.code_generator import CodeGenerator
+
+
+def _name(n):
+    return Identifier(name=n)
+
+
+def _call(fn, *args):
+    return CallExpr(callee=_name(fn), args=list(args))
+
+
+def _fib():
+    # def fib(n): if n < 2: return n; return fib(n - 1) + fib(n - 2)
+    return FunctionDef(name="fib", params=[_name("n")], body=[
+        If(cond=ComparisonExpr(left=_name("n"), op="<", right=LiteralExpr(value=2)),
+           body=Block(statements=[Return(value=_name("n"))]), elifs=[], orelse=None),
+        Return(value=BinaryExpr(
+            left=_call("fib", BinaryExpr(left=_name("n"), op="-", right=LiteralExpr(value=1))),
+            op="+",
+            right=_call("fib", BinaryExpr(left=_name("n"), op="-", right=LiteralExpr(value=2))))),
+    ])
+
+
+def _gcd():
+    # def gcd(a, b): if b == 0: return a; return gcd(b, a % b)
+    return FunctionDef(name="gcd", params=[_name("a"), _name("b")], body=[
+        If(cond=ComparisonExpr(left=_name("b"), op="==", right=LiteralExpr(value=0)),
+           body=Block(statements=[Return(value=_name("a"))]), elifs=[], orelse=None),
+        Return(value=_call("gcd", _name("b"), BinaryExpr(left=_name("a"), op="%", right=_name("b")))),
+    ])
+
+
+def _gcd_call():
+    return ExprStmt(value=_call("gcd", LiteralExpr(value=1071), LiteralExpr(value=462)))
+
+
+class TestFunctionSpecializer:
+    """Test which clones are chosen."""
+
+    def setup_method(self):
+        self.specializer = FunctionSpecializer()
+
+    def test_recursive_int_clone(self):
+        self.specializer.analyze([_gcd(), _gcd_call()])
+        clones = self.specializer.clones_of("gcd")
+        assert [c.param_types for c in clones] == [("long long", "long long")]
+        assert clones[0].return_type == "long long"
+        assert clones[0].cpp_name == "_fn_gcd__ii"
+
+    def test_growing_recursion_returns_dynamic(self):
+        # fib(n - 1) + fib(n - 2) overflows a long long around n = 93
+        self.specializer.analyze([_fib(), ExprStmt(value=_call("fib", LiteralExpr(value=20)))])
+        clones = self.specializer.clones_of("fib")
+        assert [c.param_types for c in clones] == [("long long",)]
+        assert clones[0].return_type == "DynamicType"
+        assert clones[0].cpp_name == "_fn_fib__i"
+
+    def test_dynamic_arguments_get_no_clone(self):
+        self.specializer.analyze([_fib(), ExprStmt(value=_call("fib", LiteralExpr(value="x")))])
+        assert self.specializer.clones_of("fib") == []
+
+    def test_contradicted_clone_is_dropped(self):
+        # def f(x): x = "s"; return x   called as f(1)
+        fn = FunctionDef(name="f", params=[_name("x")], body=[
+            Assign(target=_name("x"), op="=", value=LiteralExpr(value="s")),
+            Return(value=_name("x")),
+        ])
+        self.specializer.analyze([fn, ExprStmt(value=_call("f", LiteralExpr(value=1)))])
+        assert self.specializer.clones_of("f") == []
+
+
+class TestSpecializedCodegen:
+    """Test the generated clones and generic fallback."""
+
+    def test_clone_dispatch_and_prototypes(self):
+        module = Module(body=[_gcd(), _gcd_call()])
+        code = CodeGenerator().generate(module)
+        assert "long long _fn_gcd__ii(long long a, long long b);" in code
+        assert "DynamicType _fn_gcd(const DynamicType &a, const DynamicType &b);" in code
+        assert "return _fn_gcd__ii(b, py_mod(a, b));" in code
+        assert "if (a.isInt() && b.isInt()) return DynamicType(_fn_gcd__ii(a.toInt(), b.toInt()));" in code
+        assert code.index("_fn_gcd__ii(long long a, long long b) {") < code.index("_fn_gcd(const DynamicType &a, const DynamicType &b) {")
+
+    def test_dynamic_return_clone_dispatch(self):
+        module = Module(body=[_fib(), ExprStmt(value=_call("fib", LiteralExpr(value=20)))])
+        code = CodeGenerator().generate(module)
+        assert "DynamicType _fn_fib__i(long long n);" in code
+        assert "return (_fn_fib__i(((n) - (1LL)))) + (_fn_fib__i(((n) - (2LL))));" in code
+        assert "if (n.isInt()) return _fn_fib__i(n.toInt());" in code
+
+    def test_mutated_param_taken_by_value(self):
+        # def push(xs, v): xs.append(v)
+        fn = FunctionDef(name="push", params=[_name("xs"), _name("v")], body=[
+            ExprStmt(value=CallExpr(callee=Attribute(value=_name("xs"), attr="append"), args=[_name("v")])),
+        ])
+        code = CodeGenerator().generate(Module(body=[fn]))
+        assert "DynamicType _fn_push(DynamicType xs, const DynamicType &v) {" in code
@@ -0,0 +1,178 @@
+"""
+test_type_inference.py
+----------------------
+Unit tests for TypeInference: native C++ types for monomorphic function locals.
+
+Tests validate:
+- int, float and bool locals are lowered; mixed or unknown ones stay DynamicType
+- Parameters, non-range loop targets and collections are never lowered
+- Range loop counters become native counting loops
+- Ints whose value range can outgrow a long long stay DynamicType (they promote
+  to big ints); bounded loops and early-return guards keep ranges tight
+- Lowered values are boxed where a DynamicType is needed
+"""
+
+import pytest
+from src.core import (
+    FunctionDef, Identifier, LiteralExpr, BinaryExpr, CallExpr,
+    Assign, ExprStmt, Return, For, If, Block, ListExpr
+)
+from src.core.ast.ast_expressions import ComparisonExpr
+from src.codegen.type_inference import TypeInference
+from src.codegen.function_generator import FunctionGenerator
+from src.codegen.scope_manager import ScopeManager
+
+
+def _assign(name, value, op="="):
+    return Assign(target=Identifier(name=name), op=op, value=value)
+
+
+def _fn(body, params=()):
+    return FunctionDef(name="f", params=[Identifier(name=p) for p in params], body=list(body))
+
+
+class TestTypeInference:
+    """Test which locals are proven monomorphic."""
+
+    def setup_method(self):
+        self.inference = TypeInference()
+
+    def test_int_float_bool_locals(self):
+        fn = _fn([
+            _assign("i", LiteralExpr(value=0)),
+            _assign("i", BinaryExpr(left=Identifier(name="i"), op="+", right=LiteralExpr(value=1))),
+            _assign("avg", BinaryExpr(left=Identifier(name="i"), op="/", right=LiteralExpr(value=2))),
+            _assign("done", BinaryExpr(left=Identifier(name="i"), op=">", right=LiteralExpr(value=3))),
+        ])
+        types = self.inference.infer_function(fn)
+        assert types == {"i": "long long", "avg": "double", "done": "bool"}
+
+    def test_type_change_stays_dynamic(self):
+        fn = _fn([
+            _assign("x", LiteralExpr(value=1)),
+            _assign("x", LiteralExpr(value="one")),
+            _assign("y", LiteralExpr(value=1)),
+            _assign("y", LiteralExpr(value=1.5)),
+        ])
+        assert self.inference.infer_function(fn) == {}
+
+    def test_params_and_dependents_stay_dynamic(self):
+        fn = _fn([
+            _assign("total", BinaryExpr(left=Identifier(name="n"), op="+", right=LiteralExpr(value=1))),
+            _assign("size", CallExpr(callee=Identifier(name="len"), args=[Identifier(name="n")])),
+            _assign("items", ListExpr(elements=[])),
+        ], params=["n"])
+        assert self.inference.infer_function(fn) == {"size": "long long"}
+
+    def test_range_counter_and_generic_loop(self):
+        fn = _fn([
+            For(target=Identifier(name="i"),
+                iterable=CallExpr(callee=Identifier(name="range"), args=[Identifier(name="n")]),
+                body=Block(statements=[])),
+            For(target=Identifier(name="x"), iterable=Identifier(name="n"),
+                body=Block(statements=[])),
+        ], params=["n"])
+        assert self.inference.infer_function(fn) == {"i": "long long"}
+
+    def test_growing_ints_stay_dynamic(self):
+        def binop(l, op, r):
+            return BinaryExpr(left=l, op=op, right=r)
+
+        i, f, a, b, h = (Identifier(name=n) for n in ("i", "f", "a", "b", "h"))
+        fn = _fn([
+            _assign("f", LiteralExpr(value=1)),
+            _assign("a", LiteralExpr(value=0)),
+            _assign("b", LiteralExpr(value=1)),
+            _assign("h", LiteralExpr(value=0)),
+            _assign("total", LiteralExpr(value=0)),
+            _assign("g", LiteralExpr(value=0)),
+            For(target=i,
+                iterable=CallExpr(callee=Identifier(name="range"), args=[LiteralExpr(value=10)]),
+                body=Block(statements=[
+                    _assign("f", i, op="*="),                               # factorial
+                    _assign("b", binop(a, "+", b)),                         # fibonacci pair
+                    _assign("a", binop(b, "-", a)),
+                    _assign("h", binop(binop(h, "*", LiteralExpr(value=31)), "%", LiteralExpr(value=1000003))),
+                    _assign("total", i, op="+="),                           # linear accumulator
+                    _assign("g", binop(f, "+", LiteralExpr(value=1))),      # computed from f
+                ])),
+        ])
+        assert self.inference.infer_function(fn) == {"i": "long long", "h": "long long", "total": "long long"}
+
+    def test_accumulator_range_follows_trip_count(self):
+        # total += i*i*i reaches 2.0e25 over range(3000000) but only 2025 over range(10)
+        def cubes(count):
+            i = Identifier(name="i")
+            cube = BinaryExpr(left=BinaryExpr(left=i, op="*", right=i), op="*", right=i)
+            return _fn([
+                _assign("total", LiteralExpr(value=0)),
+                For(target=i,
+                    iterable=CallExpr(callee=Identifier(name="range"), args=[LiteralExpr(value=count)]),
+                    body=Block(statements=[_assign("total", cube, op="+=")])),
+            ])
+
+        assert self.inference.infer_function(cubes(3000000)) == {"i": "long long"}
+        assert self.inference.infer_function(cubes(10)) == {"i": "long long", "total": "long long"}
+
+    def test_product_range_overflow_stays_dynamic(self):
+        # n = 100000; x = n*n; y = x*x   (y is 10**20)
+        n, x = Identifier(name="n"), Identifier(name="x")
+        fn = _fn([
+            _assign("n", LiteralExpr(value=100000)),
+            _assign("x", BinaryExpr(left=n, op="*", right=n)),
+            _assign("y", BinaryExpr(left=x, op="*", right=x)),
+        ])
+        assert self.inference.infer_function(fn) == {"n": "long long", "x": "long long"}
+
+    def test_early_return_guard_narrows_param(self):
+        # if n < 1: return 0; half = n - 1   (n - 1 cannot wrap below INT64_MIN)
+        n = Identifier(name="n")
+        fn = _fn([
+            If(cond=ComparisonExpr(left=n, op="<", right=LiteralExpr(value=1)),
+               body=Block(statements=[Return(value=LiteralExpr(value=0))]), elifs=[], orelse=None),
+            _assign("half", BinaryExpr(left=n, op="-", right=LiteralExpr(value=1))),
+        ], params=["n"])
+        assert self.inference.infer_function(fn, {"n": "long long"}) == {"n": "long long", "half": "long long"}
+        unguarded = _fn([fn.body[1]], params=["n"])
+        assert self.inference.infer_function(unguarded, {"n": "long long"}) == {"n": "long long"}
+
+
+class TestLoweredCodegen:
+    """Test code generation for lowered locals."""
+
+    def setup_method(self):
+        self.gen = FunctionGenerator(scope=ScopeManager())
+
+    def test_native_counting_loop_and_boxing(self):
+        fn = _fn([
+            _assign("total", LiteralExpr(value=0)),
+            For(target=Identifier(name="i"),
+                iterable=CallExpr(callee=Identifier(name="range"), args=[Identifier(name="n")]),
+                body=Block(statements=[
+                    _assign("total", LiteralExpr(value=1), op="+="),
+                    ExprStmt(value=CallExpr(callee=Identifier(name="print"), args=[Identifier(name="i")])),
+                ])),
+            Return(value=Identifier(name="total")),
+        ], params=["n"])
+        code = self.gen.visit(fn)
+        assert "long long total = 0LL;" in code
+        assert "for (long long i = 0, __stop_i = static_cast<long long>((n).toInt()); i < __stop_i; ++i)" in code
+        assert "total = ((total) + (1LL));" in code
+        assert "print(DynamicType(i));" in code
+        assert "return DynamicType(total);" in code
+
+    def test_stepped_loop_increment_cannot_wrap(self):
+        def stepped(stop):
+            return _fn([
+                For(target=Identifier(name="i"),
+                    iterable=CallExpr(callee=Identifier(name="range"),
+                                      args=[LiteralExpr(value=0), stop, LiteralExpr(value=3)]),
+                    body=Block(statements=[
+                        ExprStmt(value=CallExpr(callee=Identifier(name="print"), args=[Identifier(name="i")])),
+                    ])),
+            ], params=["n"])
+
+        assert "; i += 3)" in self.gen.visit(stepped(LiteralExpr(value=100)))
+        # n can be close to INT64_MAX, where i + 3 would overflow
+        code = self.gen.visit(stepped(Identifier(name="n")))
+        assert "i = add_overflow(i, 3, i) ? __stop_i : i)" in code